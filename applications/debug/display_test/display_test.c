@@ -91,6 +91,8 @@ static void display_test_reload_config(DisplayTest* instance) {
         instance->config_contrast,
         instance->config_regulation_ratio,
         instance->config_bias);
+    // Whole frame has to be sent again
+    instance->gui->canvas->display_buffer_valid = false;
 }
 
 static void display_config_set_bias(VariableItem* item) {
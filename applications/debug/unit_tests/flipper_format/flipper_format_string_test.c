@@ -295,6 +295,47 @@ MU_TEST(flipper_format_string_test) {
     flipper_format_free(flipper_format);
 }
 
+MU_TEST(flipper_format_key_index_test) {
+    FlipperFormat* flipper_format = flipper_format_string_alloc();
+    flipper_format_set_key_index(flipper_format, true);
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+
+    mu_check(flipper_format_write_header_cstr(flipper_format, test_filetype, test_version));
+    mu_check(flipper_format_write_comment_cstr(flipper_format, "This is comment"));
+    mu_check(flipper_format_write_string_cstr(flipper_format, test_string_key, test_string_data));
+    mu_check(
+        flipper_format_write_int32(flipper_format, test_int_key, ARRAY_W_COUNT(test_int_data)));
+    mu_check(
+        flipper_format_write_uint32(flipper_format, test_uint_key, ARRAY_W_COUNT(test_uint_data)));
+    mu_check(flipper_format_write_float(
+        flipper_format, test_float_key, ARRAY_W_COUNT(test_float_data)));
+    mu_check(flipper_format_write_hex(flipper_format, test_hex_key, ARRAY_W_COUNT(test_hex_data)));
+
+    MU_RUN_TEST_1(flipper_format_read_and_update_test, flipper_format);
+
+    stream_clean(stream);
+    stream_write_cstring(stream, test_data_win);
+    MU_RUN_TEST_1(flipper_format_read_and_update_test, flipper_format);
+
+    // strict mode stops at the first key that does not match, same as without the index
+    stream_clean(stream);
+    stream_write_cstring(stream, test_data_nix);
+    stream = flipper_format_get_raw_stream(flipper_format);
+    flipper_format_set_strict_mode(flipper_format, true);
+    uint32_t version;
+    FuriString* tmpstr = furi_string_alloc();
+    mu_check(flipper_format_rewind(flipper_format));
+    mu_check(!flipper_format_read_string(flipper_format, test_string_key, tmpstr));
+    mu_assert_int_eq(strlen("Filetype"), stream_tell(stream));
+    mu_check(flipper_format_rewind(flipper_format));
+    mu_check(flipper_format_read_header(flipper_format, tmpstr, &version));
+    mu_check(flipper_format_read_string(flipper_format, test_string_key, tmpstr));
+    mu_assert_string_eq(test_string_data, furi_string_get_cstr(tmpstr));
+    furi_string_free(tmpstr);
+
+    flipper_format_free(flipper_format);
+}
+
 MU_TEST(flipper_format_file_test) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
@@ -328,6 +369,7 @@ MU_TEST(flipper_format_file_test) {
 
 MU_TEST_SUITE(flipper_format_string_suite) {
     MU_RUN_TEST(flipper_format_string_test);
+    MU_RUN_TEST(flipper_format_key_index_test);
     MU_RUN_TEST(flipper_format_file_test);
 }
 
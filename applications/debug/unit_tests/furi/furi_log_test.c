@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <string.h>
+#include <furi.h>
+#include "../minunit.h"
+
+#define FURI_LOG_TEST_TIMEOUT_MS (1000U)
+
+typedef struct {
+    FuriMutex* mutex;
+    FuriString* output;
+} FuriLogTestCapture;
+
+static void furi_log_test_callback(const uint8_t* data, size_t size, void* context) {
+    FuriLogTestCapture* capture = context;
+    furi_check(furi_mutex_acquire(capture->mutex, FuriWaitForever) == FuriStatusOk);
+    for(size_t i = 0; i < size; i++) {
+        furi_string_push_back(capture->output, data[i]);
+    }
+    furi_mutex_release(capture->mutex);
+}
+
+// Deferred records are printed by a low priority thread, wait until ours shows up
+static bool furi_log_test_wait(FuriLogTestCapture* capture, const char* expected) {
+    bool found = false;
+    uint32_t start = furi_get_tick();
+    while(!found && furi_get_tick() - start < FURI_LOG_TEST_TIMEOUT_MS) {
+        furi_delay_ms(10);
+        furi_check(furi_mutex_acquire(capture->mutex, FuriWaitForever) == FuriStatusOk);
+        found = furi_string_search_str(capture->output, expected, 0) != FURI_STRING_FAILURE;
+        furi_mutex_release(capture->mutex);
+    }
+    return found;
+}
+
+void test_furi_log_deferred(void) {
+    FuriLogTestCapture capture = {
+        .mutex = furi_mutex_alloc(FuriMutexTypeNormal),
+        .output = furi_string_alloc(),
+    };
+    FuriLogHandler handler = {.callback = furi_log_test_callback, .context = &capture};
+    FuriLogLevel level = furi_log_get_level();
+    bool deferred = furi_log_is_deferred();
+
+    furi_log_set_level(FuriLogLevelInfo);
+    furi_log_set_deferred(true);
+    bool added = furi_log_add_handler(handler);
+
+    const char* volatile null_string = NULL;
+    void* pointer = &capture;
+    FuriString* pointer_expected = furi_string_alloc_printf("<p:%p>", pointer);
+    char long_a[65], long_b[65], long_c[65];
+    memset(long_a, 'a', 64);
+    memset(long_b, 'b', 64);
+    memset(long_c, 'c', 64);
+    long_a[64] = long_b[64] = long_c[64] = '\0';
+
+    // Checked after cleanup, failed assert returns right away
+    FURI_LOG_RAW_I("<ss:%*.*s|%-4.*s|>", 5, 2, "abcdef", 3, "abcdef");
+    bool star_precision = furi_log_test_wait(&capture, "<ss:   ab|abc |>");
+    FURI_LOG_RAW_I("<ll:%lld %llu>", -1234567890123LL, 18446744073709551615ULL);
+    bool long_long = furi_log_test_wait(&capture, "<ll:-1234567890123 18446744073709551615>");
+    FURI_LOG_RAW_I("<f:%.2f %f>", 1.5, -0.25);
+    bool floating = furi_log_test_wait(&capture, "<f:1.50 -0.250000>");
+    FURI_LOG_RAW_I("<c:%c%c %%>", 'x', 'y');
+    bool character = furi_log_test_wait(&capture, "<c:xy %>");
+    FURI_LOG_RAW_I("<p:%p>", pointer);
+    bool pointer_match = furi_log_test_wait(&capture, furi_string_get_cstr(pointer_expected));
+    FURI_LOG_RAW_I("<null:%s>", null_string);
+    bool null = furi_log_test_wait(&capture, "<null:(null)>");
+    // Third string is cut by the record size, not by the string limit
+    FURI_LOG_RAW_I("<%s%s%s>", long_a, long_b, long_c);
+    bool string_overflow = furi_log_test_wait(&capture, "c>...");
+    // Format is in firmware flash and not copied, so only the second number doesn't fit
+    FURI_LOG_RAW_I("<%s%s%lld%lld>", long_a, long_b, 7LL, 8LL);
+    bool number_overflow = furi_log_test_wait(&capture, "b7...");
+
+    bool removed = furi_log_remove_handler(handler);
+    furi_log_set_deferred(deferred);
+    furi_log_set_level(level);
+    furi_string_free(pointer_expected);
+    furi_string_free(capture.output);
+    furi_mutex_free(capture.mutex);
+
+    mu_assert(added, "Handler not added");
+    mu_assert(removed, "Handler not removed");
+    mu_assert(star_precision, "%*.*s and %.*s mismatch");
+    mu_assert(long_long, "%lld and %llu mismatch");
+    mu_assert(floating, "%f mismatch");
+    mu_assert(character, "%c mismatch");
+    mu_assert(pointer_match, "%p mismatch");
+    mu_assert(null, "NULL %s mismatch");
+    mu_assert(string_overflow, "String overflow not marked");
+    mu_assert(number_overflow, "Number overflow not marked");
+}
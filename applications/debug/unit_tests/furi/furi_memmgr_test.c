@@ -290,4 +290,105 @@ void test_furi_memmgr_advanced(void) {
             free(guards[i]);
         }
     }
-}
\ No newline at end of file
+}
+
+// Small blocks live in 1 KiB pages, which are accounted as a whole
+#define TEST_SLAB_PAGE_SIZE (1024U + 64U)
+
+static void test_furi_memmgr_small_cycle(uint8_t** blocks, size_t block_count, size_t size) {
+    // more blocks than fit into one size class page
+    for(size_t j = 0; j < block_count; j++) {
+        blocks[j] = malloc(size);
+        mu_check(blocks[j] != NULL);
+        mu_assert_int_eq(0, (uintptr_t)blocks[j] % 8);
+        for(size_t k = 0; k < size; k++) {
+            mu_assert_int_eq(0, blocks[j][k]);
+        }
+        memset(blocks[j], (uint8_t)j, size);
+    }
+
+    // blocks must not overlap
+    for(size_t j = 0; j < block_count; j++) {
+        for(size_t k = 0; k < size; k++) {
+            mu_assert_int_eq((uint8_t)j, blocks[j][k]);
+        }
+    }
+
+    // grow every other block, content must be preserved
+    for(size_t j = 0; j < block_count; j += 2) {
+        blocks[j] = realloc(blocks[j], size * 3);
+        for(size_t k = 0; k < size; k++) {
+            mu_assert_int_eq((uint8_t)j, blocks[j][k]);
+        }
+    }
+
+    for(size_t j = 0; j < block_count; j++) {
+        free(blocks[j]);
+    }
+}
+
+void test_furi_memmgr_small(void) {
+    const size_t sizes[] = {1, 8, 16, 17, 33, 64, 100, 129, 200, 256, 257};
+    const size_t sizes_count = sizeof(sizes) / sizeof(sizes[0]);
+    const size_t block_count = 70;
+    uint8_t* blocks[block_count];
+
+    for(size_t i = 0; i < sizes_count; i++) {
+        const size_t size = sizes[i];
+        size_t free_heap = memmgr_get_free_heap();
+
+        test_furi_memmgr_small_cycle(blocks, block_count, size);
+
+        // pages are released, except one empty page kept by each of the two classes used
+        size_t free_heap_cycled = memmgr_get_free_heap();
+        mu_check(free_heap_cycled <= free_heap);
+        mu_check(free_heap - free_heap_cycled <= 2 * TEST_SLAB_PAGE_SIZE);
+
+        // kept pages are reused
+        test_furi_memmgr_small_cycle(blocks, block_count, size);
+        mu_assert_int_eq(free_heap_cycled, memmgr_get_free_heap());
+    }
+}
+
+void test_furi_memmgr_profiler(void) {
+    const size_t block_count = 8;
+    void* blocks[block_count];
+
+    mu_check(memmgr_heap_profiler_start(64));
+    mu_check(memmgr_heap_profiler_is_running());
+    mu_check(!memmgr_heap_profiler_start(64));
+
+    for(size_t i = 0; i < block_count; i++) {
+        blocks[i] = malloc(1000);
+    }
+
+    // all blocks come from the same call site, which must be on top
+    MemmgrHeapProfilerSite site;
+    mu_assert_int_eq(1, memmgr_heap_profiler_get_sites(&site, 1));
+    mu_assert_int_eq(block_count, site.live_count);
+    mu_assert_int_eq(block_count * 1000, site.live_size);
+
+    for(size_t i = 0; i < block_count; i++) {
+        free(blocks[i]);
+    }
+
+    MemmgrHeapProfilerStats stats;
+    memmgr_heap_profiler_get_stats(&stats);
+    mu_check(stats.size_histogram[6] >= block_count);
+
+    uint32_t released = 0;
+    for(size_t i = 0; i < MEMMGR_HEAP_PROFILER_LIFETIME_BUCKETS; i++) {
+        released += stats.lifetime_histogram[i];
+    }
+    mu_check(released >= block_count);
+
+    memmgr_heap_profiler_stop();
+    mu_check(!memmgr_heap_profiler_is_running());
+
+    MemmgrHeapFragmentation fragmentation;
+    uint8_t map[16];
+    memmgr_heap_get_fragmentation(&fragmentation, map, sizeof(map));
+    mu_check(fragmentation.free_max > 0);
+    mu_check(fragmentation.free_max <= fragmentation.free_size);
+    mu_check(fragmentation.used_count > 0);
+}
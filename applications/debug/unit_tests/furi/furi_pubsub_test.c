@@ -43,3 +43,119 @@ void test_furi_pubsub(void) {
     // delete pubsub case
     furi_pubsub_free(test_pubsub);
 }
+
+typedef struct {
+    FuriSemaphore* release;
+    uint32_t sum;
+    uint32_t count;
+} TestPubSubAsync;
+
+static void test_pubsub_async_handler(const void* arg, void* ctx) {
+    TestPubSubAsync* test = ctx;
+    // block delivery until test allows it, publisher must not be affected
+    furi_check(furi_semaphore_acquire(test->release, FuriWaitForever) == FuriStatusOk);
+    test->sum += *(const uint32_t*)arg;
+    test->count++;
+}
+
+void test_furi_pubsub_async(void) {
+    TestPubSubAsync test = {
+        .release = furi_semaphore_alloc(8, 0),
+        .sum = 0,
+        .count = 0,
+    };
+
+    FuriPubSub* test_pubsub = furi_pubsub_alloc();
+    FuriPubSubSubscription* test_pubsub_subscription = furi_pubsub_subscribe_async(
+        test_pubsub,
+        sizeof(uint32_t),
+        4,
+        FuriPubSubOverflowDrop,
+        test_pubsub_async_handler,
+        &test);
+    mu_assert_pointers_not_eq(test_pubsub_subscription, NULL);
+
+    // callback blocks on the first message which keeps its slot, so only 4 fit into the queue
+    for(uint32_t i = 1; i <= 8; i++) {
+        furi_pubsub_publish(test_pubsub, &i);
+        furi_delay_tick(1);
+    }
+    mu_assert_int_eq(0, test.count);
+
+    for(size_t i = 0; i < 8; i++) {
+        furi_semaphore_release(test.release);
+    }
+    furi_delay_ms(10);
+
+    FuriPubSubSubscriptionStats stats;
+    furi_pubsub_subscription_get_stats(test_pubsub_subscription, &stats);
+    mu_assert_int_eq(4, test.count);
+    mu_assert_int_eq(1 + 2 + 3 + 4, test.sum);
+    mu_assert_int_eq(4, stats.delivered);
+    mu_assert_int_eq(4, stats.dropped);
+    mu_assert_int_eq(0, stats.pending);
+    mu_check(stats.latency_max > 0);
+
+    furi_pubsub_unsubscribe(test_pubsub, test_pubsub_subscription);
+    furi_pubsub_free(test_pubsub);
+    furi_semaphore_free(test.release);
+}
+
+typedef struct {
+    FuriPubSub* pubsub;
+    uint32_t count;
+} TestPubSubPublisher;
+
+static int32_t test_pubsub_publisher(void* context) {
+    TestPubSubPublisher* publisher = context;
+    for(uint32_t i = 1; i <= publisher->count; i++) {
+        furi_pubsub_publish(publisher->pubsub, &i);
+    }
+    return 0;
+}
+
+void test_furi_pubsub_async_wait(void) {
+    TestPubSubAsync test = {
+        .release = furi_semaphore_alloc(8, 0),
+        .sum = 0,
+        .count = 0,
+    };
+
+    FuriPubSub* test_pubsub = furi_pubsub_alloc();
+    FuriPubSubSubscription* test_pubsub_subscription = furi_pubsub_subscribe_async(
+        test_pubsub,
+        sizeof(uint32_t),
+        1,
+        FuriPubSubOverflowWait,
+        test_pubsub_async_handler,
+        &test);
+
+    TestPubSubPublisher publisher = {.pubsub = test_pubsub, .count = 4};
+    FuriThread* thread =
+        furi_thread_alloc_ex("PubSubTestPublisher", 1024, test_pubsub_publisher, &publisher);
+    furi_thread_start(thread);
+    furi_delay_ms(10);
+
+    // publisher waits for a free slot, other subscribers are not blocked meanwhile
+    mu_assert_int_eq(0, test.count);
+    FuriPubSubSubscription* test_pubsub_subscription_sync =
+        furi_pubsub_subscribe(test_pubsub, test_pubsub_handler, (void*)&context_value);
+    furi_pubsub_unsubscribe(test_pubsub, test_pubsub_subscription_sync);
+
+    for(size_t i = 0; i < 4; i++) {
+        furi_semaphore_release(test.release);
+    }
+    furi_thread_join(thread);
+    furi_thread_free(thread);
+    furi_delay_ms(10);
+
+    FuriPubSubSubscriptionStats stats;
+    furi_pubsub_subscription_get_stats(test_pubsub_subscription, &stats);
+    mu_assert_int_eq(4, test.count);
+    mu_assert_int_eq(1 + 2 + 3 + 4, test.sum);
+    mu_assert_int_eq(0, stats.dropped);
+
+    furi_pubsub_unsubscribe(test_pubsub, test_pubsub_subscription);
+    furi_pubsub_free(test_pubsub);
+    furi_semaphore_free(test.release);
+}
@@ -7,9 +7,15 @@
 void test_furi_create_open(void);
 void test_furi_concurrent_access(void);
 void test_furi_pubsub(void);
+void test_furi_pubsub_async(void);
+void test_furi_pubsub_async_wait(void);
 
 void test_furi_memmgr(void);
 void test_furi_memmgr_advanced(void);
+void test_furi_memmgr_small(void);
+void test_furi_memmgr_profiler(void);
+
+void test_furi_log_deferred(void);
 
 static int foo = 0;
 
@@ -34,11 +40,25 @@ MU_TEST(mu_test_furi_pubsub) {
     test_furi_pubsub();
 }
 
+MU_TEST(mu_test_furi_pubsub_async) {
+    test_furi_pubsub_async();
+}
+
+MU_TEST(mu_test_furi_pubsub_async_wait) {
+    test_furi_pubsub_async_wait();
+}
+
 MU_TEST(mu_test_furi_memmgr) {
     // this test is not accurate, but gives a basic understanding
     // that memory management is working fine
     test_furi_memmgr();
     test_furi_memmgr_advanced();
+    test_furi_memmgr_small();
+    test_furi_memmgr_profiler();
+}
+
+MU_TEST(mu_test_furi_log_deferred) {
+    test_furi_log_deferred();
 }
 
 MU_TEST_SUITE(test_suite) {
@@ -49,7 +69,10 @@ MU_TEST_SUITE(test_suite) {
     // v2 tests
     MU_RUN_TEST(mu_test_furi_create_open);
     MU_RUN_TEST(mu_test_furi_pubsub);
+    MU_RUN_TEST(mu_test_furi_pubsub_async);
+    MU_RUN_TEST(mu_test_furi_pubsub_async_wait);
     MU_RUN_TEST(mu_test_furi_memmgr);
+    MU_RUN_TEST(mu_test_furi_log_deferred);
 }
 
 int run_minunit_test_furi(void) {
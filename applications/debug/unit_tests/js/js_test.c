@@ -0,0 +1,241 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include "../minunit.h"
+
+#include <mjs_core_public.h>
+#include <mjs_exec_public.h>
+#include <mjs_object_public.h>
+#include <mjs_primitive_public.h>
+#include <storage/storage.h>
+
+#define TAG "JsTest"
+
+#define JS_TEST_CALLS (2000U)
+#define JS_TEST_BCODE_SCRIPT EXT_PATH("unit_tests/js_bcode_cache.js")
+#define JS_TEST_BCODE_CACHE EXT_PATH("unit_tests/js_bcode_cache.jsc")
+
+static const char* js_test_module_names[] = {
+    "init",
+    "write",
+    "read",
+    "deinit",
+    "set_mode",
+    "set_pull",
+    "get_mode",
+    "get_pull",
+    "interrupt",
+    "pwm_start",
+    "pwm_stop",
+    "adc_read",
+};
+
+static void js_test_module_call(struct mjs* mjs) {
+    uint32_t* calls = mjs_get_context(mjs);
+    (*calls)++;
+    mjs_return(mjs, MJS_UNDEFINED);
+}
+
+// Same layout as native modules: an object of foreign functions in a global variable
+static void js_test_module_register(struct mjs* mjs, const char* name, size_t count) {
+    mjs_val_t module = mjs_mk_object(mjs);
+    for(size_t i = 0; i < count; i++) {
+        mjs_set(mjs, module, js_test_module_names[i], ~0, MJS_MK_FN(js_test_module_call));
+    }
+    mjs_set(mjs, mjs_get_global(mjs), name, ~0, module);
+}
+
+MU_TEST(test_js_object_properties) {
+    struct mjs* mjs = mjs_create(NULL);
+    mjs_val_t res = MJS_UNDEFINED;
+
+    // Enough properties to be looked up through the index
+    mu_assert_int_eq(
+        MJS_OK,
+        mjs_exec(
+            mjs,
+            "let o = {a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8, i: 9, j: 10,"
+            " long_name_1: 11, long_name_2: 12};"
+            "let get = function(x) { return x.long_name_2; };",
+            &res));
+    mu_assert_int_eq(MJS_OK, mjs_exec(mjs, "o.a + o.j + o.long_name_1", &res));
+    mu_assert_int_eq(22, mjs_get_int(mjs, res));
+
+    mu_assert_int_eq(
+        MJS_OK, mjs_exec(mjs, "o.k = 13; o.long_name_1 = 1; o.k + o.long_name_1", &res));
+    mu_assert_int_eq(14, mjs_get_int(mjs, res));
+    mu_assert_int_eq(MJS_OK, mjs_exec(mjs, "o.missing", &res));
+    mu_assert(mjs_is_undefined(res), "missing property found");
+
+    // Repeated lookups from one site, with the property changed and deleted in between
+    mu_assert_int_eq(MJS_OK, mjs_exec(mjs, "get(o) + get(o)", &res));
+    mu_assert_int_eq(24, mjs_get_int(mjs, res));
+    mu_assert_int_eq(MJS_OK, mjs_exec(mjs, "o.long_name_2 = 5; get(o)", &res));
+    mu_assert_int_eq(5, mjs_get_int(mjs, res));
+    mu_assert_int_eq(MJS_OK, mjs_exec(mjs, "get({long_name_2: 7})", &res));
+    mu_assert_int_eq(7, mjs_get_int(mjs, res));
+
+    mjs_val_t o = mjs_get(mjs, mjs_get_global(mjs), "o", ~0);
+    mu_assert_int_eq(0, mjs_del(mjs, o, "long_name_2", ~0));
+    mu_assert_int_eq(MJS_OK, mjs_exec(mjs, "get(o)", &res));
+    mu_assert(mjs_is_undefined(res), "deleted property found");
+    mu_assert_int_eq(0, mjs_del(mjs, o, "a", ~0));
+    mu_assert_int_eq(MJS_OK, mjs_exec(mjs, "o.b + o.k", &res));
+    mu_assert_int_eq(15, mjs_get_int(mjs, res));
+
+    mjs_destroy(mjs);
+}
+
+typedef struct {
+    char* data;
+    size_t len;
+} JsTestBcode;
+
+static void js_test_bcode_callback(
+    struct mjs* mjs,
+    const char* path,
+    const char* bcode,
+    size_t len,
+    void* context) {
+    UNUSED(mjs);
+    UNUSED(path);
+    JsTestBcode* saved = context;
+    free(saved->data);
+    saved->data = malloc(len);
+    memcpy(saved->data, bcode, len);
+    saved->len = len;
+}
+
+MU_TEST(test_js_bcode) {
+    JsTestBcode saved = {};
+    mjs_val_t res = MJS_UNDEFINED;
+
+    struct mjs* mjs = mjs_create(NULL);
+    mjs_set_bcode_callback(mjs, js_test_bcode_callback, &saved);
+    mu_assert_int_eq(
+        MJS_OK,
+        mjs_exec(
+            mjs, "let x = 1; let f = function(a) { return a * 2 + x; }; f(20) + f(0)", &res));
+    mu_assert_int_eq(42, mjs_get_int(mjs, res));
+    mjs_destroy(mjs);
+    mu_assert(saved.len > 0, "bcode not given");
+
+    // Same result without parsing, in a fresh instance which already ran other code,
+    // so the bytecode is placed at another offset than the one it was parsed at
+    mjs = mjs_create(NULL);
+    mu_assert_int_eq(
+        MJS_OK, mjs_exec(mjs, "let y = 2; let g = function(a) { return a - y; }; g(3)", &res));
+    mu_assert_int_eq(1, mjs_get_int(mjs, res));
+    char* bcode = malloc(saved.len);
+    memcpy(bcode, saved.data, saved.len);
+    mu_assert_int_eq(MJS_OK, mjs_exec_bcode(mjs, bcode, saved.len, &res));
+    mu_assert_int_eq(42, mjs_get_int(mjs, res));
+
+    // Functions from both parts are still callable
+    mu_assert_int_eq(MJS_OK, mjs_exec(mjs, "g(10) + f(1)", &res));
+    mu_assert_int_eq(11, mjs_get_int(mjs, res));
+
+    // Truncated bcode is refused, mjs takes the buffer anyway
+    mu_assert(
+        mjs_exec_bcode(mjs, saved.data, saved.len - 1, &res) != MJS_OK,
+        "truncated bcode executed");
+    mjs_destroy(mjs);
+}
+
+static bool js_test_bcode_cache_write(const char* source) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    bool written =
+        storage_file_open(file, JS_TEST_BCODE_SCRIPT, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+        (storage_file_write(file, source, strlen(source)) == strlen(source));
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    return written;
+}
+
+// Returns script result, -1 on error
+static int js_test_bcode_cache_run(void) {
+    struct mjs* mjs = mjs_create(NULL);
+    mjs_val_t res = MJS_UNDEFINED;
+    mjs_err_t err = mjs_exec_file_cached(mjs, JS_TEST_BCODE_SCRIPT, &res);
+    int result = (err == MJS_OK) ? mjs_get_int(mjs, res) : -1;
+    mjs_destroy(mjs);
+    return result;
+}
+
+MU_TEST(test_js_bcode_cache) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, JS_TEST_BCODE_CACHE);
+    furi_record_close(RECORD_STORAGE);
+
+    // Miss, the cache is written
+    mu_assert(
+        js_test_bcode_cache_write("let f = function(a) { return a * 2; }; f(21)"),
+        "Failed to write script");
+    mu_assert(!mjs_bcode_cache_is_fresh(JS_TEST_BCODE_SCRIPT), "Cache before first run");
+    mu_assert_int_eq(42, js_test_bcode_cache_run());
+    mu_assert(mjs_bcode_cache_is_fresh(JS_TEST_BCODE_SCRIPT), "Cache not written");
+
+    // Hit
+    mu_assert_int_eq(42, js_test_bcode_cache_run());
+    mu_assert(mjs_bcode_cache_is_fresh(JS_TEST_BCODE_SCRIPT), "Cache lost");
+
+    // Changed source is a miss, the cache is written anew
+    mu_assert(
+        js_test_bcode_cache_write("let f = function(a) { return a * 2; }; f(50)"),
+        "Failed to write script");
+    mu_assert(!mjs_bcode_cache_is_fresh(JS_TEST_BCODE_SCRIPT), "Stale cache taken");
+    mu_assert_int_eq(100, js_test_bcode_cache_run());
+    mu_assert(mjs_bcode_cache_is_fresh(JS_TEST_BCODE_SCRIPT), "Cache not rewritten");
+
+    storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, JS_TEST_BCODE_SCRIPT);
+    storage_simply_remove(storage, JS_TEST_BCODE_CACHE);
+    furi_record_close(RECORD_STORAGE);
+}
+
+// Returns number of calls made by the script
+static uint32_t js_test_module_calls_run(size_t module_size, uint32_t* ticks) {
+    uint32_t calls = 0;
+    struct mjs* mjs = mjs_create(&calls);
+    mjs_val_t res = MJS_UNDEFINED;
+
+    js_test_module_register(mjs, "gpio", module_size);
+
+    uint32_t start = DWT->CYCCNT;
+    mjs_err_t err =
+        mjs_exec(mjs, "for(let i = 0; i < 1000; i++) { gpio.write(i); gpio.read(i); }", &res);
+    *ticks = DWT->CYCCNT - start;
+
+    mjs_destroy(mjs);
+
+    return (err == MJS_OK) ? calls : 0;
+}
+
+MU_TEST(test_js_module_calls) {
+    uint32_t small_ticks, large_ticks;
+
+    mu_assert_int_eq(JS_TEST_CALLS, js_test_module_calls_run(3, &small_ticks));
+    mu_assert_int_eq(
+        JS_TEST_CALLS,
+        js_test_module_calls_run(COUNT_OF(js_test_module_names), &large_ticks));
+
+    FURI_LOG_I(
+        TAG,
+        "%u module calls: %lu us with 3 functions, %lu us with %zu functions",
+        JS_TEST_CALLS,
+        small_ticks / furi_hal_cortex_instructions_per_microsecond(),
+        large_ticks / furi_hal_cortex_instructions_per_microsecond(),
+        COUNT_OF(js_test_module_names));
+}
+
+MU_TEST_SUITE(test_js) {
+    MU_RUN_TEST(test_js_object_properties);
+    MU_RUN_TEST(test_js_module_calls);
+    MU_RUN_TEST(test_js_bcode);
+    MU_RUN_TEST(test_js_bcode_cache);
+}
+
+int run_minunit_test_js(void) {
+    MU_RUN_SUITE(test_js);
+    return MU_EXIT_CODE;
+}
@@ -14,8 +14,10 @@
 #include <nfc/protocols/mf_classic/mf_classic_poller_sync.h>
 #include <nfc/protocols/mf_classic/mf_classic_poller.h>
 #include <nfc/nfc_poller.h>
+#include <nfc/helpers/crypto1.h>
 
 #include <toolbox/keys_dict.h>
+#include <bit_lib/bit_lib.h>
 #include <nfc/nfc.h>
 
 #include "../minunit.h"
@@ -42,6 +44,15 @@ typedef struct {
     FuriThreadId thread_id;
 } NfcTestMfClassicSendFrameTest;
 
+typedef struct {
+    NfcPoller* poller;
+    const MfClassicData* data;
+    MfClassicData* result;
+    uint32_t keys_requested;
+    uint32_t sectors_timed;
+    FuriThreadId thread_id;
+} NfcTestMfClassicDictAttack;
+
 typedef struct {
     Storage* storage;
 } NfcTest;
@@ -558,6 +569,91 @@ MU_TEST(mf_classic_send_frame_test) {
     nfc_free(poller);
 }
 
+NfcCommand mf_classic_dict_attack_test_callback(NfcGenericEvent event, void* context) {
+    furi_check(event.event_data);
+    furi_check(context);
+
+    NfcCommand command = NfcCommandContinue;
+    MfClassicPollerEvent* mfc_event = event.event_data;
+    NfcTestMfClassicDictAttack* dict_attack = context;
+
+    if(mfc_event->type == MfClassicPollerEventTypeRequestMode) {
+        mfc_event->data->poller_mode.mode = MfClassicPollerModeDictAttack;
+        mfc_event->data->poller_mode.data = dict_attack->data;
+    } else if(mfc_event->type == MfClassicPollerEventTypeRequestKey) {
+        dict_attack->keys_requested++;
+        mfc_event->data->key_request_data.key_provided = false;
+    } else if(mfc_event->type == MfClassicPollerEventTypeNextSector) {
+        FURI_LOG_I(
+            TAG,
+            "Sector %d done in %lu ms",
+            mfc_event->data->next_sector_data.current_sector - 1,
+            mfc_event->data->next_sector_data.sector_time_ms);
+        dict_attack->sectors_timed++;
+    } else if(
+        (mfc_event->type == MfClassicPollerEventTypeSuccess) ||
+        (mfc_event->type == MfClassicPollerEventTypeFail)) {
+        if(mfc_event->type == MfClassicPollerEventTypeSuccess) {
+            mf_classic_copy(dict_attack->result, nfc_poller_get_data(dict_attack->poller));
+        }
+        furi_thread_flags_set(dict_attack->thread_id, NFC_TEST_FLAG_WORKER_DONE);
+        command = NfcCommandStop;
+    }
+
+    return command;
+}
+
+MU_TEST(mf_classic_dict_attack_key_reuse_test) {
+    Nfc* poller = nfc_alloc();
+    Nfc* listener = nfc_alloc();
+
+    NfcDevice* nfc_device = nfc_device_alloc();
+    nfc_data_generator_fill_data(NfcDataGeneratorTypeMfClassic4k_7b, nfc_device);
+    const MfClassicData* mfc_ref_data = nfc_device_get_data(nfc_device, NfcProtocolMfClassic);
+    NfcListener* mfc_listener = nfc_listener_alloc(listener, NfcProtocolMfClassic, mfc_ref_data);
+    nfc_listener_start(mfc_listener, NULL, NULL);
+
+    // Only key A of sector 0 is known, the dictionary is empty
+    MfClassicData* mfc_data = mf_classic_alloc();
+    mf_classic_copy(mfc_data, mfc_ref_data);
+    memset(mfc_data->block_read_mask, 0, sizeof(mfc_data->block_read_mask));
+    mfc_data->key_a_mask = 0;
+    mfc_data->key_b_mask = 0;
+    MfClassicSectorTrailer* sec_tr = mf_classic_get_sector_trailer_by_sector(mfc_data, 0);
+    mf_classic_set_key_found(
+        mfc_data,
+        0,
+        MfClassicKeyTypeA,
+        bit_lib_bytes_to_num_be(sec_tr->key_a.data, sizeof(MfClassicKey)));
+
+    NfcTestMfClassicDictAttack context = {
+        .poller = nfc_poller_alloc(poller, NfcProtocolMfClassic),
+        .data = mfc_data,
+        .result = mf_classic_alloc(),
+        .thread_id = furi_thread_get_current_id(),
+    };
+    nfc_poller_start(context.poller, mf_classic_dict_attack_test_callback, &context);
+
+    uint32_t flag =
+        furi_thread_flags_wait(NFC_TEST_FLAG_WORKER_DONE, FuriFlagWaitAny, FuriWaitForever);
+    mu_assert(flag == NFC_TEST_FLAG_WORKER_DONE, "Wrong thread flag");
+    nfc_poller_stop(context.poller);
+    nfc_poller_free(context.poller);
+
+    uint8_t sectors_total = mf_classic_get_total_sectors_num(mfc_ref_data->type);
+    mu_assert(mf_classic_is_card_read(context.result), "Card not read with predicted key");
+    mu_assert(context.keys_requested == sectors_total, "Dictionary keys requested");
+    mu_assert(context.sectors_timed == sectors_total - 1U, "Sector timing not reported");
+
+    mf_classic_free(context.result);
+    mf_classic_free(mfc_data);
+    nfc_listener_stop(mfc_listener);
+    nfc_listener_free(mfc_listener);
+    nfc_device_free(nfc_device);
+    nfc_free(listener);
+    nfc_free(poller);
+}
+
 MU_TEST(mf_classic_dict_test) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     if(storage_common_stat(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, NULL) == FSE_OK) {
@@ -627,6 +723,173 @@ MU_TEST(mf_classic_dict_test) {
         "Remove test dict failed");
 }
 
+MU_TEST(mf_classic_dict_index_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FuriString* index_path = furi_string_alloc_printf(
+        "%s%s", NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, ".idx");
+    storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH);
+    storage_simply_remove(storage, furi_string_get_cstr(index_path));
+
+    const size_t test_key_num = 40;
+    MfClassicKey* key_arr_ref = malloc(test_key_num * sizeof(MfClassicKey));
+    furi_hal_random_fill_buf((uint8_t*)key_arr_ref, test_key_num * sizeof(MfClassicKey));
+
+    KeysDict* dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    // Half of the keys without index, batch contains every key twice
+    MfClassicKey* batch = malloc(test_key_num * sizeof(MfClassicKey));
+    memcpy(batch, key_arr_ref, test_key_num / 2 * sizeof(MfClassicKey));
+    memcpy(&batch[test_key_num / 2], key_arr_ref, test_key_num / 2 * sizeof(MfClassicKey));
+    mu_assert(
+        keys_dict_add_keys(dict, (uint8_t*)batch, test_key_num, sizeof(MfClassicKey)) ==
+            test_key_num / 2,
+        "keys_dict_add_keys() without index failed");
+    mu_assert(keys_dict_enable_index(dict), "keys_dict_enable_index() failed");
+    // Second half with index, first half is already present
+    mu_assert(
+        keys_dict_add_keys(dict, (uint8_t*)key_arr_ref, test_key_num, sizeof(MfClassicKey)) ==
+            test_key_num / 2,
+        "keys_dict_add_keys() with index failed");
+    mu_assert(keys_dict_get_total_keys(dict) == test_key_num, "keys_dict_keys_total() failed");
+    keys_dict_free(dict);
+    free(batch);
+
+    mu_assert(
+        storage_common_stat(storage, furi_string_get_cstr(index_path), NULL) == FSE_OK,
+        "Index file is missing");
+
+    // Reopen, index is loaded from file
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    mu_assert(keys_dict_enable_index(dict), "keys_dict_enable_index() failed");
+
+    MfClassicKey key_dut = {};
+    size_t key_idx = 0;
+    while(keys_dict_get_next_key(dict, key_dut.data, sizeof(MfClassicKey))) {
+        mu_assert(
+            memcmp(key_arr_ref[key_idx].data, key_dut.data, sizeof(MfClassicKey)) == 0,
+            "Loaded key data mismatch");
+        key_idx++;
+    }
+    mu_assert(key_idx == test_key_num, "Loaded key count mismatch");
+
+    for(size_t i = 0; i < test_key_num; i++) {
+        mu_assert(
+            keys_dict_is_key_present(dict, key_arr_ref[i].data, sizeof(MfClassicKey)),
+            "keys_dict_is_key_present() failed");
+    }
+    mu_assert(
+        keys_dict_delete_key(dict, key_arr_ref[0].data, sizeof(MfClassicKey)),
+        "keys_dict_delete_key() failed");
+    mu_assert(
+        !keys_dict_is_key_present(dict, key_arr_ref[0].data, sizeof(MfClassicKey)),
+        "Deleted key is still in index");
+
+    keys_dict_free(dict);
+    free(key_arr_ref);
+
+    mu_assert(
+        storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
+        "Remove test dict failed");
+    mu_assert(
+        storage_simply_remove(storage, furi_string_get_cstr(index_path)),
+        "Remove test index failed");
+    furi_string_free(index_path);
+    furi_record_close(RECORD_STORAGE);
+}
+
+// Bit by bit Crypto1, reference for the table driven implementation
+static uint8_t crypto1_reference_bit(Crypto1* crypto1, uint8_t in, int is_encrypted) {
+    uint32_t odd = crypto1->odd;
+    uint32_t out = 0xf22c0 >> (odd & 0xf) & 16;
+    out |= 0x6c9c0 >> (odd >> 4 & 0xf) & 8;
+    out |= 0x3c8b0 >> (odd >> 8 & 0xf) & 4;
+    out |= 0x1e458 >> (odd >> 12 & 0xf) & 2;
+    out |= 0x0d938 >> (odd >> 16 & 0xf) & 1;
+    out = FURI_BIT(0xEC57E80A, out);
+
+    uint32_t feed = out & (!!is_encrypted);
+    feed ^= !!in;
+    feed ^= 0x29CE5C & crypto1->odd;
+    feed ^= 0x870804 & crypto1->even;
+    crypto1->even = crypto1->even << 1 | __builtin_parity(feed);
+
+    FURI_SWAP(crypto1->odd, crypto1->even);
+    return out;
+}
+
+static uint8_t crypto1_reference_byte(Crypto1* crypto1, uint8_t in, int is_encrypted) {
+    uint8_t out = 0;
+    for(uint8_t i = 0; i < 8; i++) {
+        out |= crypto1_reference_bit(crypto1, FURI_BIT(in, i), is_encrypted) << i;
+    }
+    return out;
+}
+
+static uint32_t crypto1_reference_word(Crypto1* crypto1, uint32_t in, int is_encrypted) {
+    uint32_t out = 0;
+    for(uint8_t i = 0; i < 32; i++) {
+        out |= (uint32_t)crypto1_reference_bit(crypto1, FURI_BIT(in, i ^ 24), is_encrypted)
+               << (24 ^ i);
+    }
+    return out;
+}
+
+MU_TEST(crypto1_conformance_test) {
+    const size_t test_rounds = 1000;
+    Crypto1 dut = {};
+    Crypto1 ref = {};
+
+    for(size_t i = 0; i < test_rounds; i++) {
+        uint64_t key = 0;
+        furi_hal_random_fill_buf((uint8_t*)&key, 6);
+        crypto1_init(&dut, key);
+        ref = dut;
+
+        uint32_t in = furi_hal_random_get();
+        int is_encrypted = in & 1;
+        mu_assert(
+            crypto1_word(&dut, in, is_encrypted) == crypto1_reference_word(&ref, in, is_encrypted),
+            "crypto1_word() output mismatch");
+        mu_assert(
+            crypto1_byte(&dut, in >> 8, is_encrypted) ==
+                crypto1_reference_byte(&ref, in >> 8, is_encrypted),
+            "crypto1_byte() output mismatch");
+        mu_assert(
+            crypto1_bit(&dut, in >> 16, is_encrypted) ==
+                crypto1_reference_bit(&ref, in >> 16, is_encrypted),
+            "crypto1_bit() output mismatch");
+        mu_assert(dut.odd == ref.odd && dut.even == ref.even, "Crypto1 state mismatch");
+    }
+
+    // Keystream generation, as used to decrypt every frame
+    const size_t keystream_size = 1024;
+    crypto1_init(&dut, 0xFFFFFFFFFFFF);
+    ref = dut;
+    uint32_t start = DWT->CYCCNT;
+    uint8_t dut_sum = 0;
+    for(size_t i = 0; i < keystream_size; i++) {
+        dut_sum ^= crypto1_byte(&dut, 0, 0);
+    }
+    uint32_t dut_ticks = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    uint8_t ref_sum = 0;
+    for(size_t i = 0; i < keystream_size; i++) {
+        ref_sum ^= crypto1_reference_byte(&ref, 0, 0);
+    }
+    uint32_t ref_ticks = DWT->CYCCNT - start;
+
+    mu_assert(dut_sum == ref_sum, "Crypto1 keystream mismatch");
+    mu_assert(dut.odd == ref.odd && dut.even == ref.even, "Crypto1 state mismatch");
+    FURI_LOG_I(
+        TAG,
+        "Crypto1 keystream of %zu bytes: %lu us, bit by bit %lu us",
+        keystream_size,
+        dut_ticks / furi_hal_cortex_instructions_per_microsecond(),
+        ref_ticks / furi_hal_cortex_instructions_per_microsecond());
+}
+
 MU_TEST_SUITE(nfc) {
     nfc_test_alloc();
 
@@ -666,7 +929,11 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(mf_classic_write);
     MU_RUN_TEST(mf_classic_value_block);
     MU_RUN_TEST(mf_classic_send_frame_test);
+    MU_RUN_TEST(mf_classic_dict_attack_key_reuse_test);
     MU_RUN_TEST(mf_classic_dict_test);
+    MU_RUN_TEST(mf_classic_dict_index_test);
+
+    MU_RUN_TEST(crypto1_conformance_test);
 
     nfc_test_free();
 }
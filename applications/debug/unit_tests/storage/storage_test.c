@@ -175,11 +175,101 @@ MU_TEST(storage_file_read_write_64k) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(storage_file_read_write_v) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    const char* filename = UNIT_TESTS_PATH("storage_iov.test");
+
+    char head[] = "head";
+    char body[] = "0123456789";
+    char tail[] = "tail";
+    StorageIoVec iov[] = {
+        {.buff = head, .size = strlen(head)},
+        {.buff = body, .size = strlen(body)},
+        {.buff = tail, .size = strlen(tail)},
+    };
+    const size_t total = strlen(head) + strlen(body) + strlen(tail);
+
+    mu_check(storage_file_open(file, filename, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(total, storage_file_write_v(file, iov, COUNT_OF(iov)));
+    storage_file_close(file);
+
+    memset(head, 0, strlen(head));
+    memset(body, 0, strlen(body));
+    memset(tail, 0, strlen(tail));
+
+    // Last buffer is only partially filled at the end of file
+    char extra[8] = {};
+    iov[2].buff = extra;
+    iov[2].size = sizeof(extra);
+
+    mu_check(storage_file_open(file, filename, FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(total, storage_file_read_v(file, iov, COUNT_OF(iov)));
+    mu_assert_string_eq("head", head);
+    mu_assert_string_eq("0123456789", body);
+    mu_assert_string_eq("tail", extra);
+    storage_file_close(file);
+
+    storage_simply_remove(storage, filename);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(storage_file_batch) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    StorageBatch* batch = storage_batch_alloc(storage);
+    const char* filename = UNIT_TESTS_PATH("storage_batch.test");
+
+    // Empty batch is complete right away
+    storage_batch_submit(batch);
+    mu_check(storage_batch_is_complete(batch));
+
+    mu_check(storage_file_open(file, filename, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    size_t write = storage_batch_add_write(batch, file, "0123456789", 10);
+    size_t seek = storage_batch_add_seek(batch, file, 4, true);
+    char data[8] = {};
+    size_t read = storage_batch_add_read(batch, file, data, 4);
+    FileInfo fileinfo;
+    size_t missing = storage_batch_add_stat(batch, UNIT_TESTS_PATH("no_such.test"), &fileinfo);
+    size_t stat = storage_batch_add_stat(batch, filename, &fileinfo);
+    // Seek in a file which is not open fails and stops processing
+    File* closed = storage_file_alloc(storage);
+    size_t failed = storage_batch_add_seek(batch, closed, 0, true);
+    size_t skipped = storage_batch_add_read(batch, file, data, 4);
+
+    storage_batch_submit(batch);
+    mu_check(storage_batch_wait(batch, FuriWaitForever));
+
+    mu_assert_int_eq(FSE_OK, storage_batch_get_error(batch, write));
+    mu_assert_int_eq(10, storage_batch_get_result(batch, write));
+    mu_assert_int_eq(FSE_OK, storage_batch_get_error(batch, seek));
+    mu_assert_int_eq(FSE_OK, storage_batch_get_error(batch, read));
+    mu_assert_int_eq(4, storage_batch_get_result(batch, read));
+    mu_assert_string_eq("4567", data);
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_batch_get_error(batch, missing));
+    mu_assert_int_eq(FSE_OK, storage_batch_get_error(batch, stat));
+    mu_assert_int_eq(10, fileinfo.size);
+    mu_assert_int_eq(FSE_INVALID_PARAMETER, storage_batch_get_error(batch, failed));
+    mu_assert_int_eq(FSE_NOT_READY, storage_batch_get_error(batch, skipped));
+
+    storage_batch_reset(batch);
+    storage_file_close(file);
+    storage_batch_free(batch);
+    storage_file_free(closed);
+
+    storage_simply_remove(storage, filename);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_file) {
     storage_file_open_lock_setup();
     MU_RUN_TEST(storage_file_open_close);
     MU_RUN_TEST(storage_file_open_lock);
     storage_file_open_lock_teardown();
+    MU_RUN_TEST(storage_file_read_write_v);
+    MU_RUN_TEST(storage_file_batch);
 }
 
 MU_TEST_SUITE(storage_file_64k) {
@@ -689,6 +779,60 @@ MU_TEST(test_md5_calc) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(test_md5_cache) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    const char* path = UNIT_TESTS_PATH("md5_cache.test");
+
+    // Cache stores whatever it is given, no need for a real hash
+    const uint8_t md5[MD5_HASH_SIZE] = {
+        0x00,
+        0x11,
+        0x22,
+        0x33,
+        0x44,
+        0x55,
+        0x66,
+        0x77,
+        0x88,
+        0x99,
+        0xaa,
+        0xbb,
+        0xcc,
+        0xdd,
+        0xee,
+        0xff,
+    };
+    uint8_t md5_output[MD5_HASH_SIZE];
+    uint32_t generation;
+
+    storage_simply_remove(storage, path);
+    mu_check(storage_file_create(storage, path, "0123"));
+
+    mu_check(!storage_common_md5_cache_get(storage, path, md5_output, &generation));
+    mu_check(storage_common_md5_cache_set(storage, path, md5, generation));
+    mu_check(storage_common_md5_cache_get(storage, path, md5_output, &generation));
+    mu_assert_mem_eq(md5, md5_output, MD5_HASH_SIZE);
+
+    // Same size and most likely the same modification time, only invalidation can tell
+    const uint32_t old_generation = generation;
+    mu_check(storage_file_open(file, path, FSAM_WRITE, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(4, storage_file_write(file, "3210", 4));
+    mu_check(storage_file_close(file));
+
+    mu_check(!storage_common_md5_cache_get(storage, path, md5_output, &generation));
+    mu_check(!storage_common_md5_cache_set(storage, path, md5, old_generation));
+    mu_check(storage_common_md5_cache_set(storage, path, md5, generation));
+
+    mu_check(storage_simply_remove(storage, path));
+    mu_check(storage_file_create(storage, path, "0123"));
+    mu_check(!storage_common_md5_cache_get(storage, path, md5_output, &generation));
+
+    storage_simply_remove(storage, path);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(test_data_path) {
     MU_RUN_TEST(test_storage_data_path);
     MU_RUN_TEST(test_storage_data_path_apps);
@@ -700,6 +844,7 @@ MU_TEST_SUITE(test_storage_common) {
 
 MU_TEST_SUITE(test_md5_calc_suite) {
     MU_RUN_TEST(test_md5_calc);
+    MU_RUN_TEST(test_md5_cache);
 }
 
 int run_minunit_test_storage(void) {
@@ -497,6 +497,19 @@ MU_TEST(stream_buffered_large_file_test) {
     mu_assert_int_eq(substr_len, stream_read(stream, (uint8_t*)buf, substr_len));
     mu_assert_string_eq(test_substr, buf);
 
+    // read larger than cache after a small read, tail goes past the cache
+    mu_check(stream_rewind(stream));
+    const size_t large_size = furi_string_size(input_data) - substr_start;
+    uint8_t* large_buf = malloc(large_size);
+    mu_assert_int_eq(substr_len, stream_read(stream, (uint8_t*)buf, substr_len));
+    mu_check(stream_seek(
+        stream, (int32_t)substr_start - (int32_t)substr_len, StreamOffsetFromCurrent));
+    mu_assert_int_eq(large_size, stream_read(stream, large_buf, large_size));
+    mu_check(
+        memcmp(large_buf, furi_string_get_cstr(input_data) + substr_start, large_size) == 0);
+    mu_assert_int_eq(furi_string_size(input_data), stream_tell(stream));
+    free(large_buf);
+
     // read the whole file
     mu_check(stream_rewind(stream));
     FuriString* tmp;
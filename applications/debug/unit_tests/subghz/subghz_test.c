@@ -5,7 +5,10 @@
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_keystore.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
+#include <lib/subghz/protocols/raw.h>
 #include <lib/subghz/protocols/protocol_items.h>
+#include <lib/subghz/protocols/keeloq_common.h>
+#include <lib/subghz/blocks/math.h>
 #include <flipper_format/flipper_format_i.h>
 #include <lib/subghz/devices/devices.h>
 #include <lib/subghz/devices/cc1101_configs.h>
@@ -17,6 +20,9 @@
 #define ALUTECH_AT_4N_DIR_NAME EXT_PATH("subghz/assets/alutech_at_4n")
 #define TEST_RANDOM_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
+#define TEST_RANDOM_CONVERTED_NAME EXT_PATH("unit_tests/subghz/test_random_raw_converted.sub")
+// Pre-classifier may drop the first packet of a burst while its window warms up
+#define TEST_RANDOM_PRECLASSIFIER_COUNT_MIN (TEST_RANDOM_COUNT_PARSE * 3 / 4)
 #define TEST_TIMEOUT 10000
 
 static SubGhzEnvironment* environment_handler;
@@ -214,6 +220,112 @@ MU_TEST(subghz_keystore_test) {
         "Test keystore error");
 }
 
+MU_TEST(subghz_keeloq_batch_decrypt_test) {
+    SubGhzKeyArray_t* keys_data =
+        subghz_keystore_get_data(subghz_environment_get_keystore(environment_handler));
+    size_t keys_count = SubGhzKeyArray_size(*keys_data);
+    mu_assert(keys_count > 0, "Keystore is empty");
+
+    const uint32_t hop = 0x8C6B2D51;
+    uint64_t keys[KEELOQ_BATCH_SIZE];
+    uint32_t batch_result[KEELOQ_BATCH_SIZE];
+    uint32_t single_result[KEELOQ_BATCH_SIZE];
+    uint32_t single_ticks = 0;
+    uint32_t batch_ticks = 0;
+    size_t mismatch = 0;
+
+    // Whole keystore, the same way the KeeLoq decoder walks it for every packet
+    for(size_t offset = 0; offset < keys_count; offset += KEELOQ_BATCH_SIZE) {
+        size_t count = MIN(keys_count - offset, KEELOQ_BATCH_SIZE);
+        for(size_t i = 0; i < count; i++) {
+            keys[i] = SubGhzKeyArray_cget(*keys_data, offset + i)->key;
+        }
+
+        uint32_t start = DWT->CYCCNT;
+        for(size_t i = 0; i < count; i++) {
+            single_result[i] = subghz_protocol_keeloq_common_decrypt(hop, keys[i]);
+        }
+        single_ticks += DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        subghz_protocol_keeloq_common_decrypt_batch(hop, keys, count, batch_result);
+        batch_ticks += DWT->CYCCNT - start;
+
+        for(size_t i = 0; i < count; i++) {
+            if(single_result[i] != batch_result[i]) mismatch++;
+        }
+    }
+
+    FURI_LOG_I(
+        TAG,
+        "KeeLoq decrypt of %zu keys: single %lu us, batch %lu us",
+        keys_count,
+        single_ticks / furi_hal_cortex_instructions_per_microsecond(),
+        batch_ticks / furi_hal_cortex_instructions_per_microsecond());
+    mu_assert(mismatch == 0, "KeeLoq batch decrypt mismatch");
+}
+
+MU_TEST(subghz_keystore_index_test) {
+    SubGhzKeystore* keystore = subghz_environment_get_keystore(environment_handler);
+    size_t keys_count = SubGhzKeyArray_size(*subghz_keystore_get_data(keystore));
+
+    size_t count = 0;
+    const SubGhzKey* keys = subghz_keystore_get_manufacture_keys(keystore, NULL, &count);
+    mu_assert(keys && count == keys_count, "Keystore all keys range error");
+
+    // Every manufacture range is contiguous and holds only its own keys
+    for(size_t i = 0; i < keys_count; i++) {
+        size_t manufacture_count = 0;
+        const SubGhzKey* manufacture_keys =
+            subghz_keystore_get_manufacture_keys(keystore, keys[i].name, &manufacture_count);
+        mu_assert(manufacture_keys && manufacture_count, "Keystore manufacture not found");
+        mu_assert(
+            &keys[i] >= manufacture_keys && &keys[i] < manufacture_keys + manufacture_count,
+            "Keystore key outside of manufacture range");
+        mu_assert(
+            manufacture_keys[0].name == keys[i].name &&
+                manufacture_keys[manufacture_count - 1].name == keys[i].name,
+            "Keystore manufacture range mismatch");
+    }
+
+    mu_assert(
+        subghz_keystore_get_manufacture_keys(keystore, "Not a manufacture", &count) == NULL &&
+            count == 0,
+        "Keystore unknown manufacture error");
+
+    size_t learning_type_total = 0;
+    for(uint16_t type = 0; type < UINT8_MAX; type++) {
+        const uint64_t* type_keys = NULL;
+        const SubGhzKey* const* type_codes = NULL;
+        size_t type_count =
+            subghz_keystore_get_learning_type_keys(keystore, type, &type_keys, &type_codes);
+        for(size_t i = 0; i < type_count; i++) {
+            mu_assert(
+                type_codes[i]->type == type && type_codes[i]->key == type_keys[i],
+                "Keystore learning type bucket mismatch");
+        }
+        learning_type_total += type_count;
+    }
+    mu_assert(learning_type_total == keys_count, "Keystore learning type bucket count error");
+}
+
+MU_TEST(subghz_nice_flor_s_rainbow_table_test) {
+    const uint8_t* table = subghz_environment_get_nice_flor_s_rainbow_table(environment_handler);
+    mu_assert(table, "Nice Flor-S rainbow table load error");
+    mu_assert(
+        table == subghz_environment_get_nice_flor_s_rainbow_table(environment_handler),
+        "Nice Flor-S rainbow table is not cached");
+
+    // Cached table must match byte by byte reads from the file
+    for(size_t i = 0; i < SUBGHZ_ENVIRONMENT_NICE_FLOR_S_RAINBOW_TABLE_SIZE; i++) {
+        uint8_t byte = 0;
+        mu_assert(
+            subghz_keystore_raw_get_data(NICE_FLOR_S_DIR_NAME, i, &byte, sizeof(uint8_t)),
+            "Nice Flor-S rainbow table read error");
+        mu_assert(table[i] == byte, "Nice Flor-S rainbow table mismatch");
+    }
+}
+
 typedef enum {
     SubGhzHalAsyncTxTestTypeNormal,
     SubGhzHalAsyncTxTestTypeInvalidStart,
@@ -466,6 +578,44 @@ MU_TEST(subghz_decoder_princeton_test) {
         "Test decoder " SUBGHZ_PROTOCOL_PRINCETON_NAME " error\r\n");
 }
 
+MU_TEST(subghz_decoder_result_test) {
+    mu_assert(
+        subghz_decoder_test(
+            EXT_PATH("unit_tests/subghz/Princeton_raw.sub"), SUBGHZ_PROTOCOL_PRINCETON_NAME),
+        "Test decoder " SUBGHZ_PROTOCOL_PRINCETON_NAME " error\r\n");
+
+    SubGhzProtocolDecoderResult result;
+    mu_assert(subghz_receiver_get_result(receiver_handler, 0, &result), "Missing result");
+    mu_assert_string_eq(SUBGHZ_PROTOCOL_PRINCETON_NAME, result.protocol->name);
+    mu_assert_int_eq(24, result.bits);
+    mu_assert(result.key != 0, "Empty key");
+    mu_assert(!subghz_receiver_get_result(receiver_handler, 16, &result), "Result out of ring");
+
+    // Rolling code: serial, button and counter are parsed before the rx callback runs
+    mu_assert(
+        subghz_decoder_test(
+            EXT_PATH("unit_tests/subghz/doorhan_raw.sub"), SUBGHZ_PROTOCOL_KEELOQ_NAME),
+        "Test decoder " SUBGHZ_PROTOCOL_KEELOQ_NAME " error\r\n");
+
+    mu_assert(subghz_receiver_get_result(receiver_handler, 0, &result), "Missing result");
+    mu_assert_string_eq(SUBGHZ_PROTOCOL_KEELOQ_NAME, result.protocol->name);
+    mu_assert_int_eq(64, result.bits);
+
+    uint32_t key_fix = subghz_protocol_blocks_reverse_key(result.key, result.bits) >> 32;
+    mu_assert_int_eq(key_fix & 0x0FFFFFFF, result.serial);
+    mu_assert_int_eq(key_fix >> 28, result.button);
+    mu_assert(result.counter != 0, "Counter not decrypted");
+
+    // Same values the decoder reports once formatted
+    SubGhzProtocolDecoderResult parsed;
+    subghz_protocol_decoder_base_get_result(
+        subghz_receiver_search_decoder_base_by_name(receiver_handler, SUBGHZ_PROTOCOL_KEELOQ_NAME),
+        &parsed);
+    mu_assert_int_eq(parsed.serial, result.serial);
+    mu_assert_int_eq(parsed.button, result.button);
+    mu_assert_int_eq(parsed.counter, result.counter);
+}
+
 MU_TEST(subghz_decoder_scher_khan_magic_code_test) {
     mu_assert(
         subghz_decoder_test(
@@ -830,9 +980,42 @@ MU_TEST(subghz_random_test) {
     mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
 }
 
+MU_TEST(subghz_random_raw_format_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    const SubGhzRawFileFormat formats[] = {
+        SubGhzRawFileFormatVarint,
+        SubGhzRawFileFormatHeatshrink,
+    };
+    for(size_t i = 0; i < COUNT_OF(formats); i++) {
+        mu_assert(
+            subghz_protocol_raw_convert_file(
+                storage, TEST_RANDOM_DIR_NAME, TEST_RANDOM_CONVERTED_NAME, formats[i]),
+            "Random test convert error\r\n");
+        mu_assert(
+            subghz_decode_random_test(TEST_RANDOM_CONVERTED_NAME),
+            "Random test converted file error\r\n");
+    }
+
+    storage_simply_remove(storage, TEST_RANDOM_CONVERTED_NAME);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(subghz_random_preclassifier_test) {
+    subghz_receiver_set_preclassifier(receiver_handler, true);
+    subghz_decode_random_test(TEST_RANDOM_DIR_NAME);
+    subghz_receiver_set_preclassifier(receiver_handler, false);
+    mu_assert(
+        subghz_test_decoder_count >= TEST_RANDOM_PRECLASSIFIER_COUNT_MIN,
+        "Random test with preclassifier error\r\n");
+}
+
 MU_TEST_SUITE(subghz) {
     subghz_test_init();
     MU_RUN_TEST(subghz_keystore_test);
+    MU_RUN_TEST(subghz_keeloq_batch_decrypt_test);
+    MU_RUN_TEST(subghz_keystore_index_test);
+    MU_RUN_TEST(subghz_nice_flor_s_rainbow_table_test);
 
     MU_RUN_TEST(subghz_hal_async_tx_test);
 
@@ -850,6 +1033,7 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_decoder_nice_flo_test);
     MU_RUN_TEST(subghz_decoder_nice_flor_s_test);
     MU_RUN_TEST(subghz_decoder_princeton_test);
+    MU_RUN_TEST(subghz_decoder_result_test);
     MU_RUN_TEST(subghz_decoder_scher_khan_magic_code_test);
     MU_RUN_TEST(subghz_decoder_somfy_keytis_test);
     MU_RUN_TEST(subghz_decoder_somfy_telis_test);
@@ -907,6 +1091,8 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_decoder_acurite_592txr_test);
 
     MU_RUN_TEST(subghz_random_test);
+    MU_RUN_TEST(subghz_random_raw_format_test);
+    MU_RUN_TEST(subghz_random_preclassifier_test);
     subghz_test_deinit();
 }
 
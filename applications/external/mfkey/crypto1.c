@@ -3,7 +3,6 @@
 
 #include <inttypes.h>
 #include "crypto1.h"
-#include "mfkey.h"
 
 #define BIT(x, n) ((x) >> (n) & 1)
 
@@ -2,8 +2,7 @@
 #define CRYPTO1_H
 
 #include <inttypes.h>
-#include "mfkey.h"
-#include <nfc/protocols/mf_classic/mf_classic.h>
+#include "mfkey_recovery.h"
 
 #define LF_POLY_ODD (0x29CE5C)
 #define LF_POLY_EVEN (0x870804)
@@ -21,6 +20,8 @@ static inline uint32_t crypt_word(struct Crypto1State* s);
 static inline void crypt_word_noret(struct Crypto1State* s, uint32_t in, int x);
 static inline uint32_t crypt_word_ret(struct Crypto1State* s, uint32_t in, int x);
 static inline void rollback_word_noret(struct Crypto1State* s, uint32_t in, int x);
+static inline void crypto1_state_from_key(struct Crypto1State* s, uint64_t key);
+static inline bool crypto1_state_matches_nonce(struct Crypto1State* s, const MfClassicNonce* n);
 
 static const uint8_t lookup1[256] = {
     0, 0,  16, 16, 0,  16, 0,  0,  0, 16, 0,  0,  16, 16, 16, 16, 0, 0,  16, 16, 0,  16, 0,  0,
@@ -147,6 +148,26 @@ static inline void rollback_word_noret(struct Crypto1State* s, uint32_t in, int
     return;
 }
 
+static inline void crypto1_state_from_key(struct Crypto1State* s, uint64_t key) {
+    s->odd = 0;
+    s->even = 0;
+    for(int i = 0; i < 24; i++) {
+        s->odd |= (BIT(key, 2 * i + 1) << (i ^ 3));
+        s->even |= (BIT(key, 2 * i) << (i ^ 3));
+    }
+}
+
+static inline bool crypto1_state_matches_nonce(struct Crypto1State* s, const MfClassicNonce* n) {
+    if(n->attack == mfkey32) {
+        crypt_word_noret(s, n->uid_xor_nt1, 0);
+        crypt_word_noret(s, n->nr1_enc, 1);
+        return n->ar1_enc == (crypt_word(s) ^ n->p64b);
+    } else if(n->attack == static_nested) {
+        return n->ks1_1_enc == crypt_word_ret(s, n->uid_xor_nt0, 0);
+    }
+    return false;
+}
+
 static inline uint32_t prng_successor(uint32_t x, uint32_t n) {
     SWAPENDIAN(x);
     while(n--) x = x >> 1 | (x >> 16 ^ x >> 18 ^ x >> 19 ^ x >> 21) << 31;
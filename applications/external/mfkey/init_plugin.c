@@ -18,16 +18,61 @@
 #define MAX_NAME_LEN 32
 #define MAX_PATH_LEN 64
 
-#define LF_POLY_ODD (0x29CE5C)
-#define LF_POLY_EVEN (0x870804)
-#define CONST_M1_1 (LF_POLY_EVEN << 1 | 1)
-#define CONST_M2_1 (LF_POLY_ODD << 1)
-#define CONST_M1_2 (LF_POLY_ODD)
-#define CONST_M2_2 (LF_POLY_EVEN << 1 | 1)
-#define BIT(x, n) ((x) >> (n) & 1)
-#define BEBIT(x, n) BIT(x, (n) ^ 24)
-#define SWAPENDIAN(x) \
-    ((x) = ((x) >> 8 & 0xff00ff) | ((x) & 0xff00ff) << 8, (x) = (x) >> 16 | (x) << 16)
+// Heap left free after the dictionary states are cached
+#define DICT_STATES_HEAP_RESERVE (8 * 1024)
+
+// Dictionaries are checked against every loaded nonce, so the Crypto1 states of their keys are
+// computed once and kept in RAM. Keys are streamed from the SD card when memory is short.
+typedef struct {
+    KeysDict* system_dict;
+    bool system_dict_exists;
+    KeysDict* user_dict;
+    struct Crypto1State* states;
+    size_t states_count;
+} DictCache;
+
+static void dict_cache_add_dict_states(DictCache* cache, KeysDict* dict) {
+    uint8_t key_bytes[sizeof(MfClassicKey)];
+    keys_dict_rewind(dict);
+    while(keys_dict_get_next_key(dict, key_bytes, sizeof(MfClassicKey))) {
+        uint64_t k = bit_lib_bytes_to_num_be(key_bytes, sizeof(MfClassicKey));
+        crypto1_state_from_key(&cache->states[cache->states_count++], k);
+    }
+}
+
+static void dict_cache_init(
+    DictCache* cache,
+    KeysDict* system_dict,
+    bool system_dict_exists,
+    KeysDict* user_dict) {
+    cache->system_dict = system_dict;
+    cache->system_dict_exists = system_dict_exists;
+    cache->user_dict = user_dict;
+    cache->states = NULL;
+    cache->states_count = 0;
+
+    size_t total_keys = keys_dict_get_total_keys(user_dict);
+    if(system_dict_exists) {
+        total_keys += keys_dict_get_total_keys(system_dict);
+    }
+    size_t states_size = total_keys * sizeof(struct Crypto1State);
+    if((total_keys == 0) ||
+       (memmgr_heap_get_max_free_block() < states_size + DICT_STATES_HEAP_RESERVE)) {
+        return;
+    }
+
+    cache->states = malloc(states_size);
+    if(system_dict_exists) {
+        dict_cache_add_dict_states(cache, system_dict);
+    }
+    dict_cache_add_dict_states(cache, user_dict);
+}
+
+static void dict_cache_deinit(DictCache* cache) {
+    free(cache->states);
+    cache->states = NULL;
+    cache->states_count = 0;
+}
 
 bool key_already_found_for_nonce_in_dict(KeysDict* dict, MfClassicNonce* nonce) {
     bool found = false;
@@ -35,29 +80,33 @@ bool key_already_found_for_nonce_in_dict(KeysDict* dict, MfClassicNonce* nonce)
     keys_dict_rewind(dict);
     while(keys_dict_get_next_key(dict, key_bytes, sizeof(MfClassicKey))) {
         uint64_t k = bit_lib_bytes_to_num_be(key_bytes, sizeof(MfClassicKey));
-        struct Crypto1State temp = {0, 0};
-        for(int i = 0; i < 24; i++) {
-            (&temp)->odd |= (BIT(k, 2 * i + 1) << (i ^ 3));
-            (&temp)->even |= (BIT(k, 2 * i) << (i ^ 3));
-        }
-        if(nonce->attack == mfkey32) {
-            crypt_word_noret(&temp, nonce->uid_xor_nt1, 0);
-            crypt_word_noret(&temp, nonce->nr1_enc, 1);
-            if(nonce->ar1_enc == (crypt_word(&temp) ^ nonce->p64b)) {
-                found = true;
-                break;
-            }
-        } else if(nonce->attack == static_nested) {
-            uint32_t expected_ks1 = crypt_word_ret(&temp, nonce->uid_xor_nt0, 0);
-            if(nonce->ks1_1_enc == expected_ks1) {
-                found = true;
-                break;
-            }
+        struct Crypto1State temp;
+        crypto1_state_from_key(&temp, k);
+        if(crypto1_state_matches_nonce(&temp, nonce)) {
+            found = true;
+            break;
         }
     }
     return found;
 }
 
+static bool key_already_found_for_nonce_in_dict_cache(DictCache* cache, MfClassicNonce* nonce) {
+    if(!cache->states) {
+        return (cache->system_dict_exists &&
+                key_already_found_for_nonce_in_dict(cache->system_dict, nonce)) ||
+               key_already_found_for_nonce_in_dict(cache->user_dict, nonce);
+    }
+
+    for(size_t i = 0; i < cache->states_count; i++) {
+        // Matching advances the state, work on a copy
+        struct Crypto1State temp = cache->states[i];
+        if(crypto1_state_matches_nonce(&temp, nonce)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool napi_mf_classic_mfkey32_nonces_check_presence() {
     Storage* storage = furi_record_open(RECORD_STORAGE);
 
@@ -141,9 +190,7 @@ int binaryStringToInt(const char* binStr) {
 bool load_mfkey32_nonces(
     MfClassicNonceArray* nonce_array,
     ProgramState* program_state,
-    KeysDict* system_dict,
-    bool system_dict_exists,
-    KeysDict* user_dict) {
+    DictCache* dict_cache) {
     bool array_loaded = false;
 
     do {
@@ -230,8 +277,7 @@ bool load_mfkey32_nonces(
             res.uid_xor_nt1 = res.uid ^ res.nt1;
 
             (program_state->total)++;
-            if((system_dict_exists && key_already_found_for_nonce_in_dict(system_dict, &res)) ||
-               (key_already_found_for_nonce_in_dict(user_dict, &res))) {
+            if(key_already_found_for_nonce_in_dict_cache(dict_cache, &res)) {
                 (program_state->cracked)++;
                 (program_state->num_completed)++;
                 continue;
@@ -259,9 +305,7 @@ bool load_mfkey32_nonces(
 bool load_nested_nonces(
     MfClassicNonceArray* nonce_array,
     ProgramState* program_state,
-    KeysDict* system_dict,
-    bool system_dict_exists,
-    KeysDict* user_dict) {
+    DictCache* dict_cache) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     File* dir = storage_file_alloc(storage);
     char filename_buffer[MAX_NAME_LEN];
@@ -317,9 +361,7 @@ bool load_nested_nonces(
                     res.uid_xor_nt1 = res.uid ^ res.nt1;
 
                     (program_state->total)++;
-                    if((system_dict_exists &&
-                        key_already_found_for_nonce_in_dict(system_dict, &res)) ||
-                       (key_already_found_for_nonce_in_dict(user_dict, &res))) {
+                    if(key_already_found_for_nonce_in_dict_cache(dict_cache, &res)) {
                         (program_state->cracked)++;
                         (program_state->num_completed)++;
                         continue;
@@ -360,17 +402,19 @@ MfClassicNonceArray* napi_mf_classic_nonce_array_alloc(
     furi_record_close(RECORD_STORAGE);
 
     bool array_loaded = false;
+    DictCache dict_cache;
+    dict_cache_init(&dict_cache, system_dict, system_dict_exists, user_dict);
 
     if(program_state->mfkey32_present) {
-        array_loaded = load_mfkey32_nonces(
-            nonce_array, program_state, system_dict, system_dict_exists, user_dict);
+        array_loaded = load_mfkey32_nonces(nonce_array, program_state, &dict_cache);
     }
 
     if(program_state->nested_present) {
-        array_loaded |= load_nested_nonces(
-            nonce_array, program_state, system_dict, system_dict_exists, user_dict);
+        array_loaded |= load_nested_nonces(nonce_array, program_state, &dict_cache);
     }
 
+    dict_cache_deinit(&dict_cache);
+
     if(!array_loaded) {
         free(nonce_array);
         nonce_array = NULL;
@@ -8,14 +8,7 @@
 #include <toolbox/keys_dict.h>
 #include <toolbox/stream/buffered_file_stream.h>
 #include <nfc/protocols/mf_classic/mf_classic.h>
-
-struct Crypto1State {
-    uint32_t odd, even;
-};
-struct Msb {
-    int tail;
-    uint32_t states[768];
-};
+#include "mfkey_recovery.h"
 
 typedef enum {
     EventTypeTick,
@@ -64,38 +57,6 @@ typedef struct {
     FuriThread* mfkeythread;
 } ProgramState;
 
-typedef enum { mfkey32, static_nested } AttackType;
-
-typedef struct {
-    AttackType attack;
-    MfClassicKey key; // key
-    uint32_t uid; // serial number
-    uint32_t nt0; // tag challenge first
-    uint32_t nt1; // tag challenge second
-    uint32_t uid_xor_nt0; // uid ^ nt0
-    uint32_t uid_xor_nt1; // uid ^ nt1
-    union {
-        // Mfkey32
-        struct {
-            uint32_t p64; // 64th successor of nt0
-            uint32_t p64b; // 64th successor of nt1
-            uint32_t nr0_enc; // first encrypted reader challenge
-            uint32_t ar0_enc; // first encrypted reader response
-            uint32_t nr1_enc; // second encrypted reader challenge
-            uint32_t ar1_enc; // second encrypted reader response
-        };
-        // Nested
-        struct {
-            uint32_t ks1_1_enc; // first encrypted keystream
-            uint32_t ks1_2_enc; // second encrypted keystream
-            char par_1_str[5]; // first parity bits (string representation)
-            char par_2_str[5]; // second parity bits (string representation)
-            uint8_t par_1; // first parity bits
-            uint8_t par_2; // second parity bits
-        };
-    };
-} MfClassicNonce;
-
 typedef struct {
     Stream* stream;
     uint32_t total_nonces;
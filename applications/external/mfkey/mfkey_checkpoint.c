@@ -0,0 +1,194 @@
+#include "mfkey_checkpoint.h"
+
+#include <furi.h>
+#include <storage/storage.h>
+#include <m-array.h>
+
+#define TAG "MFKey"
+
+#define MFKEY_CHECKPOINT_PATH APP_DATA_PATH("mfkey.checkpoint")
+#define MFKEY_CHECKPOINT_MAGIC (0x504B434DU) // "MCKP"
+#define MFKEY_CHECKPOINT_VERSION (1U)
+
+ARRAY_DEF(MfkeyNonceHashArray, uint32_t, M_POD_OPLIST);
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t nonce_hash;
+    uint32_t msb;
+    uint32_t failed_count;
+} FURI_PACKED MfkeyCheckpointHeader;
+
+struct MfkeyCheckpoint {
+    Storage* storage;
+    uint32_t nonce_hash;
+    uint32_t msb;
+    MfkeyNonceHashArray_t failed;
+};
+
+MfkeyCheckpoint* mfkey_checkpoint_alloc(void) {
+    MfkeyCheckpoint* instance = malloc(sizeof(MfkeyCheckpoint));
+    instance->storage = furi_record_open(RECORD_STORAGE);
+    instance->nonce_hash = 0;
+    instance->msb = 0;
+    MfkeyNonceHashArray_init(instance->failed);
+
+    return instance;
+}
+
+void mfkey_checkpoint_free(MfkeyCheckpoint* instance) {
+    furi_assert(instance);
+
+    MfkeyNonceHashArray_clear(instance->failed);
+    furi_record_close(RECORD_STORAGE);
+    free(instance);
+}
+
+bool mfkey_checkpoint_load(MfkeyCheckpoint* instance) {
+    furi_assert(instance);
+
+    bool loaded = false;
+    File* file = storage_file_alloc(instance->storage);
+    MfkeyNonceHashArray_reset(instance->failed);
+
+    do {
+        if(!storage_file_open(file, MFKEY_CHECKPOINT_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+
+        MfkeyCheckpointHeader header = {};
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != MFKEY_CHECKPOINT_MAGIC) break;
+        if(header.version != MFKEY_CHECKPOINT_VERSION) break;
+        if(header.msb > MFKEY_MSB_COUNT) break;
+
+        size_t failed_size = header.failed_count * sizeof(uint32_t);
+        if(storage_file_size(file) != sizeof(header) + failed_size) break;
+
+        MfkeyNonceHashArray_resize(instance->failed, header.failed_count);
+        if(failed_size) {
+            uint32_t* failed = MfkeyNonceHashArray_ref(instance->failed, 0);
+            if(storage_file_read(file, failed, failed_size) != failed_size) break;
+        }
+
+        instance->nonce_hash = header.nonce_hash;
+        instance->msb = header.msb;
+        loaded = true;
+    } while(false);
+
+    if(!loaded) {
+        MfkeyNonceHashArray_reset(instance->failed);
+        instance->nonce_hash = 0;
+        instance->msb = 0;
+    }
+
+    storage_file_close(file);
+    storage_file_free(file);
+
+    return loaded;
+}
+
+bool mfkey_checkpoint_save(MfkeyCheckpoint* instance) {
+    furi_assert(instance);
+
+    bool saved = false;
+    File* file = storage_file_alloc(instance->storage);
+
+    do {
+        if(!storage_file_open(file, MFKEY_CHECKPOINT_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+
+        MfkeyCheckpointHeader header = {
+            .magic = MFKEY_CHECKPOINT_MAGIC,
+            .version = MFKEY_CHECKPOINT_VERSION,
+            .nonce_hash = instance->nonce_hash,
+            .msb = instance->msb,
+            .failed_count = MfkeyNonceHashArray_size(instance->failed),
+        };
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        size_t failed_size = header.failed_count * sizeof(uint32_t);
+        if(failed_size) {
+            const uint32_t* failed = MfkeyNonceHashArray_cref(instance->failed, 0);
+            if(storage_file_write(file, failed, failed_size) != failed_size) break;
+        }
+
+        saved = true;
+    } while(false);
+
+    if(!saved) {
+        FURI_LOG_W(TAG, "Failed to save checkpoint");
+    }
+
+    storage_file_close(file);
+    storage_file_free(file);
+
+    return saved;
+}
+
+void mfkey_checkpoint_remove(MfkeyCheckpoint* instance) {
+    furi_assert(instance);
+
+    storage_simply_remove(instance->storage, MFKEY_CHECKPOINT_PATH);
+    MfkeyNonceHashArray_reset(instance->failed);
+    instance->nonce_hash = 0;
+    instance->msb = 0;
+}
+
+uint32_t mfkey_checkpoint_get_nonce_hash(const MfClassicNonce* nonce) {
+    // FNV-1a over the fields which identify the nonce, the rest is derived from them
+    uint32_t words[] = {
+        nonce->attack,
+        nonce->uid,
+        nonce->nt0,
+        nonce->nt1,
+        (nonce->attack == mfkey32) ? nonce->nr0_enc : nonce->ks1_1_enc,
+        (nonce->attack == mfkey32) ? nonce->ar0_enc : nonce->ks1_2_enc,
+        (nonce->attack == mfkey32) ? nonce->nr1_enc : 0,
+        (nonce->attack == mfkey32) ? nonce->ar1_enc : 0,
+    };
+
+    uint32_t hash = 0x811C9DC5U;
+    const uint8_t* data = (const uint8_t*)words;
+    for(size_t i = 0; i < sizeof(words); i++) {
+        hash ^= data[i];
+        hash *= 0x01000193U;
+    }
+
+    return hash;
+}
+
+bool mfkey_checkpoint_is_nonce_failed(MfkeyCheckpoint* instance, uint32_t nonce_hash) {
+    furi_assert(instance);
+
+    bool failed = false;
+    for
+        M_EACH(hash, instance->failed, MfkeyNonceHashArray_t) {
+            if(*hash == nonce_hash) {
+                failed = true;
+                break;
+            }
+        }
+
+    return failed;
+}
+
+void mfkey_checkpoint_add_failed_nonce(MfkeyCheckpoint* instance, uint32_t nonce_hash) {
+    furi_assert(instance);
+
+    MfkeyNonceHashArray_push_back(instance->failed, nonce_hash);
+    instance->nonce_hash = 0;
+    instance->msb = 0;
+}
+
+uint32_t mfkey_checkpoint_get_msb(MfkeyCheckpoint* instance, uint32_t nonce_hash) {
+    furi_assert(instance);
+
+    return (instance->nonce_hash == nonce_hash) ? instance->msb : 0;
+}
+
+void mfkey_checkpoint_set_msb(MfkeyCheckpoint* instance, uint32_t nonce_hash, uint32_t msb) {
+    furi_assert(instance);
+
+    instance->nonce_hash = nonce_hash;
+    instance->msb = msb;
+}
@@ -0,0 +1,80 @@
+#ifndef MFKEY_CHECKPOINT_H
+#define MFKEY_CHECKPOINT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "mfkey_recovery.h"
+
+// Recovery progress which survives closing the app. Nonces solved before the checkpoint was
+// saved are already in the user dictionary and are dropped at load, so the checkpoint only
+// tracks the nonce in progress and the nonces for which no key was found.
+typedef struct MfkeyCheckpoint MfkeyCheckpoint;
+
+MfkeyCheckpoint* mfkey_checkpoint_alloc(void);
+
+void mfkey_checkpoint_free(MfkeyCheckpoint* instance);
+
+/** Load checkpoint file
+ *
+ * @param      instance  checkpoint instance
+ *
+ * @return     true if a valid checkpoint was loaded
+ */
+bool mfkey_checkpoint_load(MfkeyCheckpoint* instance);
+
+/** Write checkpoint file
+ *
+ * @param      instance  checkpoint instance
+ *
+ * @return     true on success
+ */
+bool mfkey_checkpoint_save(MfkeyCheckpoint* instance);
+
+/** Remove checkpoint file and reset progress
+ *
+ * @param      instance  checkpoint instance
+ */
+void mfkey_checkpoint_remove(MfkeyCheckpoint* instance);
+
+/** Nonce identifier used in the checkpoint
+ *
+ * @param      nonce  nonce
+ *
+ * @return     nonce hash
+ */
+uint32_t mfkey_checkpoint_get_nonce_hash(const MfClassicNonce* nonce);
+
+/** Check if recovery already ran to the end for the nonce without finding a key
+ *
+ * @param      instance    checkpoint instance
+ * @param      nonce_hash  nonce hash
+ *
+ * @return     true if nonce can be skipped
+ */
+bool mfkey_checkpoint_is_nonce_failed(MfkeyCheckpoint* instance, uint32_t nonce_hash);
+
+/** Record that no key was found for the nonce
+ *
+ * @param      instance    checkpoint instance
+ * @param      nonce_hash  nonce hash
+ */
+void mfkey_checkpoint_add_failed_nonce(MfkeyCheckpoint* instance, uint32_t nonce_hash);
+
+/** Get first MSB value not searched yet for the nonce
+ *
+ * @param      instance    checkpoint instance
+ * @param      nonce_hash  nonce hash
+ *
+ * @return     MSB value to resume from, 0 if the nonce is not in progress
+ */
+uint32_t mfkey_checkpoint_get_msb(MfkeyCheckpoint* instance, uint32_t nonce_hash);
+
+/** Set nonce in progress and first MSB value not searched yet
+ *
+ * @param      instance    checkpoint instance
+ * @param      nonce_hash  nonce hash
+ * @param      msb         MSB value to resume from
+ */
+void mfkey_checkpoint_set_msb(MfkeyCheckpoint* instance, uint32_t nonce_hash, uint32_t msb);
+
+#endif // MFKEY_CHECKPOINT_H
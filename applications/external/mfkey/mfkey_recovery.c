@@ -0,0 +1,501 @@
+#pragma GCC optimize("O3")
+#pragma GCC optimize("-funroll-all-loops")
+
+#include "mfkey_recovery.h"
+#include "crypto1.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef MFKEY_HOST
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#endif
+
+#define CONST_M1_1 (LF_POLY_EVEN << 1 | 1)
+#define CONST_M2_1 (LF_POLY_ODD << 1)
+#define CONST_M1_2 (LF_POLY_ODD)
+#define CONST_M2_2 (LF_POLY_EVEN << 1 | 1)
+
+static int check_state(struct Crypto1State* t, MfClassicNonce* n) {
+    if(!(t->odd | t->even)) return 0;
+    if(n->attack == mfkey32) {
+        rollback_word_noret(t, 0, 0);
+        rollback_word_noret(t, n->nr0_enc, 1);
+        rollback_word_noret(t, n->uid_xor_nt0, 0);
+        struct Crypto1State temp = {t->odd, t->even};
+        crypt_word_noret(t, n->uid_xor_nt1, 0);
+        crypt_word_noret(t, n->nr1_enc, 1);
+        if(n->ar1_enc == (crypt_word(t) ^ n->p64b)) {
+            crypto1_get_lfsr(&temp, &(n->key));
+            return 1;
+        }
+        return 0;
+    } else if(n->attack == static_nested) {
+        struct Crypto1State temp = {t->odd, t->even};
+        rollback_word_noret(t, n->uid_xor_nt1, 0);
+        if(n->ks1_1_enc == crypt_word_ret(t, n->uid_xor_nt0, 0)) {
+            rollback_word_noret(&temp, n->uid_xor_nt1, 0);
+            crypto1_get_lfsr(&temp, &(n->key));
+            return 1;
+        }
+        return 0;
+    }
+    return 0;
+}
+
+static inline int state_loop(
+    unsigned int* states_buffer,
+    int xks,
+    int m1,
+    int m2,
+    unsigned int in,
+    uint8_t and_val) {
+    int states_tail = 0;
+    int round = 0, s = 0, xks_bit = 0, round_in = 0;
+
+    for(round = 1; round <= 12; round++) {
+        xks_bit = BIT(xks, round);
+        if(round > 4) {
+            round_in = ((in >> (2 * (round - 4))) & and_val) << 24;
+        }
+
+        for(s = 0; s <= states_tail; s++) {
+            states_buffer[s] <<= 1;
+
+            if((filter(states_buffer[s]) ^ filter(states_buffer[s] | 1)) != 0) {
+                states_buffer[s] |= filter(states_buffer[s]) ^ xks_bit;
+                if(round > 4) {
+                    update_contribution(states_buffer, s, m1, m2);
+                    states_buffer[s] ^= round_in;
+                }
+            } else if(filter(states_buffer[s]) == xks_bit) {
+                // TODO: Refactor
+                if(round > 4) {
+                    states_buffer[++states_tail] = states_buffer[s + 1];
+                    states_buffer[s + 1] = states_buffer[s] | 1;
+                    update_contribution(states_buffer, s, m1, m2);
+                    states_buffer[s++] ^= round_in;
+                    update_contribution(states_buffer, s, m1, m2);
+                    states_buffer[s] ^= round_in;
+                } else {
+                    states_buffer[++states_tail] = states_buffer[++s];
+                    states_buffer[s] = states_buffer[s - 1] | 1;
+                }
+            } else {
+                states_buffer[s--] = states_buffer[states_tail--];
+            }
+        }
+    }
+
+    return states_tail;
+}
+
+static int binsearch(unsigned int data[], int start, int stop) {
+    int mid, val = data[stop] & 0xff000000;
+    while(start != stop) {
+        mid = (stop - start) >> 1;
+        if((data[start + mid] ^ 0x80000000) > (val ^ 0x80000000))
+            stop = start + mid;
+        else
+            start += mid + 1;
+    }
+    return start;
+}
+static void quicksort(unsigned int array[], int low, int high) {
+    //if (SIZEOF(array) == 0)
+    //    return;
+    if(low >= high) return;
+    int middle = low + (high - low) / 2;
+    unsigned int pivot = array[middle];
+    int i = low, j = high;
+    while(i <= j) {
+        while(array[i] < pivot) {
+            i++;
+        }
+        while(array[j] > pivot) {
+            j--;
+        }
+        if(i <= j) { // swap
+            int temp = array[i];
+            array[i] = array[j];
+            array[j] = temp;
+            i++;
+            j--;
+        }
+    }
+    if(low < j) {
+        quicksort(array, low, j);
+    }
+    if(high > i) {
+        quicksort(array, i, high);
+    }
+}
+static int extend_table(unsigned int data[], int tbl, int end, int bit, int m1, int m2, unsigned int in) {
+    in <<= 24;
+    for(data[tbl] <<= 1; tbl <= end; data[++tbl] <<= 1) {
+        if((filter(data[tbl]) ^ filter(data[tbl] | 1)) != 0) {
+            data[tbl] |= filter(data[tbl]) ^ bit;
+            update_contribution(data, tbl, m1, m2);
+            data[tbl] ^= in;
+        } else if(filter(data[tbl]) == bit) {
+            data[++end] = data[tbl + 1];
+            data[tbl + 1] = data[tbl] | 1;
+            update_contribution(data, tbl, m1, m2);
+            data[tbl++] ^= in;
+            update_contribution(data, tbl, m1, m2);
+            data[tbl] ^= in;
+        } else {
+            data[tbl--] = data[end--];
+        }
+    }
+    return end;
+}
+
+static int old_recover(
+    unsigned int odd[],
+    int o_head,
+    int o_tail,
+    int oks,
+    unsigned int even[],
+    int e_head,
+    int e_tail,
+    int eks,
+    int rem,
+    int s,
+    MfClassicNonce* n,
+    unsigned int in,
+    int first_run) {
+    int o, e, i;
+    if(rem == -1) {
+        for(e = e_head; e <= e_tail; ++e) {
+            even[e] = (even[e] << 1) ^ evenparity32(even[e] & LF_POLY_EVEN) ^ (!!(in & 4));
+            for(o = o_head; o <= o_tail; ++o, ++s) {
+                struct Crypto1State temp = {0, 0};
+                temp.even = odd[o];
+                temp.odd = even[e] ^ evenparity32(odd[o] & LF_POLY_ODD);
+                if(check_state(&temp, n)) {
+                    return -1;
+                }
+            }
+        }
+        return s;
+    }
+    if(first_run == 0) {
+        for(i = 0; (i < 4) && (rem-- != 0); i++) {
+            oks >>= 1;
+            eks >>= 1;
+            in >>= 2;
+            o_tail = extend_table(
+                odd, o_head, o_tail, oks & 1, LF_POLY_EVEN << 1 | 1, LF_POLY_ODD << 1, 0);
+            if(o_head > o_tail) return s;
+            e_tail = extend_table(
+                even, e_head, e_tail, eks & 1, LF_POLY_ODD, LF_POLY_EVEN << 1 | 1, in & 3);
+            if(e_head > e_tail) return s;
+        }
+    }
+    first_run = 0;
+    quicksort(odd, o_head, o_tail);
+    quicksort(even, e_head, e_tail);
+    while(o_tail >= o_head && e_tail >= e_head) {
+        if(((odd[o_tail] ^ even[e_tail]) >> 24) == 0) {
+            o_tail = binsearch(odd, o_head, o = o_tail);
+            e_tail = binsearch(even, e_head, e = e_tail);
+            s = old_recover(
+                odd, o_tail--, o, oks, even, e_tail--, e, eks, rem, s, n, in, first_run);
+            if(s == -1) {
+                break;
+            }
+        } else if((odd[o_tail] ^ 0x80000000) > (even[e_tail] ^ 0x80000000)) {
+            o_tail = binsearch(odd, o_head, o_tail) - 1;
+        } else {
+            e_tail = binsearch(even, e_head, e_tail) - 1;
+        }
+    }
+    return s;
+}
+
+static int calculate_msb_tables(
+    int oks,
+    int eks,
+    int msb_round,
+    int msb_limit,
+    MfClassicNonce* n,
+    unsigned int* states_buffer,
+    struct Msb* odd_msbs,
+    struct Msb* even_msbs,
+    unsigned int* temp_states_odd,
+    unsigned int* temp_states_even,
+    unsigned int in,
+    MfkeyRecoveryAbortCallback abort_callback,
+    void* context) {
+    //FURI_LOG_I(TAG, "MSB GO %i", msb_iter); // DEBUG
+    unsigned int msb_head = (msb_limit * msb_round); // msb_iter ranges from 0 to (256/msb_limit)-1
+    unsigned int msb_tail = (msb_limit * (msb_round + 1));
+    int states_tail = 0, tail = 0;
+    int i = 0, j = 0, semi_state = 0, found = 0;
+    unsigned int msb = 0;
+    in = ((in >> 16 & 0xff) | (in << 16) | (in & 0xff00)) << 1;
+    // TODO: Why is this necessary?
+    memset(odd_msbs, 0, msb_limit * sizeof(struct Msb));
+    memset(even_msbs, 0, msb_limit * sizeof(struct Msb));
+
+    for(semi_state = 1 << 20; semi_state >= 0; semi_state--) {
+        if(semi_state % 32768 == 0) {
+            if(abort_callback && abort_callback(context)) {
+                return -1;
+            }
+        }
+
+        if(filter(semi_state) == (oks & 1)) { //-V547
+            states_buffer[0] = semi_state;
+            states_tail = state_loop(states_buffer, oks, CONST_M1_1, CONST_M2_1, 0, 0);
+
+            for(i = states_tail; i >= 0; i--) {
+                msb = states_buffer[i] >> 24;
+                if((msb >= msb_head) && (msb < msb_tail)) {
+                    found = 0;
+                    for(j = 0; j < odd_msbs[msb - msb_head].tail - 1; j++) {
+                        if(odd_msbs[msb - msb_head].states[j] == states_buffer[i]) {
+                            found = 1;
+                            break;
+                        }
+                    }
+
+                    if(!found) {
+                        tail = odd_msbs[msb - msb_head].tail++;
+                        odd_msbs[msb - msb_head].states[tail] = states_buffer[i];
+                    }
+                }
+            }
+        }
+
+        if(filter(semi_state) == (eks & 1)) { //-V547
+            states_buffer[0] = semi_state;
+            states_tail = state_loop(states_buffer, eks, CONST_M1_2, CONST_M2_2, in, 3);
+
+            for(i = 0; i <= states_tail; i++) {
+                msb = states_buffer[i] >> 24;
+                if((msb >= msb_head) && (msb < msb_tail)) {
+                    found = 0;
+
+                    for(j = 0; j < even_msbs[msb - msb_head].tail; j++) {
+                        if(even_msbs[msb - msb_head].states[j] == states_buffer[i]) {
+                            found = 1;
+                            break;
+                        }
+                    }
+
+                    if(!found) {
+                        tail = even_msbs[msb - msb_head].tail++;
+                        even_msbs[msb - msb_head].states[tail] = states_buffer[i];
+                    }
+                }
+            }
+        }
+    }
+
+    oks >>= 12;
+    eks >>= 12;
+
+    for(i = 0; i < msb_limit; i++) {
+        if(abort_callback && abort_callback(context)) {
+            return -1;
+        }
+        // TODO: Why is this necessary?
+        memset(temp_states_even, 0, sizeof(unsigned int) * (MFKEY_TEMP_STATES_SIZE));
+        memset(temp_states_odd, 0, sizeof(unsigned int) * (MFKEY_TEMP_STATES_SIZE));
+        memcpy(temp_states_odd, odd_msbs[i].states, odd_msbs[i].tail * sizeof(unsigned int));
+        memcpy(temp_states_even, even_msbs[i].states, even_msbs[i].tail * sizeof(unsigned int));
+        int res = old_recover(
+            temp_states_odd,
+            0,
+            odd_msbs[i].tail,
+            oks,
+            temp_states_even,
+            0,
+            even_msbs[i].tail,
+            eks,
+            3,
+            0,
+            n,
+            in >> 16,
+            1);
+        if(res == -1) {
+            return 1;
+        }
+        //odd_msbs[i].tail = 0;
+        //even_msbs[i].tail = 0;
+    }
+
+    return 0;
+}
+
+void mfkey_recovery_keystream_init(MfkeyRecoveryKeystream* keystream, const MfClassicNonce* n) {
+    int ks2 = 0;
+    keystream->in = 0;
+    if(n->attack == mfkey32) {
+        ks2 = n->ar0_enc ^ n->p64;
+    } else if(n->attack == static_nested) {
+        ks2 = n->ks1_2_enc;
+        keystream->in = n->nt1 ^ n->uid;
+    }
+
+    int i = 0;
+    keystream->oks = 0;
+    keystream->eks = 0;
+    for(i = 31; i >= 0; i -= 2) {
+        keystream->oks = keystream->oks << 1 | BEBIT(ks2, i);
+    }
+    for(i = 30; i >= 0; i -= 2) {
+        keystream->eks = keystream->eks << 1 | BEBIT(ks2, i);
+    }
+}
+
+int mfkey_recovery_get_chunks_count(int msb_limit) {
+    return MFKEY_MSB_COUNT / msb_limit;
+}
+
+MfkeyRecoveryResult mfkey_recovery_run_chunk(
+    MfClassicNonce* n,
+    const MfkeyRecoveryKeystream* keystream,
+    int chunk,
+    int msb_limit,
+    MfkeyRecoveryBuffers* buffers,
+    MfkeyRecoveryAbortCallback abort_callback,
+    void* context) {
+    int res = calculate_msb_tables(
+        keystream->oks,
+        keystream->eks,
+        chunk,
+        msb_limit,
+        n,
+        buffers->states_buffer,
+        buffers->odd_msbs,
+        buffers->even_msbs,
+        buffers->temp_states_odd,
+        buffers->temp_states_even,
+        keystream->in,
+        abort_callback,
+        context);
+
+    if(res == 1) {
+        return MfkeyRecoveryResultFound;
+    } else if(res == -1) {
+        return MfkeyRecoveryResultAborted;
+    }
+    return MfkeyRecoveryResultNotFound;
+}
+
+#ifdef MFKEY_HOST
+typedef struct {
+    const MfClassicNonce* nonce;
+    MfkeyRecoveryKeystream keystream;
+    int msb_limit;
+    int chunks_count;
+    atomic_int next_chunk;
+    atomic_bool done;
+    bool aborted;
+    MfClassicKey key;
+    pthread_mutex_t mutex;
+    MfkeyRecoveryAbortCallback abort_callback;
+    void* context;
+} MfkeyRecoveryScheduler;
+
+static bool mfkey_recovery_scheduler_abort_callback(void* context) {
+    MfkeyRecoveryScheduler* scheduler = context;
+    if(atomic_load(&scheduler->done)) return true;
+    if(scheduler->abort_callback && scheduler->abort_callback(scheduler->context)) {
+        pthread_mutex_lock(&scheduler->mutex);
+        scheduler->aborted = true;
+        pthread_mutex_unlock(&scheduler->mutex);
+        atomic_store(&scheduler->done, true);
+        return true;
+    }
+    return false;
+}
+
+static void* mfkey_recovery_worker(void* context) {
+    MfkeyRecoveryScheduler* scheduler = context;
+    MfClassicNonce nonce = *scheduler->nonce;
+    MfkeyRecoveryBuffers buffers = {
+        .odd_msbs = calloc(scheduler->msb_limit, sizeof(struct Msb)),
+        .even_msbs = calloc(scheduler->msb_limit, sizeof(struct Msb)),
+        .temp_states_odd = calloc(MFKEY_TEMP_STATES_SIZE, sizeof(unsigned int)),
+        .temp_states_even = calloc(MFKEY_TEMP_STATES_SIZE, sizeof(unsigned int)),
+        .states_buffer = calloc(MFKEY_STATES_BUFFER_SIZE, sizeof(unsigned int)),
+    };
+
+    while(!atomic_load(&scheduler->done)) {
+        int chunk = atomic_fetch_add(&scheduler->next_chunk, 1);
+        if(chunk >= scheduler->chunks_count) break;
+
+        MfkeyRecoveryResult result = mfkey_recovery_run_chunk(
+            &nonce,
+            &scheduler->keystream,
+            chunk,
+            scheduler->msb_limit,
+            &buffers,
+            mfkey_recovery_scheduler_abort_callback,
+            scheduler);
+        if(result == MfkeyRecoveryResultFound) {
+            pthread_mutex_lock(&scheduler->mutex);
+            scheduler->key = nonce.key;
+            pthread_mutex_unlock(&scheduler->mutex);
+            atomic_store(&scheduler->done, true);
+        }
+    }
+
+    free(buffers.odd_msbs);
+    free(buffers.even_msbs);
+    free(buffers.temp_states_odd);
+    free(buffers.temp_states_even);
+    free(buffers.states_buffer);
+    return NULL;
+}
+
+MfkeyRecoveryResult mfkey_recovery_run_parallel(
+    MfClassicNonce* n,
+    int first_chunk,
+    int msb_limit,
+    int threads_count,
+    MfkeyRecoveryAbortCallback abort_callback,
+    void* context) {
+    if(threads_count <= 0) {
+        long cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+        threads_count = (cpu_count > 0) ? (int)cpu_count : 1;
+    }
+
+    MfkeyRecoveryScheduler scheduler = {
+        .nonce = n,
+        .msb_limit = msb_limit,
+        .chunks_count = mfkey_recovery_get_chunks_count(msb_limit),
+        .abort_callback = abort_callback,
+        .context = context,
+    };
+    mfkey_recovery_keystream_init(&scheduler.keystream, n);
+    atomic_init(&scheduler.next_chunk, first_chunk);
+    atomic_init(&scheduler.done, false);
+    pthread_mutex_init(&scheduler.mutex, NULL);
+
+    pthread_t* threads = calloc(threads_count, sizeof(pthread_t));
+    for(int i = 0; i < threads_count; i++) {
+        pthread_create(&threads[i], NULL, mfkey_recovery_worker, &scheduler);
+    }
+    for(int i = 0; i < threads_count; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&scheduler.mutex);
+
+    MfkeyRecoveryResult result = MfkeyRecoveryResultNotFound;
+    if(scheduler.aborted) {
+        result = MfkeyRecoveryResultAborted;
+    } else if(atomic_load(&scheduler.done)) {
+        n->key = scheduler.key;
+        result = MfkeyRecoveryResultFound;
+    }
+    return result;
+}
+#endif
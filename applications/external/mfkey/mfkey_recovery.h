@@ -0,0 +1,152 @@
+#ifndef MFKEY_RECOVERY_H
+#define MFKEY_RECOVERY_H
+
+// Key recovery core. Has no firmware dependencies so it can also be built on a host with
+// `cc -O3 -DMFKEY_HOST -c crypto1.c mfkey_recovery.c` and linked with -lpthread.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#ifdef MFKEY_HOST
+typedef struct {
+    uint8_t data[6];
+} MfClassicKey;
+#else
+#include <nfc/protocols/mf_classic/mf_classic.h>
+#endif
+
+// Total amount of MSB values the state space is split into
+#define MFKEY_MSB_COUNT (256)
+#define MFKEY_MSB_STATES_MAX (768)
+#define MFKEY_TEMP_STATES_SIZE (1280)
+#define MFKEY_STATES_BUFFER_SIZE (1024)
+
+struct Crypto1State {
+    uint32_t odd, even;
+};
+struct Msb {
+    int tail;
+    uint32_t states[MFKEY_MSB_STATES_MAX];
+};
+
+typedef enum { mfkey32, static_nested } AttackType;
+
+typedef struct {
+    AttackType attack;
+    MfClassicKey key; // key
+    uint32_t uid; // serial number
+    uint32_t nt0; // tag challenge first
+    uint32_t nt1; // tag challenge second
+    uint32_t uid_xor_nt0; // uid ^ nt0
+    uint32_t uid_xor_nt1; // uid ^ nt1
+    union {
+        // Mfkey32
+        struct {
+            uint32_t p64; // 64th successor of nt0
+            uint32_t p64b; // 64th successor of nt1
+            uint32_t nr0_enc; // first encrypted reader challenge
+            uint32_t ar0_enc; // first encrypted reader response
+            uint32_t nr1_enc; // second encrypted reader challenge
+            uint32_t ar1_enc; // second encrypted reader response
+        };
+        // Nested
+        struct {
+            uint32_t ks1_1_enc; // first encrypted keystream
+            uint32_t ks1_2_enc; // second encrypted keystream
+            char par_1_str[5]; // first parity bits (string representation)
+            char par_2_str[5]; // second parity bits (string representation)
+            uint8_t par_1; // first parity bits
+            uint8_t par_2; // second parity bits
+        };
+    };
+} MfClassicNonce;
+
+typedef enum {
+    MfkeyRecoveryResultNotFound,
+    MfkeyRecoveryResultFound,
+    MfkeyRecoveryResultAborted,
+} MfkeyRecoveryResult;
+
+/** Called periodically during recovery, return true to abort */
+typedef bool (*MfkeyRecoveryAbortCallback)(void* context);
+
+/** Working memory of a single recovery worker */
+typedef struct {
+    struct Msb* odd_msbs; // msb_limit entries
+    struct Msb* even_msbs; // msb_limit entries
+    unsigned int* temp_states_odd; // MFKEY_TEMP_STATES_SIZE entries
+    unsigned int* temp_states_even; // MFKEY_TEMP_STATES_SIZE entries
+    unsigned int* states_buffer; // MFKEY_STATES_BUFFER_SIZE entries
+} MfkeyRecoveryBuffers;
+
+/** Keystream derived from a nonce, shared by all chunks of its recovery */
+typedef struct {
+    int oks;
+    int eks;
+    unsigned int in;
+} MfkeyRecoveryKeystream;
+
+/** Prepare the keystream for the nonce attack type
+ *
+ * @param      keystream  keystream to fill
+ * @param      n          nonce to recover the key for
+ */
+void mfkey_recovery_keystream_init(MfkeyRecoveryKeystream* keystream, const MfClassicNonce* n);
+
+/** Number of chunks the state space is split into
+ *
+ * @param      msb_limit  MSB values per chunk, divides MFKEY_MSB_COUNT
+ *
+ * @return     chunks count
+ */
+int mfkey_recovery_get_chunks_count(int msb_limit);
+
+/** Search one chunk of the state space
+ *
+ * Chunks are independent from each other and may be run in any order.
+ *
+ * @param      n               nonce, key is stored in it when found
+ * @param      keystream       keystream prepared by mfkey_recovery_keystream_init
+ * @param      chunk           chunk number, less than mfkey_recovery_get_chunks_count
+ * @param      msb_limit       MSB values per chunk
+ * @param      buffers         working memory sized for msb_limit
+ * @param      abort_callback  optional abort callback
+ * @param      context         abort callback context
+ *
+ * @return     chunk search result
+ */
+MfkeyRecoveryResult mfkey_recovery_run_chunk(
+    MfClassicNonce* n,
+    const MfkeyRecoveryKeystream* keystream,
+    int chunk,
+    int msb_limit,
+    MfkeyRecoveryBuffers* buffers,
+    MfkeyRecoveryAbortCallback abort_callback,
+    void* context);
+
+#ifdef MFKEY_HOST
+/** Search chunks starting from first_chunk on all threads
+ *
+ * Every thread allocates its own buffers, abort callback must be thread safe.
+ *
+ * @param      n               nonce, key is stored in it when found
+ * @param      first_chunk     first chunk to search, used to resume
+ * @param      msb_limit       MSB values per chunk
+ * @param      threads_count   worker threads count, 0 for one per CPU
+ * @param      abort_callback  optional abort callback
+ * @param      context         abort callback context
+ *
+ * @return     recovery result
+ */
+MfkeyRecoveryResult mfkey_recovery_run_parallel(
+    MfClassicNonce* n,
+    int first_chunk,
+    int msb_limit,
+    int threads_count,
+    MfkeyRecoveryAbortCallback abort_callback,
+    void* context);
+#endif
+
+#endif // MFKEY_RECOVERY_H
@@ -122,6 +122,8 @@ static bool archive_favourites_rescan(void) {
     return result;
 }
 
+ARRAY_DEF(ArchiveFavoritesPathArray, FuriString*, FURI_STRING_OPLIST)
+
 bool archive_favorites_read(void* context) {
     furi_assert(context);
 
@@ -130,8 +132,9 @@ bool archive_favorites_read(void* context) {
     File* file = storage_file_alloc(storage);
 
     FuriString* buffer;
-    FileInfo file_info;
     buffer = furi_string_alloc();
+    ArchiveFavoritesPathArray_t paths;
+    ArchiveFavoritesPathArray_init(paths);
 
     bool need_refresh = false;
     uint16_t file_count = 0;
@@ -149,28 +152,51 @@ bool archive_favorites_read(void* context) {
                 continue;
             }
 
-            if(furi_string_search(buffer, "/app:") == 0) {
-                if(archive_app_is_available(browser, furi_string_get_cstr(buffer))) {
-                    archive_add_app_item(browser, furi_string_get_cstr(buffer));
-                    file_count++;
-                } else {
-                    need_refresh = true;
-                }
-            } else {
-                if(storage_common_exists(storage, furi_string_get_cstr(buffer))) {
-                    storage_common_stat(storage, furi_string_get_cstr(buffer), &file_info);
-                    archive_add_file_item(
-                        browser, file_info_is_dir(&file_info), furi_string_get_cstr(buffer));
-                    file_count++;
-                } else {
-                    need_refresh = true;
-                }
-            }
-
+            ArchiveFavoritesPathArray_push_back(paths, buffer);
             furi_string_reset(buffer);
         }
     }
     storage_file_close(file);
+
+    // Stat all files in one storage request instead of two round-trips per favorite
+    size_t count = ArchiveFavoritesPathArray_size(paths);
+    FileInfo* file_info = malloc(MAX(count, 1U) * sizeof(FileInfo));
+    StorageBatch* batch = storage_batch_alloc(storage);
+
+    for(size_t i = 0; i < count; i++) {
+        FuriString* path = *ArchiveFavoritesPathArray_cget(paths, i);
+        if(furi_string_search(path, "/app:") != 0) {
+            storage_batch_add_stat(batch, furi_string_get_cstr(path), &file_info[i]);
+        }
+    }
+    storage_batch_submit(batch);
+    storage_batch_wait(batch, FuriWaitForever);
+
+    size_t op_index = 0;
+    for(size_t i = 0; i < count; i++) {
+        FuriString* path = *ArchiveFavoritesPathArray_cget(paths, i);
+
+        if(furi_string_search(path, "/app:") == 0) {
+            if(archive_app_is_available(browser, furi_string_get_cstr(path))) {
+                archive_add_app_item(browser, furi_string_get_cstr(path));
+                file_count++;
+            } else {
+                need_refresh = true;
+            }
+        } else {
+            if(storage_batch_get_error(batch, op_index++) == FSE_OK) {
+                archive_add_file_item(
+                    browser, file_info_is_dir(&file_info[i]), furi_string_get_cstr(path));
+                file_count++;
+            } else {
+                need_refresh = true;
+            }
+        }
+    }
+
+    storage_batch_free(batch);
+    free(file_info);
+    ArchiveFavoritesPathArray_clear(paths);
     furi_string_free(buffer);
     storage_file_free(file);
     furi_record_close(RECORD_STORAGE);
@@ -366,6 +366,8 @@ bool infrared_remote_load(InfraredRemote* remote, const char* path) {
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    // Signal names are spread between large data lines
+    flipper_format_set_key_index(ff, true);
 
     FuriString* tmp = furi_string_alloc();
     bool success = false;
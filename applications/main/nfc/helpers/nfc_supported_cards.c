@@ -7,6 +7,11 @@
 #include <flipper_application/plugins/plugin_manager.h>
 #include <flipper_application/plugins/composite_resolver.h>
 #include <loader/firmware_api/firmware_api.h>
+#include <flipper_format/flipper_format.h>
+#include <nfc/protocols/mf_classic/mf_classic.h>
+#include <nfc/protocols/mf_desfire/mf_desfire.h>
+#include <bit_lib/bit_lib.h>
+#include <toolbox/version.h>
 
 #include <furi.h>
 #include <path.h>
@@ -17,6 +22,10 @@
 #define NFC_SUPPORTED_CARDS_PLUGINS_PATH APP_DATA_PATH("plugins")
 #define NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX "_parser.fal"
 
+#define NFC_SUPPORTED_CARDS_MANIFEST_PATH NFC_SUPPORTED_CARDS_PLUGINS_PATH "/.manifest"
+#define NFC_SUPPORTED_CARDS_MANIFEST_FILE_TYPE "Flipper NFC plugins manifest"
+#define NFC_SUPPORTED_CARDS_MANIFEST_VERSION (1U)
+
 typedef enum {
     NfcSupportedCardsPluginFeatureHasVerify = (1U << 0),
     NfcSupportedCardsPluginFeatureHasRead = (1U << 1),
@@ -25,8 +34,11 @@ typedef enum {
 
 typedef struct {
     FuriString* path;
+    uint32_t size; // File size, the manifest is rebuilt when it changes
     NfcProtocol protocol;
     NfcSupportedCardsPluginFeature feature;
+    NfcSupportedCardPluginMatch* match;
+    size_t match_count;
 } NfcSupportedCardsPluginCache;
 
 ARRAY_DEF(NfcSupportedCardsPluginCache, NfcSupportedCardsPluginCache, M_POD_OPLIST);
@@ -43,7 +55,10 @@ typedef struct {
     File* directory;
     FuriString* file_path;
     char file_name[256];
+    uint64_t file_size;
     FlipperApplication* app;
+    FuriString* plugin_path;
+    const NfcSupportedCardsPlugin* plugin;
 } NfcSupportedCardsLoadContext;
 
 struct NfcSupportedCards {
@@ -65,16 +80,28 @@ NfcSupportedCards* nfc_supported_cards_alloc(void) {
     return instance;
 }
 
-void nfc_supported_cards_free(NfcSupportedCards* instance) {
-    furi_assert(instance);
+static void nfc_supported_cards_load_context_free(NfcSupportedCardsLoadContext* instance);
 
+static void nfc_supported_cards_cache_reset(NfcSupportedCards* instance) {
     NfcSupportedCardsPluginCache_it_t iter;
     for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
         !NfcSupportedCardsPluginCache_end_p(iter);
         NfcSupportedCardsPluginCache_next(iter)) {
         NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
         furi_string_free(plugin_cache->path);
+        free(plugin_cache->match);
+    }
+    NfcSupportedCardsPluginCache_reset(instance->plugins_cache_arr);
+}
+
+void nfc_supported_cards_free(NfcSupportedCards* instance) {
+    furi_assert(instance);
+
+    if(instance->load_context) {
+        nfc_supported_cards_load_context_free(instance->load_context);
     }
+
+    nfc_supported_cards_cache_reset(instance);
     NfcSupportedCardsPluginCache_clear(instance->plugins_cache_arr);
 
     composite_api_resolver_free(instance->api_resolver);
@@ -87,6 +114,9 @@ static NfcSupportedCardsLoadContext* nfc_supported_cards_load_context_alloc(void
     instance->storage = furi_record_open(RECORD_STORAGE);
     instance->directory = storage_file_alloc(instance->storage);
     instance->file_path = furi_string_alloc();
+    instance->app = NULL;
+    instance->plugin_path = furi_string_alloc();
+    instance->plugin = NULL;
 
     if(!storage_dir_open(instance->directory, NFC_SUPPORTED_CARDS_PLUGINS_PATH)) {
         FURI_LOG_D(TAG, "Failed to open directory: %s", NFC_SUPPORTED_CARDS_PLUGINS_PATH);
@@ -101,6 +131,7 @@ static void nfc_supported_cards_load_context_free(NfcSupportedCardsLoadContext*
     }
 
     furi_string_free(instance->file_path);
+    furi_string_free(instance->plugin_path);
 
     storage_dir_close(instance->directory);
     storage_file_free(instance->directory);
@@ -116,6 +147,11 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
     furi_assert(instance);
     furi_assert(path);
 
+    // Plugin that read the card stays mapped for parsing
+    if(instance->plugin && furi_string_equal(instance->plugin_path, path)) {
+        return instance->plugin;
+    }
+
     const NfcSupportedCardsPlugin* plugin = NULL;
     do {
         if(instance->app) flipper_application_free(instance->app);
@@ -137,6 +173,9 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
         plugin = descriptor->entry_point;
     } while(false);
 
+    instance->plugin = plugin;
+    furi_string_set(instance->plugin_path, path);
+
     return plugin;
 }
 
@@ -147,9 +186,11 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
 
     do {
         if(!storage_file_is_open(instance->directory)) break;
+        FileInfo file_info;
         if(!storage_dir_read(
-               instance->directory, NULL, instance->file_name, sizeof(instance->file_name)))
+               instance->directory, &file_info, instance->file_name, sizeof(instance->file_name)))
             break;
+        instance->file_size = file_info.size;
 
         furi_string_set(instance->file_path, instance->file_name);
         if(!furi_string_end_with_str(instance->file_path, NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX))
@@ -163,6 +204,203 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
     return plugin;
 }
 
+static bool nfc_supported_cards_manifest_read_entry(
+    NfcSupportedCardsPluginCache* plugin_cache,
+    FlipperFormat* ff,
+    FuriString* temp_str) {
+    bool success = false;
+
+    do {
+        if(!flipper_format_read_string(ff, "Plugin", temp_str)) break;
+        path_concat(
+            NFC_SUPPORTED_CARDS_PLUGINS_PATH, furi_string_get_cstr(temp_str), plugin_cache->path);
+
+        uint32_t value;
+        if(!flipper_format_read_uint32(ff, "Size", &plugin_cache->size, 1)) break;
+        if(!flipper_format_read_uint32(ff, "Protocol", &value, 1)) break;
+        if(value >= NfcProtocolNum) break;
+        plugin_cache->protocol = value;
+        if(!flipper_format_read_uint32(ff, "Features", &value, 1)) break;
+        plugin_cache->feature = value;
+
+        if(!flipper_format_read_uint32(ff, "Matches", &value, 1)) break;
+        if(value) {
+            size_t match_size = value * sizeof(NfcSupportedCardPluginMatch);
+            if(match_size > UINT16_MAX) break;
+            plugin_cache->match = malloc(match_size);
+            plugin_cache->match_count = value;
+            if(!flipper_format_read_hex(ff, "Match", (uint8_t*)plugin_cache->match, match_size))
+                break;
+        }
+
+        success = true;
+    } while(false);
+
+    return success;
+}
+
+// Manifest is only trusted for the same firmware and the same set of plugin files
+static bool nfc_supported_cards_manifest_is_current(NfcSupportedCards* instance) {
+    NfcSupportedCardsLoadContext* context = instance->load_context;
+    size_t plugins_found = 0;
+    bool is_current = true;
+
+    while(is_current && storage_file_is_open(context->directory)) {
+        FileInfo file_info;
+        if(!storage_dir_read(
+               context->directory, &file_info, context->file_name, sizeof(context->file_name)))
+            break;
+
+        furi_string_set(context->file_path, context->file_name);
+        if(!furi_string_end_with_str(context->file_path, NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX))
+            continue;
+
+        path_concat(NFC_SUPPORTED_CARDS_PLUGINS_PATH, context->file_name, context->file_path);
+
+        is_current = false;
+        for
+            M_EACH(plugin_cache, instance->plugins_cache_arr, NfcSupportedCardsPluginCache_t) {
+                if(furi_string_equal(plugin_cache->path, context->file_path) &&
+                   plugin_cache->size == file_info.size) {
+                    is_current = true;
+                    break;
+                }
+            }
+        plugins_found++;
+    }
+
+    return is_current &&
+           (plugins_found == NfcSupportedCardsPluginCache_size(instance->plugins_cache_arr));
+}
+
+static bool nfc_supported_cards_manifest_load(NfcSupportedCards* instance) {
+    FlipperFormat* ff = flipper_format_file_alloc(instance->load_context->storage);
+    FuriString* temp_str = furi_string_alloc();
+    bool success = false;
+
+    do {
+        if(!flipper_format_file_open_existing(ff, NFC_SUPPORTED_CARDS_MANIFEST_PATH)) break;
+
+        uint32_t version;
+        if(!flipper_format_read_header(ff, temp_str, &version)) break;
+        if(!furi_string_equal(temp_str, NFC_SUPPORTED_CARDS_MANIFEST_FILE_TYPE)) break;
+        if(version != NFC_SUPPORTED_CARDS_MANIFEST_VERSION) break;
+        if(!flipper_format_read_string(ff, "Firmware", temp_str)) break;
+        if(!furi_string_equal(temp_str, version_get_githash(NULL))) break;
+
+        uint32_t plugins_count;
+        if(!flipper_format_read_uint32(ff, "Plugins", &plugins_count, 1)) break;
+
+        bool entries_read = true;
+        for(uint32_t i = 0; entries_read && (i < plugins_count); i++) {
+            NfcSupportedCardsPluginCache* plugin_cache =
+                NfcSupportedCardsPluginCache_push_new(instance->plugins_cache_arr);
+            plugin_cache->path = furi_string_alloc();
+            entries_read = nfc_supported_cards_manifest_read_entry(plugin_cache, ff, temp_str);
+        }
+        if(!entries_read) break;
+
+        success = nfc_supported_cards_manifest_is_current(instance);
+    } while(false);
+
+    if(!success) {
+        nfc_supported_cards_cache_reset(instance);
+    }
+
+    furi_string_free(temp_str);
+    flipper_format_free(ff);
+
+    return success;
+}
+
+static void nfc_supported_cards_manifest_save(NfcSupportedCards* instance) {
+    Storage* storage = instance->load_context->storage;
+    FlipperFormat* ff = flipper_format_file_alloc(storage);
+    FuriString* temp_str = furi_string_alloc();
+    bool success = false;
+
+    do {
+        if(!flipper_format_file_open_always(ff, NFC_SUPPORTED_CARDS_MANIFEST_PATH)) break;
+        if(!flipper_format_write_header_cstr(
+               ff, NFC_SUPPORTED_CARDS_MANIFEST_FILE_TYPE, NFC_SUPPORTED_CARDS_MANIFEST_VERSION))
+            break;
+        if(!flipper_format_write_string_cstr(ff, "Firmware", version_get_githash(NULL))) break;
+
+        uint32_t plugins_count = NfcSupportedCardsPluginCache_size(instance->plugins_cache_arr);
+        if(!flipper_format_write_uint32(ff, "Plugins", &plugins_count, 1)) break;
+
+        bool entries_written = true;
+        for
+            M_EACH(plugin_cache, instance->plugins_cache_arr, NfcSupportedCardsPluginCache_t) {
+                path_extract_filename(plugin_cache->path, temp_str, false);
+                uint32_t protocol = plugin_cache->protocol;
+                uint32_t feature = plugin_cache->feature;
+                uint32_t match_count = plugin_cache->match_count;
+
+                entries_written =
+                    flipper_format_write_string(ff, "Plugin", temp_str) &&
+                    flipper_format_write_uint32(ff, "Size", &plugin_cache->size, 1) &&
+                    flipper_format_write_uint32(ff, "Protocol", &protocol, 1) &&
+                    flipper_format_write_uint32(ff, "Features", &feature, 1) &&
+                    flipper_format_write_uint32(ff, "Matches", &match_count, 1);
+
+                if(entries_written && match_count) {
+                    entries_written = flipper_format_write_hex(
+                        ff,
+                        "Match",
+                        (const uint8_t*)plugin_cache->match,
+                        match_count * sizeof(NfcSupportedCardPluginMatch));
+                }
+
+                if(!entries_written) break;
+            }
+        if(!entries_written) break;
+
+        success = true;
+    } while(false);
+
+    flipper_format_free(ff);
+    furi_string_free(temp_str);
+
+    if(!success) {
+        FURI_LOG_W(TAG, "Failed to save manifest");
+        storage_simply_remove(storage, NFC_SUPPORTED_CARDS_MANIFEST_PATH);
+    }
+}
+
+// Load every plugin once to learn what it supports
+static void nfc_supported_cards_manifest_build(NfcSupportedCards* instance) {
+    while(true) {
+        const ElfApiInterface* api_interface = composite_api_resolver_get(instance->api_resolver);
+        const NfcSupportedCardsPlugin* plugin =
+            nfc_supported_cards_get_next_plugin(instance->load_context, api_interface);
+        if(plugin == NULL) break; //-V547
+
+        NfcSupportedCardsPluginCache plugin_cache = {}; //-V779
+        plugin_cache.path = furi_string_alloc_set(instance->load_context->file_path);
+        plugin_cache.size = instance->load_context->file_size;
+        plugin_cache.protocol = plugin->protocol;
+        if(plugin->verify) {
+            plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasVerify;
+        }
+        if(plugin->read) {
+            plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasRead;
+        }
+        if(plugin->parse) {
+            plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasParse;
+        }
+        if(plugin->match && plugin->match_count) {
+            size_t match_size = plugin->match_count * sizeof(NfcSupportedCardPluginMatch);
+            plugin_cache.match = malloc(match_size);
+            memcpy(plugin_cache.match, plugin->match, match_size);
+            plugin_cache.match_count = plugin->match_count;
+        }
+        NfcSupportedCardsPluginCache_push_back(instance->plugins_cache_arr, plugin_cache);
+    }
+
+    nfc_supported_cards_manifest_save(instance);
+}
+
 void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
     furi_assert(instance);
 
@@ -172,30 +410,16 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
             break;
 
         instance->load_context = nfc_supported_cards_load_context_alloc();
+        bool manifest_loaded = nfc_supported_cards_manifest_load(instance);
+        nfc_supported_cards_load_context_free(instance->load_context);
 
-        while(true) {
-            const ElfApiInterface* api_interface =
-                composite_api_resolver_get(instance->api_resolver);
-            const NfcSupportedCardsPlugin* plugin =
-                nfc_supported_cards_get_next_plugin(instance->load_context, api_interface);
-            if(plugin == NULL) break; //-V547
-
-            NfcSupportedCardsPluginCache plugin_cache = {}; //-V779
-            plugin_cache.path = furi_string_alloc_set(instance->load_context->file_path);
-            plugin_cache.protocol = plugin->protocol;
-            if(plugin->verify) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasVerify;
-            }
-            if(plugin->read) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasRead;
-            }
-            if(plugin->parse) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasParse;
-            }
-            NfcSupportedCardsPluginCache_push_back(instance->plugins_cache_arr, plugin_cache);
+        if(!manifest_loaded) {
+            FURI_LOG_D(TAG, "Building manifest");
+            instance->load_context = nfc_supported_cards_load_context_alloc();
+            nfc_supported_cards_manifest_build(instance);
+            nfc_supported_cards_load_context_free(instance->load_context);
         }
-
-        nfc_supported_cards_load_context_free(instance->load_context);
+        instance->load_context = NULL;
 
         size_t plugins_loaded = NfcSupportedCardsPluginCache_size(instance->plugins_cache_arr);
         if(plugins_loaded == 0) {
@@ -209,46 +433,104 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
     } while(false);
 }
 
+static bool nfc_supported_cards_match_check(
+    const NfcSupportedCardPluginMatch* match,
+    const NfcDevice* device) {
+    const NfcProtocol protocol = nfc_device_get_protocol(device);
+    bool can_match = true;
+
+    if(match->type == NfcSupportedCardPluginMatchTypeMfClassicKeyA ||
+       match->type == NfcSupportedCardPluginMatchTypeMfClassicKeyB) {
+        if(protocol != NfcProtocolMfClassic) return true;
+
+        const MfClassicData* data = nfc_device_get_data(device, NfcProtocolMfClassic);
+        const MfClassicKeyType key_type =
+            (match->type == NfcSupportedCardPluginMatchTypeMfClassicKeyA) ? MfClassicKeyTypeA :
+                                                                            MfClassicKeyTypeB;
+
+        if(match->param >= mf_classic_get_total_sectors_num(data->type)) {
+            can_match = false;
+        } else if(mf_classic_is_key_found(data, match->param, key_type)) {
+            const MfClassicSectorTrailer* sec_tr =
+                mf_classic_get_sector_trailer_by_sector(data, match->param);
+            const MfClassicKey* key = key_type == MfClassicKeyTypeA ? &sec_tr->key_a :
+                                                                      &sec_tr->key_b;
+            can_match = bit_lib_bytes_to_num_be(key->data, COUNT_OF(key->data)) == match->value;
+        }
+    } else if(match->type == NfcSupportedCardPluginMatchTypeMfDesfireApplication) {
+        if(protocol != NfcProtocolMfDesfire) return true;
+
+        const MfDesfireData* data = nfc_device_get_data(device, NfcProtocolMfDesfire);
+        MfDesfireApplicationId app_id;
+        bit_lib_num_to_bytes_be(match->value, COUNT_OF(app_id.data), app_id.data);
+        can_match = mf_desfire_get_application(data, &app_id) != NULL;
+    }
+
+    return can_match;
+}
+
+/* Plugins with criteria the card meets go first, plugins without criteria are tried last */
+static bool nfc_supported_cards_is_candidate(
+    const NfcSupportedCardsPluginCache* plugin_cache,
+    const NfcDevice* device,
+    NfcSupportedCardsPluginFeature feature,
+    bool generic) {
+    if(plugin_cache->protocol != nfc_device_get_protocol(device)) return false;
+    if((plugin_cache->feature & feature) == 0) return false;
+    if(generic) return plugin_cache->match_count == 0;
+
+    for(size_t i = 0; i < plugin_cache->match_count; i++) {
+        if(nfc_supported_cards_match_check(&plugin_cache->match[i], device)) return true;
+    }
+
+    return false;
+}
+
 bool nfc_supported_cards_read(NfcSupportedCards* instance, NfcDevice* device, Nfc* nfc) {
     furi_assert(instance);
     furi_assert(device);
     furi_assert(nfc);
 
     bool card_read = false;
-    NfcProtocol protocol = nfc_device_get_protocol(device);
 
     do {
         if(instance->load_state != NfcSupportedCardsLoadStateSuccess) break;
 
-        instance->load_context = nfc_supported_cards_load_context_alloc();
-
-        NfcSupportedCardsPluginCache_it_t iter;
-        for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
-            !NfcSupportedCardsPluginCache_end_p(iter);
-            NfcSupportedCardsPluginCache_next(iter)) {
-            NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
-            if(plugin_cache->protocol != protocol) continue;
-            if((plugin_cache->feature & NfcSupportedCardsPluginFeatureHasRead) == 0) continue;
-
-            const ElfApiInterface* api_interface =
-                composite_api_resolver_get(instance->api_resolver);
-            const NfcSupportedCardsPlugin* plugin = nfc_supported_cards_get_plugin(
-                instance->load_context, plugin_cache->path, api_interface);
-            if(plugin == NULL) continue;
-
-            if(plugin->verify) {
-                if(!plugin->verify(nfc)) continue;
-            }
+        if(instance->load_context == NULL) {
+            instance->load_context = nfc_supported_cards_load_context_alloc();
+        }
 
-            if(plugin->read) {
-                if(plugin->read(nfc, device)) {
-                    card_read = true;
-                    break;
+        for(size_t pass = 0; (pass < 2) && !card_read; pass++) {
+            for
+                M_EACH(plugin_cache, instance->plugins_cache_arr, NfcSupportedCardsPluginCache_t) {
+                    if(!nfc_supported_cards_is_candidate(
+                           plugin_cache, device, NfcSupportedCardsPluginFeatureHasRead, pass))
+                        continue;
+
+                    const ElfApiInterface* api_interface =
+                        composite_api_resolver_get(instance->api_resolver);
+                    const NfcSupportedCardsPlugin* plugin = nfc_supported_cards_get_plugin(
+                        instance->load_context, plugin_cache->path, api_interface);
+                    if(plugin == NULL) continue;
+
+                    if(plugin->verify) {
+                        if(!plugin->verify(nfc)) continue;
+                    }
+
+                    if(plugin->read) {
+                        if(plugin->read(nfc, device)) {
+                            card_read = true;
+                            break;
+                        }
+                    }
                 }
-            }
         }
 
-        nfc_supported_cards_load_context_free(instance->load_context);
+        // Keep the plugin that read the card mapped, parsing comes next
+        if(!card_read) {
+            nfc_supported_cards_load_context_free(instance->load_context);
+            instance->load_context = NULL;
+        }
     } while(false);
 
     return card_read;
@@ -263,36 +545,38 @@ bool nfc_supported_cards_parse(
     furi_assert(parsed_data);
 
     bool card_parsed = false;
-    NfcProtocol protocol = nfc_device_get_protocol(device);
 
     do {
         if(instance->load_state != NfcSupportedCardsLoadStateSuccess) break;
 
-        instance->load_context = nfc_supported_cards_load_context_alloc();
+        if(instance->load_context == NULL) {
+            instance->load_context = nfc_supported_cards_load_context_alloc();
+        }
 
-        NfcSupportedCardsPluginCache_it_t iter;
-        for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
-            !NfcSupportedCardsPluginCache_end_p(iter);
-            NfcSupportedCardsPluginCache_next(iter)) {
-            NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
-            if(plugin_cache->protocol != protocol) continue;
-            if((plugin_cache->feature & NfcSupportedCardsPluginFeatureHasParse) == 0) continue;
-
-            const ElfApiInterface* api_interface =
-                composite_api_resolver_get(instance->api_resolver);
-            const NfcSupportedCardsPlugin* plugin = nfc_supported_cards_get_plugin(
-                instance->load_context, plugin_cache->path, api_interface);
-            if(plugin == NULL) continue;
-
-            if(plugin->parse) {
-                if(plugin->parse(device, parsed_data)) {
-                    card_parsed = true;
-                    break;
+        for(size_t pass = 0; (pass < 2) && !card_parsed; pass++) {
+            for
+                M_EACH(plugin_cache, instance->plugins_cache_arr, NfcSupportedCardsPluginCache_t) {
+                    if(!nfc_supported_cards_is_candidate(
+                           plugin_cache, device, NfcSupportedCardsPluginFeatureHasParse, pass))
+                        continue;
+
+                    const ElfApiInterface* api_interface =
+                        composite_api_resolver_get(instance->api_resolver);
+                    const NfcSupportedCardsPlugin* plugin = nfc_supported_cards_get_plugin(
+                        instance->load_context, plugin_cache->path, api_interface);
+                    if(plugin == NULL) continue;
+
+                    if(plugin->parse) {
+                        if(plugin->parse(device, parsed_data)) {
+                            card_parsed = true;
+                            break;
+                        }
+                    }
                 }
-            }
         }
 
         nfc_supported_cards_load_context_free(instance->load_context);
+        instance->load_context = NULL;
     } while(false);
 
     return card_parsed;
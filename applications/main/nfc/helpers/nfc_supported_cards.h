@@ -37,6 +37,9 @@ void nfc_supported_cards_free(NfcSupportedCards* instance);
 /**
  * @brief Load plugins information to cache.
  *
+ * Plugin information is taken from the manifest in the plugins directory. The manifest
+ * is rebuilt by loading every plugin if the firmware or any plugin file has changed.
+ *
  * @note This function must be called before calling read and parse fanctions.
  *
  * @param[in, out] instance pointer to NfcSupportedCards instance.
@@ -48,7 +51,9 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance);
  *
  * This function will load all suitable supported card plugins one by one and
  * try to execute the custom read procedure specified in each. Upon first success,
- * no further attempts will be made and the function will return.
+ * no further attempts will be made and the function will return. Plugins whose match
+ * criteria the card meets are tried before plugins without criteria. The plugin that
+ * read the card stays loaded until the following nfc_supported_cards_parse() call.
  *
  * @param[in, out] instance pointer to NfcSupportedCards instance.
  * @param[in,out] device pointer to a device instance to hold the read data.
@@ -64,7 +69,8 @@ bool nfc_supported_cards_read(NfcSupportedCards* instance, NfcDevice* device, Nf
  *
  * This function will load all suitable supported card plugins one by one and
  * try to parse the data according to each implementation. Upon first success,
- * no further attempts will be made and the function will return.
+ * no further attempts will be made and the function will return. Plugins whose match
+ * criteria the card meets are tried before plugins without criteria.
  *
  * @param[in, out] instance pointer to NfcSupportedCards instance.
  * @param[in] device pointer to a device instance holding the data is to be parsed.
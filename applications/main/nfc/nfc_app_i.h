@@ -83,6 +83,7 @@ typedef enum {
 
 typedef struct {
     KeysDict* dict;
+    MfClassicKey* dict_keys;
     uint8_t sectors_total;
     uint8_t sectors_read;
     uint8_t current_sector;
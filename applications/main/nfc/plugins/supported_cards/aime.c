@@ -148,11 +148,17 @@ static bool aime_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch aime_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 0, .value = 0x574343467632},
+};
+
 static const NfcSupportedCardsPlugin aime_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = aime_verify,
     .read = aime_read,
     .parse = aime_parse,
+    .match = aime_match,
+    .match_count = COUNT_OF(aime_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
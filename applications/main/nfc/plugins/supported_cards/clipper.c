@@ -550,11 +550,18 @@ static void furi_string_cat_timestamp(
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch clipper_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfDesfireApplication, .value = 0x9011f2},
+    {.type = NfcSupportedCardPluginMatchTypeMfDesfireApplication, .value = 0x9111f2},
+};
+
 static const NfcSupportedCardsPlugin clipper_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = clipper_parse,
+    .match = clipper_match,
+    .match_count = COUNT_OF(clipper_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -132,11 +132,17 @@ static bool hid_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch hid_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 1, .value = 0x484944204953},
+};
+
 static const NfcSupportedCardsPlugin hid_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = hid_verify,
     .read = hid_read,
     .parse = hid_parse,
+    .match = hid_match,
+    .match_count = COUNT_OF(hid_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
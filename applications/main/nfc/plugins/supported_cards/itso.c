@@ -105,11 +105,17 @@ static bool itso_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch itso_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfDesfireApplication, .value = 0x1602a0},
+};
+
 static const NfcSupportedCardsPlugin itso_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = itso_parse,
+    .match = itso_match,
+    .match_count = COUNT_OF(itso_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -394,11 +394,18 @@ static bool kazan_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch kazan_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 8, .value = 0xe954024ee754},
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 8, .value = 0x2058eaee8446},
+};
+
 static const NfcSupportedCardsPlugin kazan_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = kazan_verify,
     .read = kazan_read,
     .parse = kazan_parse,
+    .match = kazan_match,
+    .match_count = COUNT_OF(kazan_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
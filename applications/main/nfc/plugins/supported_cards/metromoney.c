@@ -170,11 +170,17 @@ static bool metromoney_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch metromoney_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 1, .value = 0x9c616585e26d},
+};
+
 static const NfcSupportedCardsPlugin metromoney_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = metromoney_verify,
     .read = metromoney_read,
     .parse = metromoney_parse,
+    .match = metromoney_match,
+    .match_count = COUNT_OF(metromoney_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
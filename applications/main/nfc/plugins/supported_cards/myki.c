@@ -96,11 +96,17 @@ static bool myki_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch myki_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfDesfireApplication, .value = 0x0011f2},
+};
+
 static const NfcSupportedCardsPlugin myki_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = myki_parse,
+    .match = myki_match,
+    .match_count = COUNT_OF(myki_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -19,6 +19,10 @@
  * @note the APPID field MUST end with `_parser` so the applicaton would know that this particular file
  * is a supported card plugin.
  *
+ * Plugins that recognise cards by well-known keys or application IDs should also list them as
+ * match criteria. The application keeps them in a manifest and loads only the plugins whose
+ * criteria the card can meet.
+ *
  * @see nfc_supported_cards.h
  */
 #pragma once
@@ -36,7 +40,7 @@
 /**
  * @brief Currently supported plugin API version.
  */
-#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION 1
+#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION 2
 
 /**
  * @brief Verify that the card is of a supported type.
@@ -81,6 +85,28 @@ typedef bool (*NfcSupportedCardPluginRead)(Nfc* nfc, NfcDevice* device);
  */
 typedef bool (*NfcSupportedCardPluginParse)(const NfcDevice* device, FuriString* parsed_data);
 
+/**
+ * @brief Match criterion types.
+ */
+typedef enum {
+    NfcSupportedCardPluginMatchTypeMfClassicKeyA, /**< Key A of sector `param` is `value`. */
+    NfcSupportedCardPluginMatchTypeMfClassicKeyB, /**< Key B of sector `param` is `value`. */
+    NfcSupportedCardPluginMatchTypeMfDesfireApplication, /**< Application `value` is present. */
+} NfcSupportedCardPluginMatchType;
+
+/**
+ * @brief Condition that every card accepted by the plugin meets.
+ *
+ * A plugin is only loaded if the card meets at least one of its criteria.
+ * Criteria that cannot be checked yet, e.g. a key the regular read did not find,
+ * are considered met.
+ */
+typedef struct {
+    NfcSupportedCardPluginMatchType type; /**< What to check. */
+    uint32_t param; /**< Sector number for key criteria, unused otherwise. */
+    uint64_t value; /**< Key, or application ID with the first byte most significant. */
+} NfcSupportedCardPluginMatch;
+
 /**
  * @brief Supported card plugin interface.
  *
@@ -91,4 +117,6 @@ typedef struct {
     NfcSupportedCardPluginVerify verify; /**< Pointer to the verify() function. */
     NfcSupportedCardPluginRead read; /**< Pointer to the read() function. */
     NfcSupportedCardPluginParse parse; /**< Pointer to the parse() function. */
+    const NfcSupportedCardPluginMatch* match; /**< Optional match criteria. */
+    size_t match_count; /**< Number of match criteria, 0 to try the plugin on every card. */
 } NfcSupportedCardsPlugin;
@@ -213,11 +213,17 @@ static bool opal_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch opal_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfDesfireApplication, .value = 0x314553},
+};
+
 static const NfcSupportedCardsPlugin opal_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = opal_parse,
+    .match = opal_match,
+    .match_count = COUNT_OF(opal_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -199,11 +199,17 @@ static bool plantain_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch plantain_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 8, .value = 0x26973ea74321},
+};
+
 static const NfcSupportedCardsPlugin plantain_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = plantain_verify,
     .read = plantain_read,
     .parse = plantain_parse,
+    .match = plantain_match,
+    .match_count = COUNT_OF(plantain_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -851,11 +851,17 @@ static bool skylanders_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch skylanders_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 0, .value = 0x4b0b20107ccb},
+};
+
 static const NfcSupportedCardsPlugin skylanders_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = skylanders_verify,
     .read = skylanders_read,
     .parse = skylanders_parse,
+    .match = skylanders_match,
+    .match_count = COUNT_OF(skylanders_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -1167,11 +1167,17 @@ static bool social_moscow_parse(const NfcDevice* device, FuriString* parsed_data
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch social_moscow_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 15, .value = 0xa0a1a2a3a4a5},
+};
+
 static const NfcSupportedCardsPlugin social_moscow_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = social_moscow_verify,
     .read = social_moscow_read,
     .parse = social_moscow_parse,
+    .match = social_moscow_match,
+    .match_count = COUNT_OF(social_moscow_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -229,11 +229,18 @@ static bool troika_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch troika_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 11, .value = 0x08b386463229},
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 8, .value = 0xa73f5dc1d333},
+};
+
 static const NfcSupportedCardsPlugin troika_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = troika_verify,
     .read = troika_read,
     .parse = troika_parse,
+    .match = troika_match,
+    .match_count = COUNT_OF(troika_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -175,11 +175,17 @@ static bool washcity_parse(const NfcDevice* device, FuriString* parsed_data) {
 }
 
 /* Actual implementation of app<>plugin interface */
+static const NfcSupportedCardPluginMatch washcity_match[] = {
+    {.type = NfcSupportedCardPluginMatchTypeMfClassicKeyA, .param = 1, .value = 0xc78a3d0e1bcd},
+};
+
 static const NfcSupportedCardsPlugin washcity_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = washcity_verify,
     .read = washcity_read,
     .parse = washcity_parse,
+    .match = washcity_match,
+    .match_count = COUNT_OF(washcity_match),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
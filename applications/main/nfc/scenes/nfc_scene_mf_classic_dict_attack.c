@@ -5,6 +5,9 @@
 
 #define TAG "NfcMfClassicDictAttack"
 
+#define NFC_DICT_ATTACK_KEYS_HEAP_RESERVE (16U * 1024U)
+#define NFC_DICT_ATTACK_CACHED_KEYS_MAX (MF_CLASSIC_TOTAL_SECTORS_MAX * 2)
+
 typedef enum {
     DictAttackStateUserDictInProgress,
     DictAttackStateSystemDictInProgress,
@@ -40,9 +43,18 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeRequestKey) {
+        NfcMfClassicDictAttackContext* mfc_dict = &instance->nfc_dict_context;
         MfClassicKey key = {};
-        if(keys_dict_get_next_key(
-               instance->nfc_dict_context.dict, key.data, sizeof(MfClassicKey))) {
+        bool key_provided = false;
+        if(mfc_dict->dict_keys) {
+            if(mfc_dict->dict_keys_current < mfc_dict->dict_keys_total) {
+                key = mfc_dict->dict_keys[mfc_dict->dict_keys_current];
+                key_provided = true;
+            }
+        } else {
+            key_provided = keys_dict_get_next_key(mfc_dict->dict, key.data, sizeof(MfClassicKey));
+        }
+        if(key_provided) {
             mfc_event->data->key_request_data.key = key;
             mfc_event->data->key_request_data.key_provided = true;
             instance->nfc_dict_context.dict_keys_current++;
@@ -61,7 +73,14 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeNextSector) {
-        keys_dict_rewind(instance->nfc_dict_context.dict);
+        FURI_LOG_D(
+            TAG,
+            "Sector %d done in %lu ms",
+            mfc_event->data->next_sector_data.current_sector - 1,
+            mfc_event->data->next_sector_data.sector_time_ms);
+        if(!instance->nfc_dict_context.dict_keys) {
+            keys_dict_rewind(instance->nfc_dict_context.dict);
+        }
         instance->nfc_dict_context.dict_keys_current = 0;
         instance->nfc_dict_context.current_sector =
             mfc_event->data->next_sector_data.current_sector;
@@ -80,7 +99,9 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeKeyAttackStop) {
-        keys_dict_rewind(instance->nfc_dict_context.dict);
+        if(!instance->nfc_dict_context.dict_keys) {
+            keys_dict_rewind(instance->nfc_dict_context.dict);
+        }
         instance->nfc_dict_context.is_key_attack = false;
         instance->nfc_dict_context.dict_keys_current = 0;
         view_dispatcher_send_custom_event(
@@ -120,9 +141,84 @@ static void nfc_scene_mf_classic_dict_attack_update_view(NfcApp* instance) {
     }
 }
 
+static size_t
+    nfc_scene_mf_classic_dict_attack_get_cached_keys(NfcApp* instance, MfClassicKey* keys) {
+    size_t uid_len = 0;
+    const uint8_t* uid = nfc_device_get_uid(instance->nfc_device, &uid_len);
+
+    size_t keys_count = 0;
+    if(mf_classic_key_cache_load(instance->mfc_key_cache, uid, uid_len)) {
+        uint8_t sector_num = 0;
+        MfClassicKey key = {};
+        MfClassicKeyType key_type = MfClassicKeyTypeA;
+        while(mf_classic_key_cahce_get_next_key(
+            instance->mfc_key_cache, &sector_num, &key, &key_type)) {
+            bool is_duplicate = false;
+            for(size_t i = 0; (i < keys_count) && !is_duplicate; i++) {
+                is_duplicate = (memcmp(keys[i].data, key.data, sizeof(MfClassicKey)) == 0);
+            }
+            if(!is_duplicate) {
+                keys[keys_count++] = key;
+            }
+        }
+        mf_classic_key_cache_reset(instance->mfc_key_cache);
+    }
+
+    return keys_count;
+}
+
+static void nfc_scene_mf_classic_dict_attack_load_keys(NfcApp* instance, bool use_key_cache) {
+    NfcMfClassicDictAttackContext* mfc_dict = &instance->nfc_dict_context;
+
+    // Keys are served from RAM so that every sector does not rewind and re-read the dictionary
+    // file. Keys cached for this card go first, the dictionary is streamed if it does not fit.
+    size_t dict_keys_total = keys_dict_get_total_keys(mfc_dict->dict);
+    size_t keys_max = dict_keys_total + (use_key_cache ? NFC_DICT_ATTACK_CACHED_KEYS_MAX : 0);
+    size_t keys_size = keys_max * sizeof(MfClassicKey);
+
+    mfc_dict->dict_keys = NULL;
+    mfc_dict->dict_keys_total = dict_keys_total;
+    if(memmgr_heap_get_max_free_block() < keys_size + NFC_DICT_ATTACK_KEYS_HEAP_RESERVE) {
+        FURI_LOG_W(TAG, "Not enough memory for %zu keys, streaming dictionary", keys_max);
+        return;
+    }
+
+    MfClassicKey* keys = malloc(keys_size);
+    size_t cached_keys_count =
+        use_key_cache ? nfc_scene_mf_classic_dict_attack_get_cached_keys(instance, keys) : 0;
+    size_t keys_count = cached_keys_count;
+
+    MfClassicKey key = {};
+    while(keys_dict_get_next_key(mfc_dict->dict, key.data, sizeof(MfClassicKey))) {
+        bool is_duplicate = false;
+        for(size_t i = 0; (i < cached_keys_count) && !is_duplicate; i++) {
+            is_duplicate = (memcmp(keys[i].data, key.data, sizeof(MfClassicKey)) == 0);
+        }
+        if(!is_duplicate && (keys_count < keys_max)) {
+            keys[keys_count++] = key;
+        }
+    }
+    keys_dict_rewind(mfc_dict->dict);
+
+    FURI_LOG_I(TAG, "Loaded %zu keys, %zu from key cache", keys_count, cached_keys_count);
+    mfc_dict->dict_keys = keys;
+    mfc_dict->dict_keys_total = keys_count;
+}
+
+static void nfc_scene_mf_classic_dict_attack_free_dict(NfcApp* instance) {
+    NfcMfClassicDictAttackContext* mfc_dict = &instance->nfc_dict_context;
+
+    if(mfc_dict->dict_keys) {
+        free(mfc_dict->dict_keys);
+        mfc_dict->dict_keys = NULL;
+    }
+    keys_dict_free(mfc_dict->dict);
+}
+
 static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
     uint32_t state =
         scene_manager_get_scene_state(instance->scene_manager, NfcSceneMfClassicDictAttack);
+    bool is_first_dict = (state == DictAttackStateUserDictInProgress);
     if(state == DictAttackStateUserDictInProgress) {
         do {
             if(!keys_dict_check_presence(NFC_APP_MF_CLASSIC_DICT_USER_PATH)) {
@@ -147,8 +243,7 @@ static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
         dict_attack_set_header(instance->dict_attack, "MF Classic System Dictionary");
     }
 
-    instance->nfc_dict_context.dict_keys_total =
-        keys_dict_get_total_keys(instance->nfc_dict_context.dict);
+    nfc_scene_mf_classic_dict_attack_load_keys(instance, is_first_dict);
     dict_attack_set_total_dict_keys(
         instance->dict_attack, instance->nfc_dict_context.dict_keys_total);
     instance->nfc_dict_context.dict_keys_current = 0;
@@ -196,7 +291,7 @@ bool nfc_scene_mf_classic_dict_attack_on_event(void* context, SceneManagerEvent
             if(state == DictAttackStateUserDictInProgress) {
                 nfc_poller_stop(instance->poller);
                 nfc_poller_free(instance->poller);
-                keys_dict_free(instance->nfc_dict_context.dict);
+                nfc_scene_mf_classic_dict_attack_free_dict(instance);
                 scene_manager_set_scene_state(
                     instance->scene_manager,
                     NfcSceneMfClassicDictAttack,
@@ -226,7 +321,7 @@ bool nfc_scene_mf_classic_dict_attack_on_event(void* context, SceneManagerEvent
                 if(instance->nfc_dict_context.is_card_present) {
                     nfc_poller_stop(instance->poller);
                     nfc_poller_free(instance->poller);
-                    keys_dict_free(instance->nfc_dict_context.dict);
+                    nfc_scene_mf_classic_dict_attack_free_dict(instance);
                     scene_manager_set_scene_state(
                         instance->scene_manager,
                         NfcSceneMfClassicDictAttack,
@@ -264,7 +359,7 @@ void nfc_scene_mf_classic_dict_attack_on_exit(void* context) {
     scene_manager_set_scene_state(
         instance->scene_manager, NfcSceneMfClassicDictAttack, DictAttackStateUserDictInProgress);
 
-    keys_dict_free(instance->nfc_dict_context.dict);
+    nfc_scene_mf_classic_dict_attack_free_dict(instance);
 
     instance->nfc_dict_context.current_sector = 0;
     instance->nfc_dict_context.sectors_total = 0;
@@ -0,0 +1,241 @@
+#include "subghz_decode_bench.h"
+
+#include <furi_hal.h>
+#include <storage/storage.h>
+#include <flipper_format/flipper_format.h>
+#include <lib/subghz/receiver.h>
+#include <lib/subghz/registry.h>
+#include <lib/subghz/types.h>
+#include <lib/subghz/subghz_raw_file.h>
+
+#define TAG "SubGhzDecodeBench"
+
+#define SUBGHZ_DECODE_BENCH_EDGES_MAX (32 * 1024)
+#define SUBGHZ_DECODE_BENCH_HEAP_RESERVE (16 * 1024)
+// Cycle counter is read once per block, so timing overhead stays out of the results
+#define SUBGHZ_DECODE_BENCH_BLOCK_SIZE (256)
+
+struct SubGhzDecodeBench {
+    LevelDuration* edges;
+    size_t edge_count;
+    size_t edge_capacity;
+    bool truncated;
+    size_t decoded;
+};
+
+SubGhzDecodeBench* subghz_decode_bench_alloc(void) {
+    SubGhzDecodeBench* instance = malloc(sizeof(SubGhzDecodeBench));
+    instance->edges = NULL;
+    instance->edge_count = 0;
+    instance->edge_capacity = 0;
+    instance->truncated = false;
+    instance->decoded = 0;
+    return instance;
+}
+
+void subghz_decode_bench_free(SubGhzDecodeBench* instance) {
+    furi_assert(instance);
+    free(instance->edges);
+    free(instance);
+}
+
+static bool subghz_decode_bench_reserve(SubGhzDecodeBench* instance) {
+    size_t max_free_block = memmgr_heap_get_max_free_block();
+    if(max_free_block <= SUBGHZ_DECODE_BENCH_HEAP_RESERVE) return false;
+
+    size_t capacity = (max_free_block - SUBGHZ_DECODE_BENCH_HEAP_RESERVE) / sizeof(LevelDuration);
+    if(capacity > SUBGHZ_DECODE_BENCH_EDGES_MAX) capacity = SUBGHZ_DECODE_BENCH_EDGES_MAX;
+    if(capacity == 0) return false;
+
+    instance->edges = malloc(capacity * sizeof(LevelDuration));
+    instance->edge_capacity = capacity;
+    return true;
+}
+
+bool subghz_decode_bench_load(SubGhzDecodeBench* instance, const char* file_path) {
+    furi_assert(instance);
+    furi_assert(file_path);
+
+    free(instance->edges);
+    instance->edges = NULL;
+    instance->edge_count = 0;
+    instance->edge_capacity = 0;
+    instance->truncated = false;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* fff_data_file = flipper_format_buffered_file_alloc(storage);
+    SubGhzRawFileReader* reader = subghz_raw_file_reader_alloc();
+    FuriString* temp_str = furi_string_alloc();
+    uint32_t temp_data32;
+    int32_t* values = NULL;
+
+    do {
+        if(!flipper_format_buffered_file_open_existing(fff_data_file, file_path)) {
+            FURI_LOG_E(TAG, "Error open file %s", file_path);
+            break;
+        }
+
+        if(!flipper_format_read_header(fff_data_file, temp_str, &temp_data32)) {
+            FURI_LOG_E(TAG, "Missing or incorrect header");
+            break;
+        }
+
+        if(strcmp(furi_string_get_cstr(temp_str), SUBGHZ_RAW_FILE_TYPE) != 0 ||
+           temp_data32 != SUBGHZ_KEY_FILE_VERSION) {
+            FURI_LOG_E(TAG, "Type or version mismatch");
+            break;
+        }
+
+        if(!flipper_format_read_string(fff_data_file, "Protocol", temp_str)) {
+            FURI_LOG_E(TAG, "Missing Protocol");
+            break;
+        }
+
+        if(!subghz_raw_file_reader_start(
+               reader, flipper_format_get_raw_stream(fff_data_file))) {
+            FURI_LOG_E(TAG, "Missing RAW_Data");
+            break;
+        }
+
+        if(!subghz_decode_bench_reserve(instance)) {
+            FURI_LOG_E(TAG, "Not enough memory");
+            break;
+        }
+
+        values = malloc(SUBGHZ_RAW_FILE_BLOCK_SAMPLES_MAX * sizeof(int32_t));
+        size_t count;
+        while((count = subghz_raw_file_reader_read(
+                   reader, values, SUBGHZ_RAW_FILE_BLOCK_SAMPLES_MAX))) {
+            for(size_t i = 0; i < count; i++) {
+                if(instance->edge_count == instance->edge_capacity) {
+                    instance->truncated = true;
+                    break;
+                }
+                int32_t value = values[i];
+                instance->edges[instance->edge_count++] =
+                    level_duration_make(value > 0, value > 0 ? value : -value);
+            }
+            if(instance->truncated) break;
+        }
+    } while(false);
+
+    free(values);
+    furi_string_free(temp_str);
+    subghz_raw_file_reader_free(reader);
+    flipper_format_free(fff_data_file);
+    furi_record_close(RECORD_STORAGE);
+
+    return instance->edge_count > 0;
+}
+
+size_t subghz_decode_bench_get_edge_count(SubGhzDecodeBench* instance) {
+    furi_assert(instance);
+    return instance->edge_count;
+}
+
+bool subghz_decode_bench_is_truncated(SubGhzDecodeBench* instance) {
+    furi_assert(instance);
+    return instance->truncated;
+}
+
+static void subghz_decode_bench_rx_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    UNUSED(receiver);
+    SubGhzDecodeBench* instance = context;
+    instance->decoded++;
+    // Same as a reader that consumed the packet, other decoders keep their state
+    decoder_base->protocol->decoder->reset(decoder_base);
+}
+
+static uint64_t subghz_decode_bench_feed_decoder(
+    SubGhzDecodeBench* instance,
+    SubGhzProtocolDecoderBase* decoder) {
+    SubGhzDecoderFeed feed = decoder->protocol->decoder->feed;
+    uint64_t cycles = 0;
+
+    for(size_t i = 0; i < instance->edge_count; i += SUBGHZ_DECODE_BENCH_BLOCK_SIZE) {
+        size_t end = MIN(i + SUBGHZ_DECODE_BENCH_BLOCK_SIZE, instance->edge_count);
+        uint32_t start = DWT->CYCCNT;
+        for(size_t j = i; j < end; j++) {
+            LevelDuration edge = instance->edges[j];
+            feed(decoder, level_duration_get_level(edge), level_duration_get_duration(edge));
+        }
+        cycles += DWT->CYCCNT - start;
+    }
+
+    return cycles;
+}
+
+static uint64_t
+    subghz_decode_bench_feed_receiver(SubGhzDecodeBench* instance, SubGhzReceiver* receiver) {
+    uint64_t cycles = 0;
+
+    for(size_t i = 0; i < instance->edge_count; i += SUBGHZ_DECODE_BENCH_BLOCK_SIZE) {
+        size_t end = MIN(i + SUBGHZ_DECODE_BENCH_BLOCK_SIZE, instance->edge_count);
+        uint32_t start = DWT->CYCCNT;
+        for(size_t j = i; j < end; j++) {
+            LevelDuration edge = instance->edges[j];
+            subghz_receiver_decode(
+                receiver, level_duration_get_level(edge), level_duration_get_duration(edge));
+        }
+        cycles += DWT->CYCCNT - start;
+    }
+
+    return cycles;
+}
+
+void subghz_decode_bench_run(
+    SubGhzDecodeBench* instance,
+    SubGhzEnvironment* environment,
+    bool preclassifier,
+    SubGhzDecodeBenchCallback callback,
+    void* context) {
+    furi_assert(instance);
+    furi_assert(environment);
+    furi_assert(callback);
+
+    const SubGhzProtocolRegistry* registry =
+        subghz_environment_get_protocol_registry(environment);
+    furi_check(registry);
+
+    SubGhzReceiver* receiver = subghz_receiver_alloc_init(environment);
+    subghz_receiver_set_filter(receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_rx_callback(receiver, subghz_decode_bench_rx_callback, instance);
+
+    SubGhzDecodeBenchResult result;
+
+    for(size_t i = 0; i < subghz_protocol_registry_count(registry); i++) {
+        const SubGhzProtocol* protocol = subghz_protocol_registry_get_by_index(registry, i);
+        if(!protocol->decoder || !protocol->decoder->feed) continue;
+        if(!(protocol->flag & SubGhzProtocolFlag_Decodable)) continue;
+
+        SubGhzProtocolDecoderBase* decoder =
+            subghz_receiver_search_decoder_base_by_name(receiver, protocol->name);
+        if(!decoder) continue;
+
+        subghz_receiver_reset(receiver);
+        instance->decoded = 0;
+        size_t free_heap = memmgr_get_free_heap();
+
+        result.name = protocol->name;
+        result.cycles = subghz_decode_bench_feed_decoder(instance, decoder);
+        result.decoded = instance->decoded;
+        result.heap_retained = (int32_t)free_heap - (int32_t)memmgr_get_free_heap();
+        callback(&result, context);
+    }
+
+    subghz_receiver_reset(receiver);
+    subghz_receiver_set_preclassifier(receiver, preclassifier);
+    instance->decoded = 0;
+    size_t free_heap = memmgr_get_free_heap();
+
+    result.name = NULL;
+    result.cycles = subghz_decode_bench_feed_receiver(instance, receiver);
+    result.decoded = instance->decoded;
+    result.heap_retained = (int32_t)free_heap - (int32_t)memmgr_get_free_heap();
+    callback(&result, context);
+
+    subghz_receiver_free(receiver);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <furi.h>
+#include <lib/subghz/environment.h>
+
+typedef struct {
+    const char* name; /**< Protocol name, NULL for the whole receiver */
+    uint64_t cycles; /**< CPU cycles spent in the decoder */
+    size_t decoded; /**< Packets decoded */
+    int32_t heap_retained; /**< Heap bytes not released after the pass */
+} SubGhzDecodeBenchResult;
+
+typedef void (*SubGhzDecodeBenchCallback)(const SubGhzDecodeBenchResult* result, void* context);
+
+typedef struct SubGhzDecodeBench SubGhzDecodeBench;
+
+/** Allocate SubGhzDecodeBench
+ *
+ * @return SubGhzDecodeBench*
+ */
+SubGhzDecodeBench* subghz_decode_bench_alloc(void);
+
+/** Free SubGhzDecodeBench
+ *
+ * @param instance Pointer to a SubGhzDecodeBench
+ */
+void subghz_decode_bench_free(SubGhzDecodeBench* instance);
+
+/** Load RAW file into RAM, so SD card access is not part of the measurement
+ *
+ * @param instance Pointer to a SubGhzDecodeBench
+ * @param file_path Path to a Sub-GHz RAW file
+ * @return true if at least one edge was loaded
+ */
+bool subghz_decode_bench_load(SubGhzDecodeBench* instance, const char* file_path);
+
+/** Get loaded edge count
+ *
+ * @param instance Pointer to a SubGhzDecodeBench
+ * @return size_t edge count
+ */
+size_t subghz_decode_bench_get_edge_count(SubGhzDecodeBench* instance);
+
+/** Check if the file did not fit into RAM and only its beginning was loaded
+ *
+ * @param instance Pointer to a SubGhzDecodeBench
+ * @return true if truncated
+ */
+bool subghz_decode_bench_is_truncated(SubGhzDecodeBench* instance);
+
+/** Replay loaded edges through every decodable protocol one by one, then through the whole receiver
+ *
+ * @param instance Pointer to a SubGhzDecodeBench
+ * @param environment Pointer to a SubGhzEnvironment with the protocol registry set
+ * @param preclassifier Enable receiver pre-classifier for the whole receiver pass
+ * @param callback Called with the result of every pass
+ * @param context Callback context
+ */
+void subghz_decode_bench_run(
+    SubGhzDecodeBench* instance,
+    SubGhzEnvironment* environment,
+    bool preclassifier,
+    SubGhzDecodeBenchCallback callback,
+    void* context);
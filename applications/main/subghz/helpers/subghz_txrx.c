@@ -576,6 +576,11 @@ void subghz_txrx_receiver_set_ignore_filter(
     subghz_receiver_set_ignore_filter(instance->receiver, ignore_filter);
 }
 
+void subghz_txrx_receiver_set_preclassifier(SubGhzTxRx* instance, bool enable) {
+    furi_assert(instance);
+    subghz_receiver_set_preclassifier(instance->receiver, enable);
+}
+
 void subghz_txrx_set_rx_callback(
     SubGhzTxRx* instance,
     SubGhzReceiverCallback callback,
@@ -293,6 +293,15 @@ void subghz_txrx_receiver_set_ignore_filter(
     SubGhzTxRx* instance,
     SubGhzProtocolFilter ignore_filter);
 
+/**
+ * Set pre-classifier, decoders are fed only with plausible edges.
+ * Faster, but parcels right after a pause may be missed.
+ * 
+ * @param instance Pointer to a SubGhzTxRx
+ * @param enable Enable pre-classifier
+ */
+void subghz_txrx_receiver_set_preclassifier(SubGhzTxRx* instance, bool enable);
+
 /**
  * Set callback for receive data
  * 
@@ -53,8 +53,6 @@ static void subghz_scene_add_to_history_callback(
     void* context) {
     furi_assert(context);
     SubGhz* subghz = context;
-    FuriString* item_name = furi_string_alloc();
-    FuriString* item_time = furi_string_alloc();
     uint16_t idx = subghz_history_get_item(subghz->history);
     SubGhzRadioPreset preset = subghz_txrx_get_preset(subghz->txrx);
     preset.latitude = subghz->gps->latitude;
@@ -75,9 +73,6 @@ static void subghz_scene_add_to_history_callback(
     }
 
     if(subghz_history_add_to_history(subghz->history, decoder_base, &preset)) {
-        furi_string_reset(item_name);
-        furi_string_reset(item_time);
-
         subghz->state_notifications = SubGhzNotificationStateRxDone;
 
         if(subghz->remove_duplicates) {
@@ -100,6 +95,8 @@ static void subghz_scene_add_to_history_callback(
             subghz_view_receiver_enable_draw_callback(subghz->subghz_receiver);
         }
 
+        FuriString* item_name = furi_string_alloc();
+        FuriString* item_time = furi_string_alloc();
         subghz_history_get_text_item_menu(subghz->history, item_name, idx);
         subghz_history_get_time_item_menu(subghz->history, item_time, idx);
         subghz_view_receiver_add_item_to_menu(
@@ -108,12 +105,12 @@ static void subghz_scene_add_to_history_callback(
             furi_string_get_cstr(item_time),
             subghz_history_get_type_protocol(subghz->history, idx),
             subghz_history_get_repeats(subghz->history, idx));
+        furi_string_free(item_name);
+        furi_string_free(item_time);
 
         subghz_scene_receiver_update_statusbar(subghz);
     }
     subghz_receiver_reset(receiver);
-    furi_string_free(item_name);
-    furi_string_free(item_time);
 }
 
 bool subghz_scene_decode_raw_start(SubGhz* subghz) {
@@ -126,8 +126,6 @@ static void subghz_scene_add_to_history_callback(
     SubGhz* subghz = context;
 
     SubGhzHistory* history = subghz->history;
-    FuriString* item_name = furi_string_alloc();
-    FuriString* item_time = furi_string_alloc();
     uint16_t idx = subghz_history_get_item(history);
 
     SubGhzRadioPreset preset = subghz_txrx_get_preset(subghz->txrx);
@@ -152,9 +150,6 @@ static void subghz_scene_add_to_history_callback(
     }
 
     if(subghz_history_add_to_history(history, decoder_base, &preset)) {
-        furi_string_reset(item_name);
-        furi_string_reset(item_time);
-
         //If the repeater is on, dont add to the menu, just TX the signal.
         if(subghz->repeater != SubGhzRepeaterStateOff) {
             view_dispatcher_send_custom_event(
@@ -186,6 +181,9 @@ static void subghz_scene_add_to_history_callback(
                 }
             }
 
+            // Repeated parcels are dropped by history, so only new items get menu strings
+            FuriString* item_name = furi_string_alloc();
+            FuriString* item_time = furi_string_alloc();
             subghz_history_get_text_item_menu(history, item_name, idx);
             subghz_history_get_time_item_menu(history, item_time, idx);
             subghz_view_receiver_add_item_to_menu(
@@ -194,6 +192,8 @@ static void subghz_scene_add_to_history_callback(
                 furi_string_get_cstr(item_time),
                 subghz_history_get_type_protocol(history, idx),
                 subghz_history_get_repeats(history, idx));
+            furi_string_free(item_name);
+            furi_string_free(item_time);
 
             if(decoder_base->protocol->flag & SubGhzProtocolFlag_Save &&
                subghz->last_settings->autosave) {
@@ -232,8 +232,6 @@ static void subghz_scene_add_to_history_callback(
         }
     }
     subghz_receiver_reset(receiver);
-    furi_string_free(item_name);
-    furi_string_free(item_time);
     subghz_rx_key_state_set(subghz, SubGhzRxKeyStateAddKey);
 }
 
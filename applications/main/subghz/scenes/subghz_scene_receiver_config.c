@@ -14,6 +14,7 @@ enum SubGhzSettingIndex {
     SubGhzSettingIndexRemoveDuplicates,
     SubGhzSettingIndexDeleteOldSignals,
     SubGhzSettingIndexAutosave,
+    SubGhzSettingIndexPreclassifier,
     SubGhzSettingIndexIgnoreStarline,
     SubGhzSettingIndexIgnoreCars,
     SubGhzSettingIndexIgnoreMagellan,
@@ -366,6 +367,16 @@ static void subghz_scene_receiver_config_set_autosave(VariableItem* item) {
     subghz->last_settings->autosave = index == 1;
 }
 
+static void subghz_scene_receiver_config_set_preclassifier(VariableItem* item) {
+    SubGhz* subghz = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+
+    variable_item_set_current_value_text(item, combobox_text[index]);
+
+    subghz->last_settings->preclassifier = index == 1;
+    subghz_txrx_receiver_set_preclassifier(subghz->txrx, subghz->last_settings->preclassifier);
+}
+
 static inline bool subghz_scene_receiver_config_ignore_filter_get_index(
     SubGhzProtocolFilter filter,
     SubGhzProtocolFilter flag) {
@@ -440,6 +451,8 @@ static void subghz_scene_receiver_config_var_list_enter_callback(void* context,
         subghz->repeater = SubGhzRepeaterStateOff;
         subghz->last_settings->delete_old_signals = false;
         subghz->last_settings->autosave = false;
+        subghz->last_settings->preclassifier = false;
+        subghz_txrx_receiver_set_preclassifier(subghz->txrx, false);
 
         subghz_txrx_speaker_set_state(subghz->txrx, speaker_value[default_index]);
         subghz->last_settings->enable_sound = false;
@@ -570,6 +583,17 @@ void subghz_scene_receiver_config_on_enter(void* context) {
         variable_item_set_current_value_index(item, value_index);
         variable_item_set_current_value_text(item, combobox_text[value_index]);
 
+        item = variable_item_list_add(
+            subghz->variable_item_list,
+            "Fast Decode (may miss signals)",
+            COMBO_BOX_COUNT,
+            subghz_scene_receiver_config_set_preclassifier,
+            subghz);
+
+        value_index = subghz->last_settings->preclassifier;
+        variable_item_set_current_value_index(item, value_index);
+        variable_item_set_current_value_text(item, combobox_text[value_index]);
+
         item = variable_item_list_add(
             subghz->variable_item_list,
             "Ignore Starline",
@@ -235,6 +235,8 @@ SubGhz* subghz_alloc(bool alloc_for_tx_only) {
     }
     subghz_txrx_receiver_set_filter(subghz->txrx, subghz->filter);
     subghz_txrx_receiver_set_ignore_filter(subghz->txrx, subghz->ignore_filter);
+    subghz_txrx_receiver_set_preclassifier(
+        subghz->txrx, !alloc_for_tx_only && subghz->last_settings->preclassifier);
     subghz_txrx_set_need_save_callback(subghz->txrx, subghz_save_to_file, subghz);
 
     if(!alloc_for_tx_only) {
@@ -9,6 +9,7 @@
 #include <lib/subghz/receiver.h>
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
+#include <lib/subghz/protocols/raw.h>
 #include <lib/subghz/protocols/protocol_items.h>
 #include <applications/drivers/subghz/cc1101_ext/cc1101_ext_interconnect.h>
 #include <lib/subghz/devices/cc1101_int/cc1101_int_interconnect.h>
@@ -16,6 +17,7 @@
 #include <lib/subghz/devices/cc1101_configs.h>
 
 #include "helpers/subghz_chat.h"
+#include "helpers/subghz_decode_bench.h"
 
 #include <notification/notification_messages.h>
 #include <flipper_format/flipper_format_i.h>
@@ -316,15 +318,17 @@ void subghz_cli_command_rx(Cli* cli, FuriString* args, void* context) {
     UNUSED(context);
     uint32_t frequency = 433920000;
     uint32_t device_ind = 0; // 0 - CC1101_INT, 1 - CC1101_EXT
+    uint32_t preclassifier = 0;
 
     if(furi_string_size(args)) {
-        int ret = sscanf(furi_string_get_cstr(args), "%lu %lu", &frequency, &device_ind);
-        if(ret != 2) {
+        int ret = sscanf(
+            furi_string_get_cstr(args), "%lu %lu %lu", &frequency, &device_ind, &preclassifier);
+        if(ret != 2 && ret != 3) {
             printf(
                 "sscanf returned %d, frequency: %lu device: %lu\r\n", ret, frequency, device_ind);
             cli_print_usage(
                 "subghz rx",
-                "<Frequency: in Hz> <Device: 0 - CC1101_INT, 1 - CC1101_EXT>",
+                "<Frequency: in Hz> <Device: 0 - CC1101_INT, 1 - CC1101_EXT> <Preclassifier: 0 - off, 1 - on>",
                 furi_string_get_cstr(args));
             return;
         }
@@ -349,6 +353,7 @@ void subghz_cli_command_rx(Cli* cli, FuriString* args, void* context) {
 
     SubGhzReceiver* receiver = subghz_receiver_alloc_init(environment);
     subghz_receiver_set_filter(receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_preclassifier(receiver, preclassifier != 0);
     subghz_receiver_set_rx_callback(receiver, subghz_cli_command_rx_callback, instance);
 
     // Configure radio
@@ -486,13 +491,28 @@ void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
     FlipperFormat* fff_data_file = flipper_format_file_alloc(storage);
     FuriString* temp_str = furi_string_alloc();
     uint32_t temp_data32;
+    uint32_t preclassifier = 0;
     bool check_file = false;
 
     do {
         if(furi_string_size(args)) {
             if(!args_read_string_and_trim(args, file_name)) {
                 cli_print_usage(
-                    "subghz decode_raw", "<file_name: path_RAW_file>", furi_string_get_cstr(args));
+                    "subghz decode_raw",
+                    "<file_name: path_RAW_file> <Preclassifier: 0 - off, 1 - on>",
+                    furi_string_get_cstr(args));
+                break;
+            }
+        }
+
+        if(furi_string_size(args)) {
+            int ret = sscanf(furi_string_get_cstr(args), "%lu", &preclassifier);
+            if(ret != 1) {
+                printf("sscanf returned %d, preclassifier: %lu\r\n", ret, preclassifier);
+                cli_print_usage(
+                    "subghz decode_raw",
+                    "<file_name: path_RAW_file> <Preclassifier: 0 - off, 1 - on>",
+                    furi_string_get_cstr(args));
                 break;
             }
         }
@@ -531,6 +551,7 @@ void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
 
         SubGhzReceiver* receiver = subghz_receiver_alloc_init(environment);
         subghz_receiver_set_filter(receiver, SubGhzProtocolFlag_Decodable);
+        subghz_receiver_set_preclassifier(receiver, preclassifier != 0);
         subghz_receiver_set_rx_callback(receiver, subghz_cli_command_rx_callback, instance);
 
         SubGhzFileEncoderWorker* file_worker_encoder = subghz_file_encoder_worker_alloc();
@@ -545,13 +566,18 @@ void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
             furi_string_get_cstr(file_name));
 
         LevelDuration level_duration;
+        size_t edge_count = 0;
+        uint64_t decode_cycles = 0;
         while(!cli_cmd_interrupt_received(cli)) {
             furi_delay_us(500); //you need to have time to read from the file from the SD card
             level_duration = subghz_file_encoder_worker_get_level_duration(file_worker_encoder);
             if(!level_duration_is_reset(level_duration)) {
                 bool level = level_duration_get_level(level_duration);
                 uint32_t duration = level_duration_get_duration(level_duration);
+                uint32_t decode_start = DWT->CYCCNT;
                 subghz_receiver_decode(receiver, level, duration);
+                decode_cycles += DWT->CYCCNT - decode_start;
+                edge_count++;
             } else {
                 break;
             }
@@ -559,6 +585,16 @@ void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
 
         printf("\r\nPackets received \033[0;32m%zu\033[0m\r\n", instance->packet_count);
 
+        // Decoding throughput, time spent waiting for the SD card is excluded
+        uint32_t decode_time_us =
+            (uint32_t)(decode_cycles / furi_hal_cortex_instructions_per_microsecond());
+        printf(
+            "Edges %zu, decode time %lu us, %lu edges/s, preclassifier %s\r\n",
+            edge_count,
+            decode_time_us,
+            decode_time_us ? (uint32_t)((uint64_t)edge_count * 1000000 / decode_time_us) : 0,
+            preclassifier ? "on" : "off");
+
         // Cleanup
         subghz_receiver_free(receiver);
         subghz_environment_free(environment);
@@ -572,6 +608,201 @@ void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
     furi_string_free(file_name);
 }
 
+typedef struct {
+    size_t edge_count;
+    uint32_t cycles_per_us;
+} SubGhzCliCommandDecodeBench;
+
+static void subghz_cli_command_decode_bench_callback(
+    const SubGhzDecodeBenchResult* result,
+    void* context) {
+    SubGhzCliCommandDecodeBench* instance = context;
+
+    uint32_t time_us = (uint32_t)(result->cycles / instance->cycles_per_us);
+    printf(
+        "%-24s %10lu %12lu %8zu %8ld\r\n",
+        result->name ? result->name : "Receiver",
+        time_us,
+        time_us ? (uint32_t)((uint64_t)instance->edge_count * 1000000 / time_us) : 0,
+        result->decoded,
+        result->heap_retained);
+}
+
+static void subghz_cli_command_decode_bench(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+    FuriString* file_name = furi_string_alloc();
+    furi_string_set(file_name, ANY_PATH("subghz/test.sub"));
+    uint32_t preclassifier = 0;
+
+    do {
+        if(furi_string_size(args)) {
+            if(!args_read_string_and_trim(args, file_name) ||
+               (furi_string_size(args) &&
+                sscanf(furi_string_get_cstr(args), "%lu", &preclassifier) != 1)) {
+                cli_print_usage(
+                    "subghz decode_bench",
+                    "<file_name: path_RAW_file> <Preclassifier: 0 - off, 1 - on>",
+                    furi_string_get_cstr(args));
+                break;
+            }
+        }
+
+        SubGhzDecodeBench* bench = subghz_decode_bench_alloc();
+        if(!subghz_decode_bench_load(bench, furi_string_get_cstr(file_name))) {
+            printf(
+                "subghz decode_bench \033[0;31mError loading RAW file\033[0m %s\r\n",
+                furi_string_get_cstr(file_name));
+            subghz_decode_bench_free(bench);
+            break;
+        }
+
+        SubGhzCliCommandDecodeBench instance = {
+            .edge_count = subghz_decode_bench_get_edge_count(bench),
+            .cycles_per_us = furi_hal_cortex_instructions_per_microsecond(),
+        };
+        printf(
+            "Edges %zu%s, preclassifier %s\r\n\r\n",
+            instance.edge_count,
+            subghz_decode_bench_is_truncated(bench) ? " (truncated)" : "",
+            preclassifier ? "on" : "off");
+        printf(
+            "%-24s %10s %12s %8s %8s\r\n", "Protocol", "Time, us", "Edges/s", "Decoded", "Heap");
+
+        SubGhzEnvironment* environment = subghz_cli_environment_init();
+        subghz_decode_bench_run(
+            bench,
+            environment,
+            preclassifier != 0,
+            subghz_cli_command_decode_bench_callback,
+            &instance);
+        subghz_environment_free(environment);
+
+        subghz_decode_bench_free(bench);
+    } while(false);
+
+    furi_string_free(file_name);
+}
+
+static void subghz_cli_command_raw_convert(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+    FuriString* source = furi_string_alloc();
+    FuriString* destination = furi_string_alloc();
+    FuriString* format_name = furi_string_alloc();
+    SubGhzRawFileFormat format;
+
+    do {
+        if(!args_read_string_and_trim(args, source) ||
+           !args_read_string_and_trim(args, destination) ||
+           !args_read_string_and_trim(args, format_name) ||
+           !subghz_raw_file_format_from_name(furi_string_get_cstr(format_name), &format) ||
+           furi_string_cmp(source, destination) == 0) {
+            cli_print_usage(
+                "subghz raw_convert",
+                "<path_RAW_file> <path_converted_file> <format: Text, Varint, Heatshrink>",
+                furi_string_get_cstr(args));
+            break;
+        }
+
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        if(subghz_protocol_raw_convert_file(
+               storage,
+               furi_string_get_cstr(source),
+               furi_string_get_cstr(destination),
+               format)) {
+            printf("Converted to %s\r\n", subghz_raw_file_format_get_name(format));
+        } else {
+            printf(
+                "subghz raw_convert \033[0;31mError converting RAW file\033[0m %s\r\n",
+                furi_string_get_cstr(source));
+        }
+        furi_record_close(RECORD_STORAGE);
+    } while(false);
+
+    furi_string_free(source);
+    furi_string_free(destination);
+    furi_string_free(format_name);
+}
+
+#define SUBGHZ_CLI_RAW_BENCH_PATH ANY_PATH("subghz/.raw_bench.sub")
+
+static size_t subghz_cli_raw_bench_read(Storage* storage, const char* path, int32_t* samples) {
+    FlipperFormat* fff_data_file = flipper_format_buffered_file_alloc(storage);
+    SubGhzRawFileReader* reader = subghz_raw_file_reader_alloc();
+    FuriString* temp_str = furi_string_alloc();
+    size_t sample_count = 0;
+
+    if(flipper_format_buffered_file_open_existing(fff_data_file, path) &&
+       flipper_format_read_string(fff_data_file, "Protocol", temp_str) &&
+       subghz_raw_file_reader_start(reader, flipper_format_get_raw_stream(fff_data_file))) {
+        size_t count;
+        while((count = subghz_raw_file_reader_read(
+                   reader, samples, SUBGHZ_RAW_FILE_BLOCK_SAMPLES_MAX))) {
+            sample_count += count;
+        }
+    }
+
+    furi_string_free(temp_str);
+    subghz_raw_file_reader_free(reader);
+    flipper_format_free(fff_data_file);
+    return sample_count;
+}
+
+static void subghz_cli_command_raw_bench(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+    FuriString* file_name = furi_string_alloc();
+    furi_string_set(file_name, ANY_PATH("subghz/test.sub"));
+
+    do {
+        if(furi_string_size(args) && !args_read_string_and_trim(args, file_name)) {
+            cli_print_usage(
+                "subghz raw_bench", "<file_name: path_RAW_file>", furi_string_get_cstr(args));
+            break;
+        }
+
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        int32_t* samples = malloc(SUBGHZ_RAW_FILE_BLOCK_SAMPLES_MAX * sizeof(int32_t));
+        printf(
+            "%-12s %10s %10s %8s %12s\r\n", "Format", "Samples", "Size", "Time, ms", "Samples/s");
+
+        for(SubGhzRawFileFormat format = SubGhzRawFileFormatText;
+            format <= SubGhzRawFileFormatHeatshrink;
+            format++) {
+            if(!subghz_protocol_raw_convert_file(
+                   storage, furi_string_get_cstr(file_name), SUBGHZ_CLI_RAW_BENCH_PATH, format)) {
+                printf(
+                    "subghz raw_bench \033[0;31mError converting RAW file\033[0m %s\r\n",
+                    furi_string_get_cstr(file_name));
+                break;
+            }
+
+            FileInfo file_info = {};
+            storage_common_stat(storage, SUBGHZ_CLI_RAW_BENCH_PATH, &file_info);
+
+            uint32_t start = furi_get_tick();
+            size_t sample_count =
+                subghz_cli_raw_bench_read(storage, SUBGHZ_CLI_RAW_BENCH_PATH, samples);
+            uint32_t time_ms = furi_get_tick() - start;
+
+            printf(
+                "%-12s %10zu %10lu %8lu %12lu\r\n",
+                subghz_raw_file_format_get_name(format),
+                sample_count,
+                (uint32_t)file_info.size,
+                time_ms,
+                time_ms ? (uint32_t)((uint64_t)sample_count * 1000 / time_ms) : 0);
+        }
+
+        storage_simply_remove(storage, SUBGHZ_CLI_RAW_BENCH_PATH);
+        free(samples);
+        furi_record_close(RECORD_STORAGE);
+    } while(false);
+
+    furi_string_free(file_name);
+}
+
 static FuriHalSubGhzPreset subghz_cli_get_preset_name(const char* preset_name) {
     FuriHalSubGhzPreset preset = FuriHalSubGhzPresetIDLE;
     if(!strcmp(preset_name, "FuriHalSubGhzPresetOok270Async")) {
@@ -842,9 +1073,17 @@ static void subghz_cli_command_print_usage(void) {
         "\tchat <frequency:in Hz> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Chat with other Flippers\r\n");
     printf(
         "\ttx <3 byte Key: in hex> <frequency: in Hz> <te: us> <repeat: count> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Transmitting key\r\n");
-    printf("\trx <frequency:in Hz> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Receive\r\n");
+    printf(
+        "\trx <frequency:in Hz> <device: 0 - CC1101_INT, 1 - CC1101_EXT> <Preclassifier: 0 - off, 1 - on>\t - Receive\r\n");
     printf("\trx_raw <frequency:in Hz>\t - Receive RAW\r\n");
-    printf("\tdecode_raw <file_name: path_RAW_file>\t - Testing\r\n");
+    printf(
+        "\tdecode_raw <file_name: path_RAW_file> <Preclassifier: 0 - off, 1 - on>\t - Testing\r\n");
+    printf(
+        "\tdecode_bench <file_name: path_RAW_file> <Preclassifier: 0 - off, 1 - on>\t - Decoders throughput\r\n");
+    printf(
+        "\traw_convert <path_RAW_file> <path_converted_file> <format: Text, Varint, Heatshrink>\t - Convert RAW samples format\r\n");
+    printf(
+        "\traw_bench <file_name: path_RAW_file>\t - RAW samples formats size and read speed\r\n");
     printf(
         "\ttx_from_file <file_name: path_file> <repeat: count> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Transmitting from file\r\n");
 
@@ -1159,6 +1398,21 @@ static void subghz_cli_command(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "decode_bench") == 0) {
+            subghz_cli_command_decode_bench(cli, args, context);
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "raw_convert") == 0) {
+            subghz_cli_command_raw_convert(cli, args, context);
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "raw_bench") == 0) {
+            subghz_cli_command_raw_bench(cli, args, context);
+            break;
+        }
+
         if(furi_string_cmp_str(cmd, "tx_from_file") == 0) {
             subghz_cli_command_tx_from_file(cli, args, context);
             break;
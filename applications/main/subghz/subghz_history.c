@@ -1,34 +1,63 @@
 #include "subghz_history.h"
 #include <lib/subghz/receiver.h>
 #include <rpc/rpc.h>
+#include <storage/storage.h>
+#include <datetime/datetime.h>
 
 #include <furi.h>
 
 #define SUBGHZ_HISTORY_MAX 65535 // uint16_t index max, ram limit below
-#define SUBGHZ_HISTORY_FREE_HEAP (10240 * (3 - MIN(rpc_get_sessions_count(instance->rpc), 2U)))
+#define SUBGHZ_HISTORY_HEAP_FACTOR (3 - MIN(rpc_get_sessions_count(instance->rpc), 2U))
+// Below this, data of new items goes to the log on SD card
+#define SUBGHZ_HISTORY_SPILL_HEAP (10240 * SUBGHZ_HISTORY_HEAP_FACTOR)
+// Below this, even records do not fit
+#define SUBGHZ_HISTORY_FREE_HEAP (4096 * SUBGHZ_HISTORY_HEAP_FACTOR)
+#define SUBGHZ_HISTORY_LOG_PATH EXT_PATH("subghz/.history.log")
+#define SUBGHZ_HISTORY_LOG_BUFFER_SIZE (64U)
+#define SUBGHZ_HISTORY_INTERNED_MAX (UINT8_MAX)
+#define SUBGHZ_HISTORY_INTERNED_NONE (UINT8_MAX)
 #define TAG "SubGhzHistory"
 
 typedef struct {
-    FuriString* item_str;
-    FlipperFormat* flipper_string;
-    uint8_t type;
-    SubGhzRadioPreset* preset;
-    DateTime datetime;
-    uint32_t hash_data;
-    const SubGhzProtocol* protocol;
-    uint16_t repeats;
+    SubGhzProtocolDecoderResult result; ///< Menu text is formatted from it on request
+    uint32_t timestamp;
+    uint32_t frequency;
     float latitude;
     float longitude;
+    uint8_t* data; ///< Serialized data, NULL if it was spilled to the log
+    uint32_t log_offset;
+    uint16_t data_size;
+    uint16_t repeats;
+    uint8_t preset_id;
+    uint8_t manufacture_id;
 } SubGhzHistoryItem;
 
-ARRAY_DEF(SubGhzHistoryItemArray, SubGhzHistoryItem, M_POD_OPLIST)
+ARRAY_DEF(SubGhzHistoryItemArray, SubGhzHistoryItem*, M_PTR_OPLIST)
+
+#define M_OPL_SubGhzHistoryItemArray_t() ARRAY_OPLIST(SubGhzHistoryItemArray, M_PTR_OPLIST)
+
+typedef struct {
+    FuriString* name;
+    uint8_t* data;
+    size_t data_size;
+} SubGhzHistoryPreset;
 
-#define M_OPL_SubGhzHistoryItemArray_t() ARRAY_OPLIST(SubGhzHistoryItemArray, M_POD_OPLIST)
+ARRAY_DEF(SubGhzHistoryPresetArray, SubGhzHistoryPreset, M_POD_OPLIST)
+ARRAY_DEF(SubGhzHistoryStringArray, FuriString*, FURI_STRING_OPLIST)
 
 typedef struct {
     SubGhzHistoryItemArray_t data;
+    SubGhzHistoryPresetArray_t presets; ///< Shared by items, there are only a few of them
+    SubGhzHistoryStringArray_t manufactures; ///< Same
 } SubGhzHistoryStruct;
 
+typedef enum {
+    SubGhzHistoryLogStateClosed,
+    SubGhzHistoryLogStateOpen,
+    SubGhzHistoryLogStateReadOnly, ///< Write failed, spilled items are still readable
+    SubGhzHistoryLogStateFailed,
+} SubGhzHistoryLogState;
+
 struct SubGhzHistory {
     uint32_t last_update_timestamp;
     uint16_t last_index_write;
@@ -36,6 +65,16 @@ struct SubGhzHistory {
     FuriString* tmp_string;
     SubGhzHistoryStruct* history;
     Rpc* rpc;
+
+    FlipperFormat* serialize_data; ///< New item is serialized here, before it is stored
+    FlipperFormat* raw_data; ///< Item data is loaded here when it is requested
+    SubGhzHistoryItem* raw_data_item; ///< Item loaded into raw_data
+    SubGhzRadioPreset preset;
+
+    Storage* storage;
+    File* log;
+    SubGhzHistoryLogState log_state;
+    uint32_t log_size;
 };
 
 SubGhzHistory* subghz_history_alloc(void) {
@@ -43,87 +82,176 @@ SubGhzHistory* subghz_history_alloc(void) {
     instance->tmp_string = furi_string_alloc();
     instance->history = malloc(sizeof(SubGhzHistoryStruct));
     SubGhzHistoryItemArray_init(instance->history->data);
+    SubGhzHistoryPresetArray_init(instance->history->presets);
+    SubGhzHistoryStringArray_init(instance->history->manufactures);
     instance->rpc = furi_record_open(RECORD_RPC);
+
+    instance->serialize_data = flipper_format_string_alloc();
+    instance->raw_data = flipper_format_string_alloc();
+    instance->raw_data_item = NULL;
+    instance->preset.name = furi_string_alloc();
+
+    instance->storage = furi_record_open(RECORD_STORAGE);
+    instance->log = storage_file_alloc(instance->storage);
+    instance->log_state = SubGhzHistoryLogStateClosed;
+    instance->log_size = 0;
     return instance;
 }
 
-void subghz_history_free(SubGhzHistory* instance) {
-    furi_assert(instance);
-    furi_string_free(instance->tmp_string);
+static void subghz_history_log_close(SubGhzHistory* instance) {
+    if(instance->log_state == SubGhzHistoryLogStateOpen ||
+       instance->log_state == SubGhzHistoryLogStateReadOnly) {
+        storage_file_close(instance->log);
+        storage_simply_remove(instance->storage, SUBGHZ_HISTORY_LOG_PATH);
+    }
+    instance->log_state = SubGhzHistoryLogStateClosed;
+    instance->log_size = 0;
+}
+
+static bool subghz_history_log_open(SubGhzHistory* instance) {
+    if(instance->log_state == SubGhzHistoryLogStateClosed) {
+        if(storage_file_open(
+               instance->log, SUBGHZ_HISTORY_LOG_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS)) {
+            instance->log_state = SubGhzHistoryLogStateOpen;
+        } else {
+            FURI_LOG_E(TAG, "Unable to open log");
+            storage_file_close(instance->log);
+            instance->log_state = SubGhzHistoryLogStateFailed;
+        }
+    }
+
+    return instance->log_state == SubGhzHistoryLogStateOpen;
+}
+
+static bool subghz_history_log_append(SubGhzHistory* instance, Stream* stream, size_t size) {
+    uint8_t buffer[SUBGHZ_HISTORY_LOG_BUFFER_SIZE];
+
+    bool result = storage_file_seek(instance->log, instance->log_size, true);
+    for(size_t copied = 0; result && copied < size;) {
+        size_t chunk = MIN(size - copied, sizeof(buffer));
+        result = stream_read(stream, buffer, chunk) == chunk &&
+                 storage_file_write(instance->log, buffer, chunk) == chunk;
+        copied += chunk;
+    }
+
+    if(result) {
+        instance->log_size += size;
+    } else {
+        FURI_LOG_E(TAG, "Unable to write log");
+        instance->log_state = SubGhzHistoryLogStateReadOnly;
+    }
+
+    return result;
+}
+
+static void subghz_history_item_free(SubGhzHistory* instance, SubGhzHistoryItem* item) {
+    if(instance->raw_data_item == item) instance->raw_data_item = NULL;
+    free(item->data);
+    free(item);
+}
+
+static void subghz_history_clear_items(SubGhzHistory* instance) {
     for
         M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
+            subghz_history_item_free(instance, *item);
+        }
+    SubGhzHistoryItemArray_reset(instance->history->data);
+
+    for
+        M_EACH(preset, instance->history->presets, SubGhzHistoryPresetArray_t) {
+            furi_string_free(preset->name);
         }
+    SubGhzHistoryPresetArray_reset(instance->history->presets);
+    SubGhzHistoryStringArray_reset(instance->history->manufactures);
+
+    subghz_history_log_close(instance);
+}
+
+void subghz_history_free(SubGhzHistory* instance) {
+    furi_assert(instance);
+    furi_string_free(instance->tmp_string);
+    subghz_history_clear_items(instance);
     SubGhzHistoryItemArray_clear(instance->history->data);
+    SubGhzHistoryPresetArray_clear(instance->history->presets);
+    SubGhzHistoryStringArray_clear(instance->history->manufactures);
     free(instance->history);
+
+    flipper_format_free(instance->serialize_data);
+    flipper_format_free(instance->raw_data);
+    furi_string_free(instance->preset.name);
+
+    storage_file_free(instance->log);
+    furi_record_close(RECORD_STORAGE);
     furi_record_close(RECORD_RPC);
     free(instance);
 }
 
+static inline SubGhzHistoryItem* subghz_history_get(SubGhzHistory* instance, uint16_t idx) {
+    return *SubGhzHistoryItemArray_get(instance->history->data, idx);
+}
+
 uint32_t subghz_history_get_hash_data(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->hash_data;
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    return item->result.hash;
 }
 
 const SubGhzProtocol* subghz_history_get_protocol(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->protocol;
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    return item->result.protocol;
 }
 
 uint16_t subghz_history_get_repeats(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
     return item->repeats;
 }
 
 uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset->frequency;
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    return item->frequency;
 }
 
 SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset;
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    const SubGhzHistoryPreset* preset =
+        SubGhzHistoryPresetArray_cget(instance->history->presets, item->preset_id);
+
+    furi_string_set(instance->preset.name, preset->name);
+    instance->preset.frequency = item->frequency;
+    instance->preset.data = preset->data;
+    instance->preset.data_size = preset->data_size;
+    instance->preset.latitude = item->latitude;
+    instance->preset.longitude = item->longitude;
+    return &instance->preset;
 }
 
 const char* subghz_history_get_preset(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return furi_string_get_cstr(item->preset->name);
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    return furi_string_get_cstr(
+        SubGhzHistoryPresetArray_cget(instance->history->presets, item->preset_id)->name);
 }
 
 float subghz_history_get_latitude(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
     return item->latitude;
 }
 
 float subghz_history_get_longitude(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
     return item->longitude;
 }
 
 void subghz_history_reset(SubGhzHistory* instance) {
     furi_assert(instance);
     furi_string_reset(instance->tmp_string);
-    for
-        M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
-        }
-    SubGhzHistoryItemArray_reset(instance->history->data);
+    subghz_history_clear_items(instance);
     instance->last_index_write = 0;
     instance->code_last_hash_data = 0;
 }
@@ -132,12 +260,8 @@ void subghz_history_delete_item(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
 
     if(idx < SubGhzHistoryItemArray_size(instance->history->data)) {
-        SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-        furi_string_free(item->item_str);
-        furi_string_free(item->preset->name);
-        free(item->preset);
-        flipper_format_free(item->flipper_string);
-        item->type = 0;
+        // Log is append only, spilled data stays there until reset
+        subghz_history_item_free(instance, subghz_history_get(instance, idx));
         SubGhzHistoryItemArray_remove_v(instance->history->data, idx, idx + 1);
         instance->last_index_write--;
     }
@@ -150,45 +274,132 @@ uint16_t subghz_history_get_item(SubGhzHistory* instance) {
 
 uint8_t subghz_history_get_type_protocol(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->type;
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    return item->result.protocol->type;
 }
 
 const char* subghz_history_get_protocol_name(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    if(!item || !item->flipper_string) {
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    if(!item || !item->result.protocol) {
         FURI_LOG_E(TAG, "Missing Item");
-        furi_string_reset(instance->tmp_string);
-        return furi_string_get_cstr(instance->tmp_string);
+        return "";
     }
-    flipper_format_rewind(item->flipper_string);
-    if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
-        FURI_LOG_E(TAG, "Missing Protocol");
-        furi_string_reset(instance->tmp_string);
-    }
-    return furi_string_get_cstr(instance->tmp_string);
+    return item->result.protocol->name;
 }
 
 DateTime subghz_history_get_datetime(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    DateTime datetime = {};
     if(item) {
-        return item->datetime;
-    } else {
-        return (DateTime){};
+        datetime_timestamp_to_datetime(item->timestamp, &datetime);
+    }
+    return datetime;
+}
+
+static bool subghz_history_load_raw_data(SubGhzHistory* instance, SubGhzHistoryItem* item) {
+    Stream* stream = flipper_format_get_raw_stream(instance->raw_data);
+    stream_clean(stream);
+
+    if(item->data) {
+        return stream_write(stream, item->data, item->data_size) == item->data_size;
+    }
+
+    uint8_t buffer[SUBGHZ_HISTORY_LOG_BUFFER_SIZE];
+    bool result = (instance->log_state == SubGhzHistoryLogStateOpen ||
+                   instance->log_state == SubGhzHistoryLogStateReadOnly) &&
+                  storage_file_seek(instance->log, item->log_offset, true);
+    for(size_t copied = 0; result && copied < item->data_size;) {
+        size_t chunk = MIN(item->data_size - copied, sizeof(buffer));
+        result = storage_file_read(instance->log, buffer, chunk) == chunk &&
+                 stream_write(stream, buffer, chunk) == chunk;
+        copied += chunk;
+    }
+
+    return result;
+}
+
+static bool subghz_history_raw_data_changed(SubGhzHistory* instance, SubGhzHistoryItem* item) {
+    Stream* stream = flipper_format_get_raw_stream(instance->raw_data);
+    if(stream_size(stream) != item->data_size || !stream_rewind(stream)) return true;
+
+    uint8_t buffer[SUBGHZ_HISTORY_LOG_BUFFER_SIZE];
+    uint8_t stored[SUBGHZ_HISTORY_LOG_BUFFER_SIZE];
+    if(!item->data && !storage_file_seek(instance->log, item->log_offset, true)) return true;
+    for(size_t compared = 0; compared < item->data_size;) {
+        size_t chunk = MIN(item->data_size - compared, sizeof(buffer));
+        if(stream_read(stream, buffer, chunk) != chunk) return true;
+        if(item->data) {
+            memcpy(stored, &item->data[compared], chunk);
+        } else if(storage_file_read(instance->log, stored, chunk) != chunk) {
+            return true;
+        }
+        if(memcmp(buffer, stored, chunk) != 0) return true;
+        compared += chunk;
+    }
+
+    return false;
+}
+
+// Rolling code encoders update the counter in raw_data, it must survive loading another item
+static void subghz_history_store_raw_data(SubGhzHistory* instance, SubGhzHistoryItem* item) {
+    if(!subghz_history_raw_data_changed(instance, item)) return;
+
+    Stream* stream = flipper_format_get_raw_stream(instance->raw_data);
+    size_t size = stream_size(stream);
+    if(size > UINT16_MAX || !stream_rewind(stream)) {
+        FURI_LOG_E(TAG, "Unable to store item changes");
+        return;
+    }
+
+    // Spilled item stays spilled, log is append only
+    if(!item->data && instance->log_state == SubGhzHistoryLogStateOpen) {
+        uint32_t log_offset = instance->log_size;
+        if(subghz_history_log_append(instance, stream, size)) {
+            item->log_offset = log_offset;
+            item->data_size = size;
+            return;
+        }
+        if(!stream_rewind(stream)) return;
+    }
+
+    item->data = realloc(item->data, size); //-V701
+    item->data_size = size;
+    if(stream_read(stream, item->data, size) != size) {
+        FURI_LOG_E(TAG, "Unable to store item changes");
     }
 }
 
 FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    if(item->flipper_string) {
-        return item->flipper_string;
-    } else {
-        return NULL;
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+
+    if(instance->raw_data_item != item) {
+        if(instance->raw_data_item) {
+            subghz_history_store_raw_data(instance, instance->raw_data_item);
+        }
+        instance->raw_data_item = NULL;
+        if(subghz_history_load_raw_data(instance, item)) {
+            instance->raw_data_item = item;
+        } else {
+            FURI_LOG_E(TAG, "Unable to load item %u", idx);
+            stream_clean(flipper_format_get_raw_stream(instance->raw_data));
+        }
     }
+
+    flipper_format_rewind(instance->raw_data);
+    return instance->raw_data;
 }
+
+static bool subghz_history_memory_full(SubGhzHistory* instance) {
+    size_t free_heap = memmgr_get_free_heap();
+    if(free_heap < SUBGHZ_HISTORY_FREE_HEAP) return true;
+    // Without SD card history is as large as the heap allows
+    if(free_heap < SUBGHZ_HISTORY_SPILL_HEAP && !subghz_history_log_open(instance)) return true;
+    return false;
+}
+
 bool subghz_history_get_text_space_left(
     SubGhzHistory* instance,
     FuriString* output,
@@ -196,7 +407,7 @@ bool subghz_history_get_text_space_left(
     bool ignore_full) {
     furi_assert(instance);
     if(!ignore_full) {
-        if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) {
+        if(subghz_history_memory_full(instance)) {
             if(output != NULL) furi_string_printf(output, "    Memory is FULL");
             return true;
         }
@@ -223,14 +434,95 @@ uint16_t subghz_history_get_last_index(SubGhzHistory* instance) {
     return instance->last_index_write;
 }
 void subghz_history_get_text_item_menu(SubGhzHistory* instance, FuriString* output, uint16_t idx) {
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    furi_string_set(output, item->item_str);
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    const char* protocol_name = item->result.protocol->name;
+    bool is_keeloq = !strcmp(protocol_name, "KeeLoq");
+    bool is_star_line = !strcmp(protocol_name, "Star Line");
+
+    if(is_keeloq || is_star_line) {
+        // Manufacture is only known after serialization, it was taken from the stored data
+        furi_string_set(output, is_keeloq ? "KL " : "SL ");
+        if(item->manufacture_id == SUBGHZ_HISTORY_INTERNED_NONE) {
+            FURI_LOG_E(TAG, "Missing Manufacture");
+            return;
+        }
+        furi_string_cat(
+            output,
+            *SubGhzHistoryStringArray_cget(instance->history->manufactures, item->manufacture_id));
+    } else {
+        furi_string_set(output, protocol_name);
+    }
+
+    uint64_t data = item->result.key;
+    if(data != 0) {
+        if(!(uint32_t)(data >> 32)) {
+            furi_string_cat_printf(output, " %lX", (uint32_t)(data & 0xFFFFFFFF));
+        } else {
+            furi_string_cat_printf(
+                output, " %lX%08lX", (uint32_t)(data >> 32), (uint32_t)(data & 0xFFFFFFFF));
+        }
+    }
 }
 
 void subghz_history_get_time_item_menu(SubGhzHistory* instance, FuriString* output, uint16_t idx) {
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    DateTime* t = &item->datetime;
-    furi_string_printf(output, "%.2d:%.2d:%.2d ", t->hour, t->minute, t->second);
+    DateTime t = subghz_history_get_datetime(instance, idx);
+    furi_string_printf(output, "%.2d:%.2d:%.2d ", t.hour, t.minute, t.second);
+}
+
+static bool
+    subghz_history_intern_preset(SubGhzHistory* instance, SubGhzRadioPreset* preset, uint8_t* id) {
+    size_t count = SubGhzHistoryPresetArray_size(instance->history->presets);
+    for(size_t i = 0; i < count; i++) {
+        const SubGhzHistoryPreset* interned =
+            SubGhzHistoryPresetArray_cget(instance->history->presets, i);
+        if(interned->data == preset->data && interned->data_size == preset->data_size &&
+           furi_string_equal(interned->name, preset->name)) {
+            *id = i;
+            return true;
+        }
+    }
+
+    if(count == SUBGHZ_HISTORY_INTERNED_MAX) return false;
+
+    SubGhzHistoryPreset* interned = SubGhzHistoryPresetArray_push_raw(instance->history->presets);
+    interned->name = furi_string_alloc_set(preset->name);
+    interned->data = preset->data;
+    interned->data_size = preset->data_size;
+    *id = count;
+    return true;
+}
+
+static uint8_t subghz_history_intern_manufacture(SubGhzHistory* instance, FuriString* name) {
+    size_t count = SubGhzHistoryStringArray_size(instance->history->manufactures);
+    for(size_t i = 0; i < count; i++) {
+        if(furi_string_equal(
+               *SubGhzHistoryStringArray_cget(instance->history->manufactures, i), name)) {
+            return i;
+        }
+    }
+
+    if(count == SUBGHZ_HISTORY_INTERNED_MAX) return SUBGHZ_HISTORY_INTERNED_NONE;
+
+    SubGhzHistoryStringArray_push_back(instance->history->manufactures, name);
+    return count;
+}
+
+static bool subghz_history_store_data(SubGhzHistory* instance, SubGhzHistoryItem* item) {
+    Stream* stream = flipper_format_get_raw_stream(instance->serialize_data);
+    size_t size = stream_size(stream);
+    if(size > UINT16_MAX || !stream_rewind(stream)) return false;
+
+    item->data = NULL;
+    item->data_size = size;
+
+    if(memmgr_get_free_heap() < SUBGHZ_HISTORY_SPILL_HEAP && subghz_history_log_open(instance)) {
+        item->log_offset = instance->log_size;
+        if(subghz_history_log_append(instance, stream, size)) return true;
+        if(!stream_rewind(stream)) return false;
+    }
+
+    item->data = malloc(size);
+    return stream_read(stream, item->data, size) == size;
 }
 
 bool subghz_history_add_to_history(
@@ -254,8 +546,8 @@ bool subghz_history_add_to_history(
     SubGhzHistoryItemArray_it_t it;
     SubGhzHistoryItemArray_it_last(it, instance->history->data);
     while(!SubGhzHistoryItemArray_end_p(it)) {
-        SubGhzHistoryItem* search = SubGhzHistoryItemArray_ref(it);
-        if(search->hash_data == hash_data && search->protocol == decoder_base->protocol) {
+        SubGhzHistoryItem* search = *SubGhzHistoryItemArray_ref(it);
+        if(search->result.hash == hash_data && search->result.protocol == decoder_base->protocol) {
             repeats = search->repeats + 1;
             break;
         }
@@ -265,84 +557,33 @@ bool subghz_history_add_to_history(
     instance->code_last_hash_data = hash_data;
     instance->last_update_timestamp = furi_get_tick();
 
-    FuriString* text = furi_string_alloc();
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_push_raw(instance->history->data);
-    item->preset = malloc(sizeof(SubGhzRadioPreset));
-    item->type = decoder_base->protocol->type;
-    item->preset->frequency = preset->frequency;
-    item->preset->name = furi_string_alloc();
-    furi_string_set(item->preset->name, preset->name);
-    item->preset->data = preset->data;
-    item->preset->data_size = preset->data_size;
-    furi_hal_rtc_get_datetime(&item->datetime);
-    item->hash_data = hash_data;
-    item->protocol = decoder_base->protocol;
-    item->repeats = repeats;
+    SubGhzHistoryItem* item = malloc(sizeof(SubGhzHistoryItem));
+    item->timestamp = furi_hal_rtc_get_timestamp();
+    item->frequency = preset->frequency;
     item->latitude = preset->latitude;
     item->longitude = preset->longitude;
+    item->repeats = repeats;
+    item->manufacture_id = SUBGHZ_HISTORY_INTERNED_NONE;
 
-    item->item_str = furi_string_alloc();
-    item->flipper_string = flipper_format_string_alloc();
-    subghz_protocol_decoder_base_serialize(decoder_base, item->flipper_string, preset);
+    stream_clean(flipper_format_get_raw_stream(instance->serialize_data));
+    subghz_protocol_decoder_base_serialize(decoder_base, instance->serialize_data, preset);
+    // Taken after serialization, some protocols parse serial and button only then
+    subghz_protocol_decoder_base_get_result(decoder_base, &item->result);
 
-    do {
-        if(!flipper_format_rewind(item->flipper_string)) {
-            FURI_LOG_E(TAG, "Rewind error");
-            break;
-        }
-        if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
-            FURI_LOG_E(TAG, "Missing Protocol");
-            break;
-        }
-        if(!strcmp(furi_string_get_cstr(instance->tmp_string), "KeeLoq")) {
-            furi_string_set(instance->tmp_string, "KL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
-                FURI_LOG_E(TAG, "Missing Protocol");
-                break;
-            }
-            furi_string_cat(instance->tmp_string, text);
-        } else if(!strcmp(furi_string_get_cstr(instance->tmp_string), "Star Line")) {
-            furi_string_set(instance->tmp_string, "SL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
-                FURI_LOG_E(TAG, "Missing Protocol");
-                break;
-            }
-            furi_string_cat(instance->tmp_string, text);
-        }
-        if(!flipper_format_rewind(item->flipper_string)) {
-            FURI_LOG_E(TAG, "Rewind error");
-            break;
-        }
-        uint8_t key_data[sizeof(uint64_t)] = {0};
-        if(!flipper_format_read_hex(item->flipper_string, "Key", key_data, sizeof(uint64_t))) {
-            FURI_LOG_D(TAG, "No Key");
-        }
-        uint64_t data = 0;
-        for(uint8_t i = 0; i < sizeof(uint64_t); i++) {
-            data = (data << 8) | key_data[i];
-        }
-        if(data != 0) {
-            if(!(uint32_t)(data >> 32)) {
-                furi_string_printf(
-                    item->item_str,
-                    "%s %lX",
-                    furi_string_get_cstr(instance->tmp_string),
-                    (uint32_t)(data & 0xFFFFFFFF));
-            } else {
-                furi_string_printf(
-                    item->item_str,
-                    "%s %lX%08lX",
-                    furi_string_get_cstr(instance->tmp_string),
-                    (uint32_t)(data >> 32),
-                    (uint32_t)(data & 0xFFFFFFFF));
-            }
-        } else {
-            furi_string_printf(item->item_str, "%s", furi_string_get_cstr(instance->tmp_string));
-        }
+    if(flipper_format_rewind(instance->serialize_data) &&
+       flipper_format_read_string(instance->serialize_data, "Manufacture", instance->tmp_string)) {
+        item->manufacture_id = subghz_history_intern_manufacture(instance, instance->tmp_string);
+    }
 
-    } while(false);
+    if(!subghz_history_intern_preset(instance, preset, &item->preset_id) ||
+       !subghz_history_store_data(instance, item)) {
+        FURI_LOG_E(TAG, "Unable to store item");
+        free(item->data);
+        free(item);
+        return false;
+    }
 
-    furi_string_free(text);
+    SubGhzHistoryItemArray_push_back(instance->history->data, item);
     instance->last_index_write++;
     return true;
 }
@@ -353,15 +594,15 @@ void subghz_history_remove_duplicates(SubGhzHistory* instance) {
     SubGhzHistoryItemArray_it_t it;
     SubGhzHistoryItemArray_it_last(it, instance->history->data);
     while(!SubGhzHistoryItemArray_end_p(it)) {
-        SubGhzHistoryItem* i = SubGhzHistoryItemArray_ref(it);
+        SubGhzHistoryItem* i = *SubGhzHistoryItemArray_ref(it);
 
         SubGhzHistoryItemArray_it_t jt;
         SubGhzHistoryItemArray_it_set(jt, it);
         SubGhzHistoryItemArray_previous(jt);
         while(!SubGhzHistoryItemArray_end_p(jt)) {
-            SubGhzHistoryItem* j = SubGhzHistoryItemArray_ref(jt);
+            SubGhzHistoryItem* j = *SubGhzHistoryItemArray_ref(jt);
 
-            if(j->hash_data == i->hash_data && j->protocol == i->protocol) {
+            if(j->result.hash == i->result.hash && j->result.protocol == i->result.protocol) {
                 subghz_history_delete_item(instance, jt->index);
             }
             SubGhzHistoryItemArray_previous(jt);
@@ -371,7 +612,7 @@ void subghz_history_remove_duplicates(SubGhzHistory* instance) {
 }
 
 bool subghz_history_full(SubGhzHistory* instance) {
-    if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) return true;
+    if(subghz_history_memory_full(instance)) return true;
     if(instance->last_index_write >= SUBGHZ_HISTORY_MAX) return true;
     return false;
 }
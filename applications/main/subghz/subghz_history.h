@@ -61,6 +61,12 @@ uint16_t subghz_history_get_repeats(SubGhzHistory* instance, uint16_t idx);
  */
 uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx);
 
+/** Get radio preset to history[idx]
+ * 
+ * @param instance  - SubGhzHistory instance
+ * @param idx       - record index
+ * @return preset   - SubGhzRadioPreset*, shared by all records, valid until the next call
+ */
 SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx);
 
 /** Get preset to history[idx]
@@ -151,11 +157,14 @@ bool subghz_history_add_to_history(
     void* context,
     SubGhzRadioPreset* preset);
 
-/** Get SubGhzProtocolCommonLoad to load into the protocol decoder bin data
+/** Get serialized record to load into the protocol decoder or transmitter
+ * 
+ * Records are stored compactly, some of them on SD card, and loaded into one
+ * FlipperFormat on request. It is valid until the next call with another index.
  * 
  * @param instance  - SubGhzHistory instance
  * @param idx       - record index
- * @return SubGhzProtocolCommonLoad*
+ * @return FlipperFormat* - rewound serialized record, empty if it could not be loaded
  */
 FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx);
 
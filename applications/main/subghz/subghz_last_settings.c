@@ -25,6 +25,7 @@
 #define SUBGHZ_LAST_SETTING_FIELD_ENABLE_SOUND "Sound"
 #define SUBGHZ_LAST_SETTING_FIELD_DELETE_OLD "DelOldSignals"
 #define SUBGHZ_LAST_SETTING_FIELD_AUTOSAVE "Autosave"
+#define SUBGHZ_LAST_SETTING_FIELD_PRECLASSIFIER "Preclassifier"
 
 SubGhzLastSettings* subghz_last_settings_alloc(void) {
     SubGhzLastSettings* instance = malloc(sizeof(SubGhzLastSettings));
@@ -55,6 +56,7 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
     bool temp_remove_duplicates = false;
     bool temp_delete_old_sig = false;
     bool temp_autosave = false;
+    bool temp_preclassifier = false;
     uint32_t temp_ignore_filter = 0;
     uint32_t temp_filter = 0;
     float temp_rssi = 0;
@@ -137,6 +139,11 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
             fff_data_file, SUBGHZ_LAST_SETTING_FIELD_DELETE_OLD, (bool*)&temp_delete_old_sig, 1);
         flipper_format_read_bool(
             fff_data_file, SUBGHZ_LAST_SETTING_FIELD_AUTOSAVE, (bool*)&temp_autosave, 1);
+        flipper_format_read_bool(
+            fff_data_file,
+            SUBGHZ_LAST_SETTING_FIELD_PRECLASSIFIER,
+            (bool*)&temp_preclassifier,
+            1);
 
     } else {
         FURI_LOG_E(TAG, "Error open file %s", SUBGHZ_LAST_SETTINGS_PATH);
@@ -160,6 +167,7 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
         instance->enable_sound = 0;
         instance->delete_old_signals = false;
         instance->autosave = false;
+        instance->preclassifier = false;
         instance->ignore_filter = 0x00;
         // See bin_raw_value in applications/main/subghz/scenes/subghz_scene_receiver_config.c
         instance->filter = SubGhzProtocolFlag_Decodable;
@@ -198,6 +206,8 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
 
         instance->autosave = temp_autosave;
 
+        instance->preclassifier = temp_preclassifier;
+
         // External power amp CC1101
         instance->external_module_power_amp = temp_external_module_power_amp;
 
@@ -344,6 +354,10 @@ bool subghz_last_settings_save(SubGhzLastSettings* instance) {
                file, SUBGHZ_LAST_SETTING_FIELD_AUTOSAVE, &instance->autosave, 1)) {
             break;
         }
+        if(!flipper_format_insert_or_update_bool(
+               file, SUBGHZ_LAST_SETTING_FIELD_PRECLASSIFIER, &instance->preclassifier, 1)) {
+            break;
+        }
         saved = true;
     } while(0);
 
@@ -377,7 +391,7 @@ void subghz_last_settings_log(SubGhzLastSettings* instance) {
         TAG,
         "Frequency: %03ld.%02ld, FeedbackLevel: %ld, FATrigger: %.2f, External: %s, ExtPower: %s, TimestampNames: %s, ExtPowerAmp: %s,\n"
         "GPSBaudrate: %ld, Hopping: %s,\nPreset: %ld, RSSI: %.2f, "
-        "BinRAW: %s, Repeater: %lu, Duplicates: %s, Autosave: %s, Starline: %s, Cars: %s, Magellan: %s, NiceFloR-S: %s, Weather: %s, TPMS: %s, Sound: %s",
+        "BinRAW: %s, Repeater: %lu, Duplicates: %s, Autosave: %s, Preclassifier: %s, Starline: %s, Cars: %s, Magellan: %s, NiceFloR-S: %s, Weather: %s, TPMS: %s, Sound: %s",
         instance->frequency / 1000000 % 1000,
         instance->frequency / 10000 % 100,
         instance->frequency_analyzer_feedback_level,
@@ -394,6 +408,7 @@ void subghz_last_settings_log(SubGhzLastSettings* instance) {
         instance->repeater_state,
         bool_to_char(instance->remove_duplicates),
         bool_to_char(instance->autosave),
+        bool_to_char(instance->preclassifier),
         subghz_last_settings_log_filter_get_index(
             instance->ignore_filter, SubGhzProtocolFilter_StarLine),
         subghz_last_settings_log_filter_get_index(
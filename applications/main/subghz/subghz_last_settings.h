@@ -36,6 +36,7 @@ typedef struct {
     float rssi;
     bool delete_old_signals;
     bool autosave;
+    bool preclassifier;
 } SubGhzLastSettings;
 
 SubGhzLastSettings* subghz_last_settings_alloc(void);
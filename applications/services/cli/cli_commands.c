@@ -282,6 +282,20 @@ void cli_command_sysctl_heap_track(Cli* cli, FuriString* args, void* context) {
     }
 }
 
+void cli_command_sysctl_log_deferred(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+    if(!furi_string_cmp(args, "0")) {
+        furi_log_set_deferred(false);
+        printf("Deferred logging disabled.");
+    } else if(!furi_string_cmp(args, "1")) {
+        furi_log_set_deferred(true);
+        printf("Deferred logging enabled.");
+    } else {
+        cli_print_usage("sysctl log_deferred", "<1|0>", furi_string_get_cstr(args));
+    }
+}
+
 void cli_command_sysctl_print_usage(void) {
     printf("Usage:\r\n");
     printf("sysctl <cmd> <args>\r\n");
@@ -293,6 +307,7 @@ void cli_command_sysctl_print_usage(void) {
 #else
     printf("\theap_track <none|main>\t - Set heap allocation tracking mode\r\n");
 #endif
+    printf("\tlog_deferred <0|1>\t - Format logs in background thread\r\n");
 }
 
 void cli_command_sysctl(Cli* cli, FuriString* args, void* context) {
@@ -315,6 +330,11 @@ void cli_command_sysctl(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "log_deferred") == 0) {
+            cli_command_sysctl_log_deferred(cli, args, context);
+            break;
+        }
+
         cli_command_sysctl_print_usage();
     } while(false);
 
@@ -489,6 +509,159 @@ void cli_command_free_blocks(Cli* cli, FuriString* args, void* context) {
     free(free_blocks);
 }
 
+#define FREE_MAP_COLUMNS 64
+#define FREE_MAP_ROWS 16
+
+void cli_command_free_map(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(args);
+    UNUSED(context);
+
+    uint8_t* map = malloc(FREE_MAP_COLUMNS * FREE_MAP_ROWS);
+    MemmgrHeapFragmentation fragmentation;
+    memmgr_heap_get_fragmentation(&fragmentation, map, FREE_MAP_COLUMNS * FREE_MAP_ROWS);
+
+    size_t cell_size = (memmgr_get_total_heap() + FREE_MAP_COLUMNS * FREE_MAP_ROWS - 1) /
+                       (FREE_MAP_COLUMNS * FREE_MAP_ROWS);
+    printf("Cell: %zu bytes, ' ' free, '.' <25%%, ':' <50%%, '+' <75%%, '#' used\r\n", cell_size);
+    for(size_t row = 0; row < FREE_MAP_ROWS; row++) {
+        for(size_t column = 0; column < FREE_MAP_COLUMNS; column++) {
+            uint8_t used = map[row * FREE_MAP_COLUMNS + column];
+            char cell = ' ';
+            if(used >= 75) {
+                cell = used == 100 ? '#' : '+';
+            } else if(used >= 50) {
+                cell = ':';
+            } else if(used > 0) {
+                cell = '.';
+            }
+            putchar(cell);
+        }
+        printf("\r\n");
+    }
+
+    printf("Used blocks: %zu\r\n", fragmentation.used_count);
+    printf("Free blocks: %zu\r\n", fragmentation.free_count);
+    printf("Free total: %zu\r\n", fragmentation.free_size);
+    printf("Free max block: %zu\r\n", fragmentation.free_max);
+    if(fragmentation.free_size) {
+        printf(
+            "Fragmentation: %zu%%\r\n",
+            100 - fragmentation.free_max * 100 / fragmentation.free_size);
+    }
+
+    free(map);
+}
+
+#define HEAP_PROFILE_RECORDS_DEFAULT 512
+#define HEAP_PROFILE_SITES_SHOW 16
+
+void cli_command_heap_profile_show(void) {
+    if(!memmgr_heap_profiler_is_running()) {
+        printf("Profiler is not running");
+        return;
+    }
+
+    MemmgrHeapProfilerStats stats;
+    memmgr_heap_profiler_get_stats(&stats);
+    MemmgrHeapProfilerSite* sites =
+        malloc(sizeof(MemmgrHeapProfilerSite) * HEAP_PROFILE_SITES_SHOW);
+    size_t sites_count = memmgr_heap_profiler_get_sites(sites, HEAP_PROFILE_SITES_SHOW);
+
+    printf("Allocations by size:\r\n");
+    for(size_t i = 0; i < MEMMGR_HEAP_PROFILER_SIZE_BUCKETS; i++) {
+        if(i < MEMMGR_HEAP_PROFILER_SIZE_BUCKETS - 1) {
+            printf("\t<=%-6u %lu\r\n", 16U << i, stats.size_histogram[i]);
+        } else {
+            printf("\t>%-7u %lu\r\n", 16U << (i - 1), stats.size_histogram[i]);
+        }
+    }
+
+    printf("Released allocations by lifetime:\r\n");
+    uint32_t limit = 1;
+    for(size_t i = 0; i < MEMMGR_HEAP_PROFILER_LIFETIME_BUCKETS; i++) {
+        if(i < MEMMGR_HEAP_PROFILER_LIFETIME_BUCKETS - 1) {
+            printf("\t<%-6lums %lu\r\n", limit, stats.lifetime_histogram[i]);
+            limit *= 10;
+        } else {
+            printf("\t>=%-5lums %lu\r\n", limit / 10, stats.lifetime_histogram[i]);
+        }
+    }
+
+    printf("Untracked: %lu, sites dropped: %lu\r\n", stats.untracked, stats.sites_dropped);
+
+    printf(
+        "%-10s %-8s %-8s %-10s %s\r\n", "Caller", "Allocs", "Live", "Live size", "Untracked");
+    for(size_t i = 0; i < sites_count; i++) {
+        printf(
+            "0x%08lX %-8lu %-8lu %-10zu %lu\r\n",
+            (uint32_t)sites[i].caller,
+            sites[i].alloc_count,
+            sites[i].live_count,
+            sites[i].live_size,
+            sites[i].untracked_count);
+    }
+
+    free(sites);
+}
+
+void cli_command_heap_profile_print_usage(void) {
+    printf("Usage:\r\n");
+    printf("heap_profile <cmd> <args>\r\n");
+    printf("Cmd list:\r\n");
+
+    printf(
+        "\tstart [records]\t - Start allocation profiler, default %d records\r\n",
+        HEAP_PROFILE_RECORDS_DEFAULT);
+    printf("\tstop\t - Stop allocation profiler\r\n");
+    printf("\tshow\t - Show histograms and allocation sites with most live memory\r\n");
+}
+
+void cli_command_heap_profile(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+
+    FuriString* cmd;
+    cmd = furi_string_alloc();
+
+    do {
+        if(!args_read_string_and_trim(args, cmd)) {
+            cli_command_heap_profile_print_usage();
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "start") == 0) {
+            int records = HEAP_PROFILE_RECORDS_DEFAULT;
+            if(furi_string_size(args) &&
+               (!args_read_int_and_trim(args, &records) || records <= 0)) {
+                cli_print_usage("heap_profile start", "[records]", furi_string_get_cstr(args));
+                break;
+            }
+            if(memmgr_heap_profiler_start(records)) {
+                printf("Profiler started");
+            } else {
+                printf("Profiler is already running");
+            }
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "stop") == 0) {
+            memmgr_heap_profiler_stop();
+            printf("Profiler stopped");
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "show") == 0) {
+            cli_command_heap_profile_show();
+            break;
+        }
+
+        cli_command_heap_profile_print_usage();
+    } while(false);
+
+    furi_string_free(cmd);
+}
+
 void cli_command_i2c(Cli* cli, FuriString* args, void* context) {
     UNUSED(cli);
     UNUSED(args);
@@ -530,6 +703,9 @@ void cli_commands_init(Cli* cli) {
     cli_add_command(cli, "ps", CliCommandFlagParallelSafe, cli_command_ps, NULL);
     cli_add_command(cli, "free", CliCommandFlagParallelSafe, cli_command_free, NULL);
     cli_add_command(cli, "free_blocks", CliCommandFlagParallelSafe, cli_command_free_blocks, NULL);
+    cli_add_command(cli, "free_map", CliCommandFlagParallelSafe, cli_command_free_map, NULL);
+    cli_add_command(
+        cli, "heap_profile", CliCommandFlagParallelSafe, cli_command_heap_profile, NULL);
 
     cli_add_command(cli, "vibro", CliCommandFlagDefault, cli_command_vibro, NULL);
     cli_add_command(cli, "led", CliCommandFlagDefault, cli_command_led, NULL);
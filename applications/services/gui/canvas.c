@@ -29,6 +29,8 @@ Canvas* canvas_init(void) {
     // Setup u8g2
     u8g2_Setup_st756x_flipper(&canvas->fb, U8G2_R0, u8x8_hw_spi_stm32, u8g2_gpio_and_delay_stm32);
     canvas->orientation = CanvasOrientationHorizontal;
+    canvas->display_buffer = malloc(canvas_get_buffer_size(canvas));
+    canvas->display_buffer_valid = false;
     // Initialize display
     u8g2_InitDisplay(&canvas->fb);
     // Wake up display
@@ -44,6 +46,7 @@ Canvas* canvas_init(void) {
 void canvas_free(Canvas* canvas) {
     furi_check(canvas);
     compress_icon_free(canvas->compress_icon);
+    free(canvas->display_buffer);
     CanvasCallbackPairArray_clear(canvas->canvas_callback_pair);
     furi_mutex_free(canvas->mutex);
     free(canvas);
@@ -69,9 +72,45 @@ void canvas_reset(Canvas* canvas) {
     canvas_set_font_direction(canvas, CanvasDirectionLeftToRight);
 }
 
+// Send only the changed part of every changed tile row, most frames change a small area
+static void canvas_send_changes(Canvas* canvas) {
+    u8g2_t* fb = &canvas->fb;
+    uint8_t* buffer = u8g2_GetBufferPtr(fb);
+    size_t row_size = u8g2_GetBufferTileWidth(fb) * 8;
+    size_t row_count = u8g2_GetBufferTileHeight(fb);
+    bool sent = false;
+
+    for(size_t row = 0; row < row_count; row++) {
+        uint8_t* frame_row = &buffer[row * row_size];
+        uint8_t* display_row = &canvas->display_buffer[row * row_size];
+
+        size_t first = 0;
+        size_t last = row_size;
+        if(canvas->display_buffer_valid) {
+            while(first < row_size && frame_row[first] == display_row[first]) first++;
+            if(first == row_size) continue;
+            while(frame_row[last - 1] == display_row[last - 1]) last--;
+        }
+
+        size_t tile_first = first / 8;
+        size_t tile_last = (last - 1) / 8;
+        u8x8_DrawTile(
+            u8g2_GetU8x8(fb),
+            tile_first,
+            row,
+            tile_last - tile_first + 1,
+            &frame_row[tile_first * 8]);
+        memcpy(&display_row[first], &frame_row[first], last - first);
+        sent = true;
+    }
+
+    if(sent) u8x8_RefreshDisplay(u8g2_GetU8x8(fb));
+    canvas->display_buffer_valid = true;
+}
+
 void canvas_commit(Canvas* canvas) {
     furi_check(canvas);
-    u8g2_SendBuffer(&canvas->fb);
+    canvas_send_changes(canvas);
 
     // Iterate over callbacks
     canvas_lock(canvas);
@@ -43,6 +43,8 @@ struct Canvas {
     size_t width;
     size_t height;
     CompressIcon* compress_icon;
+    uint8_t* display_buffer; ///< Frame as it is on the display, only changes are sent
+    bool display_buffer_valid; ///< Reset to send the whole frame, after display reinitialization
     CanvasCallbackPairArray_t canvas_callback_pair;
     FuriMutex* mutex;
 };
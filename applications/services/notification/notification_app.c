@@ -551,7 +551,14 @@ static NotificationApp* notification_app_alloc(void) {
 
     // display backlight control
     app->event_record = furi_record_open(RECORD_INPUT_EVENTS);
-    furi_pubsub_subscribe(app->event_record, input_event_callback, app);
+    // Backlight request can wait in our queue, input service must not
+    furi_pubsub_subscribe_async(
+        app->event_record,
+        sizeof(InputEvent),
+        4,
+        FuriPubSubOverflowDrop,
+        input_event_callback,
+        app);
     notification_message(app, &sequence_display_backlight_on);
 
     return app;
@@ -27,6 +27,9 @@ typedef enum {
 
 #define RPC_ALL_EVENTS (RpcEvtNewData | RpcEvtDisconnect)
 
+// Encoded messages are collected here, larger fields go to the transport as they are
+#define RPC_SEND_BUFFER_SIZE (256)
+
 DICT_DEF2(RpcHandlerDict, pb_size_t, M_DEFAULT_OPLIST, RpcHandler, M_POD_OPLIST)
 
 typedef struct {
@@ -85,6 +88,9 @@ struct RpcSession {
     RpcSessionTerminatedCallback terminated_callback;
     RpcOwner owner;
     void* context;
+
+    uint8_t send_buffer[RPC_SEND_BUFFER_SIZE];
+    size_t send_buffer_used;
 };
 
 struct Rpc {
@@ -392,6 +398,7 @@ RpcSession* rpc_session_open(Rpc* rpc, RpcOwner owner) {
     session->terminate = false;
     session->decode_error = false;
     session->owner = owner;
+    session->send_buffer_used = 0;
     RpcHandlerDict_init(session->handlers);
 
     session->decoded_message = malloc(sizeof(PB_Main));
@@ -453,36 +460,67 @@ void rpc_add_handler(RpcSession* session, pb_size_t message_tag, RpcHandler* han
     RpcHandlerDict_set_at(session->handlers, message_tag, *handler);
 }
 
-void rpc_send(RpcSession* session, PB_Main* message) {
-    furi_assert(session);
-    furi_assert(message);
-
-    pb_ostream_t ostream = PB_OSTREAM_SIZING;
-
+static void rpc_send_bytes(RpcSession* session, const uint8_t* buffer, size_t size) {
 #if SRV_RPC_DEBUG
-    FURI_LOG_I(TAG, "OUTPUT:");
-    rpc_debug_print_message(message);
+    rpc_debug_print_data("OUTPUT", (uint8_t*)buffer, size);
 #endif
+    session->send_bytes_callback(session->context, (uint8_t*)buffer, size);
+}
 
-    bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
-    furi_check(result && ostream.bytes_written);
+static void rpc_send_flush(RpcSession* session) {
+    if(session->send_buffer_used) {
+        rpc_send_bytes(session, session->send_buffer, session->send_buffer_used);
+        session->send_buffer_used = 0;
+    }
+}
 
-    uint8_t* buffer = malloc(ostream.bytes_written);
-    ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
+static bool rpc_pb_stream_write(pb_ostream_t* ostream, const pb_byte_t* buf, size_t count) {
+    RpcSession* session = ostream->state;
 
-    pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+    if(count >= RPC_SEND_BUFFER_SIZE) {
+        // File data and screen frames, no point in copying them
+        rpc_send_flush(session);
+        rpc_send_bytes(session, buf, count);
+        return true;
+    }
+
+    while(count) {
+        size_t chunk = MIN(count, RPC_SEND_BUFFER_SIZE - session->send_buffer_used);
+        memcpy(&session->send_buffer[session->send_buffer_used], buf, chunk);
+        session->send_buffer_used += chunk;
+        buf += chunk;
+        count -= chunk;
+
+        if(session->send_buffer_used == RPC_SEND_BUFFER_SIZE) rpc_send_flush(session);
+    }
+
+    return true;
+}
+
+void rpc_send(RpcSession* session, PB_Main* message) {
+    furi_assert(session);
+    furi_assert(message);
 
 #if SRV_RPC_DEBUG
-    rpc_debug_print_data("OUTPUT", buffer, ostream.bytes_written);
+    FURI_LOG_I(TAG, "OUTPUT:");
+    rpc_debug_print_message(message);
 #endif
 
     furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
     if(session->send_bytes_callback) {
-        session->send_bytes_callback(session->context, buffer, ostream.bytes_written);
+        // Encoded in one pass straight to the transport, mutex keeps messages from interleaving
+        pb_ostream_t ostream = {
+            .callback = rpc_pb_stream_write,
+            .state = session,
+            .max_size = SIZE_MAX,
+            .bytes_written = 0,
+            .errmsg = NULL,
+        };
+        bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+        furi_check(result && ostream.bytes_written);
+        rpc_send_flush(session);
     }
     furi_mutex_release(session->callbacks_mutex);
-
-    free(buffer);
 }
 
 void rpc_send_and_release(RpcSession* session, PB_Main* message) {
@@ -11,6 +11,10 @@
 #define PROPERTY_CATEGORY_DEVICE_INFO "devinfo"
 #define PROPERTY_CATEGORY_POWER_INFO "pwrinfo"
 #define PROPERTY_CATEGORY_POWER_DEBUG "pwrdebug"
+#define PROPERTY_CATEGORY_HEAP_INFO "heapinfo"
+
+#define PROPERTY_HEAP_MAP_SIZE (64U)
+#define PROPERTY_HEAP_SITES_MAX (16U)
 
 typedef struct {
     RpcSession* session;
@@ -41,6 +45,97 @@ static void
     }
 }
 
+static void rpc_system_property_heap_info_get(PropertyValueCallback out, void* context) {
+    FuriString* value = furi_string_alloc();
+    FuriString* key = furi_string_alloc();
+
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = '.', .last = false, .context = context};
+
+    property_value_out(&property_context, NULL, 2, "format", "major", "1");
+    property_value_out(&property_context, NULL, 2, "format", "minor", "0");
+
+    property_value_out(&property_context, "%zu", 2, "heap", "free", memmgr_get_free_heap());
+    property_value_out(&property_context, "%zu", 2, "heap", "total", memmgr_get_total_heap());
+    property_value_out(
+        &property_context, "%zu", 2, "heap", "min_free", memmgr_get_minimum_free_heap());
+
+    // Every map character is a heap cell, '0'..'9' and 'A' is used share in 10% steps
+    uint8_t* map = malloc(PROPERTY_HEAP_MAP_SIZE);
+    MemmgrHeapFragmentation fragmentation;
+    memmgr_heap_get_fragmentation(&fragmentation, map, PROPERTY_HEAP_MAP_SIZE);
+
+    property_value_out(&property_context, "%zu", 2, "blocks", "used", fragmentation.used_count);
+    property_value_out(&property_context, "%zu", 2, "blocks", "free", fragmentation.free_count);
+    property_value_out(&property_context, "%zu", 2, "blocks", "free_max", fragmentation.free_max);
+
+    char map_str[PROPERTY_HEAP_MAP_SIZE + 1];
+    for(size_t i = 0; i < PROPERTY_HEAP_MAP_SIZE; i++) {
+        map_str[i] = map[i] == 100 ? 'A' : '0' + map[i] / 10;
+    }
+    map_str[PROPERTY_HEAP_MAP_SIZE] = '\0';
+    free(map);
+
+    const bool profiler_running = memmgr_heap_profiler_is_running();
+    property_context.last = !profiler_running;
+    property_value_out(&property_context, NULL, 1, "map", map_str);
+
+    if(profiler_running) {
+        MemmgrHeapProfilerStats stats;
+        memmgr_heap_profiler_get_stats(&stats);
+
+        char index_str[8];
+        for(size_t i = 0; i < MEMMGR_HEAP_PROFILER_SIZE_BUCKETS; i++) {
+            snprintf(index_str, sizeof(index_str), "%zu", i);
+            property_value_out(
+                &property_context, "%lu", 2, "size", index_str, stats.size_histogram[i]);
+        }
+        for(size_t i = 0; i < MEMMGR_HEAP_PROFILER_LIFETIME_BUCKETS; i++) {
+            snprintf(index_str, sizeof(index_str), "%zu", i);
+            property_value_out(
+                &property_context, "%lu", 2, "lifetime", index_str, stats.lifetime_histogram[i]);
+        }
+        property_value_out(&property_context, "%lu", 1, "untracked", stats.untracked);
+
+        MemmgrHeapProfilerSite* sites =
+            malloc(sizeof(MemmgrHeapProfilerSite) * PROPERTY_HEAP_SITES_MAX);
+        size_t sites_count = memmgr_heap_profiler_get_sites(sites, PROPERTY_HEAP_SITES_MAX);
+
+        for(size_t i = 0; i < sites_count; i++) {
+            snprintf(index_str, sizeof(index_str), "%zu", i);
+            property_value_out(
+                &property_context,
+                "%08lX",
+                3,
+                "site",
+                index_str,
+                "caller",
+                (uint32_t)sites[i].caller);
+            property_value_out(
+                &property_context, "%lu", 3, "site", index_str, "allocs", sites[i].alloc_count);
+            property_value_out(
+                &property_context, "%lu", 3, "site", index_str, "live", sites[i].live_count);
+            property_value_out(
+                &property_context, "%zu", 3, "site", index_str, "live_size", sites[i].live_size);
+            property_value_out(
+                &property_context,
+                "%lu",
+                3,
+                "site",
+                index_str,
+                "untracked",
+                sites[i].untracked_count);
+        }
+        free(sites);
+
+        property_context.last = true;
+        property_value_out(&property_context, "%zu", 2, "sites", "count", sites_count);
+    }
+
+    furi_string_free(key);
+    furi_string_free(value);
+}
+
 static void rpc_system_property_get_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(request->which_content == PB_Main_property_get_request_tag);
@@ -81,6 +176,8 @@ static void rpc_system_property_get_process(const PB_Main* request, void* contex
         furi_hal_power_info_get(rpc_system_property_get_callback, '.', &property_context);
     } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_POWER_DEBUG)) {
         furi_hal_power_debug_get(rpc_system_property_get_callback, &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_HEAP_INFO)) {
+        rpc_system_property_heap_info_get(rpc_system_property_get_callback, &property_context);
     } else {
         rpc_send_and_release_empty(
             session, request->command_id, PB_CommandStatus_ERROR_INVALID_PARAMETERS);
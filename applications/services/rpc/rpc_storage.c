@@ -17,7 +17,7 @@
 
 #define MAX_NAME_LENGTH 254
 
-static const size_t MAX_DATA_SIZE = 512;
+static const size_t MAX_DATA_SIZE = 4096;
 
 typedef enum {
     RpcStorageStateIdle = 0,
@@ -259,6 +259,29 @@ static bool rpc_system_storage_list_filter(
     return result;
 }
 
+/* Hosts compare whole trees by md5, serve unchanged files from the volume hash cache */
+static bool rpc_system_storage_md5_calc(
+    Storage* fs_api,
+    File* file,
+    const char* path,
+    FuriString* md5,
+    FS_Error* file_error) {
+    uint8_t hash[16];
+    uint32_t generation;
+
+    if(!storage_common_md5_cache_get(fs_api, path, hash, &generation)) {
+        if(!md5_calc_file(file, path, hash, file_error)) return false;
+        storage_common_md5_cache_set(fs_api, path, hash, generation);
+    }
+
+    furi_string_reset(md5);
+    for(size_t i = 0; i < sizeof(hash); i++) {
+        furi_string_cat_printf(md5, "%02x", hash[i]);
+    }
+
+    return true;
+}
+
 static void rpc_system_storage_list_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -324,7 +347,8 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
                 if(include_md5 && !file_info_is_dir(&fileinfo)) {
                     furi_string_printf(md5_path, "%s/%s", list_request->path, name); //-V576
 
-                    if(md5_string_calc_file(file, furi_string_get_cstr(md5_path), md5, NULL)) {
+                    if(rpc_system_storage_md5_calc(
+                           fs_api, file, furi_string_get_cstr(md5_path), md5, NULL)) {
                         char* md5sum = list->file[i].md5sum;
                         size_t md5sum_size = sizeof(list->file[i].md5sum);
                         snprintf(md5sum, md5sum_size, "%s", furi_string_get_cstr(md5));
@@ -376,40 +400,36 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     if(fs_operation_success) {
         size_t size_left = storage_file_size(file);
+        /* one data buffer for all chunks, it is not released between responses */
+        size_t data_size = MAX(MIN(size_left, MAX_DATA_SIZE), 1U);
+        pb_bytes_array_t* data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(data_size));
         do {
             response->command_id = request->command_id;
             response->which_content = PB_Main_storage_read_response_tag;
             response->command_status = PB_CommandStatus_OK;
+            response->content.storage_read_response.has_file = true;
+            response->content.storage_read_response.file.data = data;
 
             size_t read_size = MIN(size_left, MAX_DATA_SIZE);
             if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
+                data->size = storage_file_read(file, data->bytes, read_size);
+                size_left -= data->size;
+                fs_operation_success = (data->size == read_size);
 
                 response->has_next = fs_operation_success && (size_left > 0);
             } else {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-#pragma GCC diagnostic pop
-                response->content.storage_read_response.has_file = true;
+                data->size = 0;
                 response->has_next = false;
                 fs_operation_success = true;
             }
 
             if(fs_operation_success) {
-                rpc_send_and_release(session, response);
+                rpc_send(session, response);
             }
         } while((size_left != 0) && fs_operation_success);
+
+        response->content.storage_read_response.file.data = NULL;
+        free(data);
     }
 
     if(!fs_operation_success) {
@@ -613,7 +633,7 @@ static void rpc_system_storage_md5sum_process(const PB_Main* request, void* cont
     FuriString* md5 = furi_string_alloc();
     FS_Error file_error;
 
-    if(md5_string_calc_file(file, filename, md5, &file_error)) {
+    if(rpc_system_storage_md5_calc(fs_api, file, filename, md5, &file_error)) {
         PB_Main response = {
             .command_id = request->command_id,
             .command_status = PB_CommandStatus_OK,
@@ -96,8 +96,8 @@ typedef struct {
         FS_AccessMode access_mode,
         FS_OpenMode open_mode);
     bool (*const close)(void* context, File* file);
-    uint16_t (*read)(void* context, File* file, void* buff, uint16_t bytes_to_read);
-    uint16_t (*write)(void* context, File* file, const void* buff, uint16_t bytes_to_write);
+    size_t (*read)(void* context, File* file, void* buff, size_t bytes_to_read);
+    size_t (*write)(void* context, File* file, const void* buff, size_t bytes_to_write);
     bool (*const seek)(void* context, File* file, uint32_t offset, bool from_start);
     uint64_t (*tell)(void* context, File* file);
     bool (*const expand)(void* context, File* file, uint64_t size);
@@ -179,6 +179,12 @@ typedef struct {
  *      @param path2 second path to be compared
  *      @param truncate if set to true, compare only up to the path1's length
  *      @return true if path1 and path2 are considered equivalent
+ *
+ *  @var FS_Common_Api::mtime
+ *      @brief Get file modification time, optional
+ *      @param path path to file/directory
+ *      @param mtime pointer to a value to contain the time, in filesystem specific format
+ *      @return FS_Error error info
  */
 typedef struct {
     FS_Error (*const stat)(void* context, const char* path, FileInfo* fileinfo);
@@ -190,6 +196,7 @@ typedef struct {
         uint64_t* total_space,
         uint64_t* free_space);
     bool (*const equivalent_path)(const char* path1, const char* path2);
+    FS_Error (*const mtime)(void* context, const char* path, uint32_t* mtime);
 } FS_Common_Api;
 
 /** Full filesystem api structure */
@@ -139,6 +139,36 @@ size_t storage_file_read(File* file, void* buff, size_t bytes_to_read);
  */
 size_t storage_file_write(File* file, const void* buff, size_t bytes_to_write);
 
+/**
+ * @brief Buffer descriptor for vectored reads and writes.
+ */
+typedef struct {
+    void* buff; /**< Pointer to the buffer. */
+    size_t size; /**< Buffer size in bytes. */
+} StorageIoVec;
+
+/**
+ * @brief Read bytes from a file into several buffers in one storage request.
+ *
+ * Buffers are filled in order, reading stops at the end of file or on error.
+ *
+ * @param file pointer to the file instance to read from.
+ * @param iov pointer to the array of buffer descriptors.
+ * @param count number of buffer descriptors.
+ * @return actual total number of bytes read.
+ */
+size_t storage_file_read_v(File* file, const StorageIoVec* iov, size_t count);
+
+/**
+ * @brief Write bytes from several buffers to a file in one storage request.
+ *
+ * @param file pointer to the file instance to write into.
+ * @param iov pointer to the array of buffer descriptors.
+ * @param count number of buffer descriptors.
+ * @return actual total number of bytes written.
+ */
+size_t storage_file_write_v(File* file, const StorageIoVec* iov, size_t count);
+
 /**
  * @brief Change the current access position in a file.
  *
@@ -276,6 +306,133 @@ bool storage_dir_rewind(File* file);
  */
 bool storage_dir_exists(Storage* storage, const char* path);
 
+/******************* Batch Functions *******************/
+
+/**
+ * @brief Batch of file and common operations processed by the storage in one request.
+ *
+ * Every storage call is a round-trip to the storage thread. A batch collects
+ * operations, submits them at once and lets the caller do other work until
+ * they are processed. Operations are processed in order, processing stops at
+ * the first failed read, write or seek and the rest report FSE_NOT_READY.
+ * Failed stat does not stop processing, so it can be used as an existence check.
+ *
+ * Files, buffers and paths used by the batch must stay valid and must not be
+ * used by other calls until the batch is complete.
+ */
+typedef struct StorageBatch StorageBatch;
+
+/**
+ * @brief Allocate a batch.
+ *
+ * @param storage pointer to a storage API instance.
+ * @return pointer to the created instance.
+ */
+StorageBatch* storage_batch_alloc(Storage* storage);
+
+/**
+ * @brief Free the batch, waiting for it to complete if it was submitted.
+ *
+ * @param batch pointer to the batch instance to be freed.
+ */
+void storage_batch_free(StorageBatch* batch);
+
+/**
+ * @brief Remove all operations and their results from a complete batch.
+ *
+ * @param batch pointer to the batch instance.
+ */
+void storage_batch_reset(StorageBatch* batch);
+
+/**
+ * @brief Add a read operation.
+ *
+ * @param batch pointer to the batch instance.
+ * @param file pointer to the file instance to read from.
+ * @param buff pointer to the buffer to be filled with read data.
+ * @param bytes_to_read number of bytes to read.
+ * @return operation index.
+ */
+size_t storage_batch_add_read(StorageBatch* batch, File* file, void* buff, size_t bytes_to_read);
+
+/**
+ * @brief Add a write operation.
+ *
+ * @param batch pointer to the batch instance.
+ * @param file pointer to the file instance to write into.
+ * @param buff pointer to the buffer containing the data to be written.
+ * @param bytes_to_write number of bytes to write.
+ * @return operation index.
+ */
+size_t storage_batch_add_write(
+    StorageBatch* batch,
+    File* file,
+    const void* buff,
+    size_t bytes_to_write);
+
+/**
+ * @brief Add a seek operation.
+ *
+ * @param batch pointer to the batch instance.
+ * @param file pointer to the file instance in question.
+ * @param offset access position offset (meaning depends on from_start parameter).
+ * @param from_start if true, set the access position relative to the file start, otherwise relative to the current position.
+ * @return operation index.
+ */
+size_t storage_batch_add_seek(StorageBatch* batch, File* file, uint32_t offset, bool from_start);
+
+/**
+ * @brief Add a stat operation.
+ *
+ * @param batch pointer to the batch instance.
+ * @param path pointer to a zero-terminated string containing the path of the item in question.
+ * @param fileinfo pointer to the FileInfo structure to contain the info (may be NULL).
+ * @return operation index.
+ */
+size_t storage_batch_add_stat(StorageBatch* batch, const char* path, FileInfo* fileinfo);
+
+/**
+ * @brief Submit all added operations to the storage, does not wait for them.
+ *
+ * @param batch pointer to the batch instance.
+ */
+void storage_batch_submit(StorageBatch* batch);
+
+/**
+ * @brief Check if the submitted operations are processed.
+ *
+ * @param batch pointer to the batch instance.
+ * @return true if the batch is complete or was not submitted.
+ */
+bool storage_batch_is_complete(StorageBatch* batch);
+
+/**
+ * @brief Wait for the submitted operations to be processed.
+ *
+ * @param batch pointer to the batch instance.
+ * @param timeout timeout in ticks, FuriWaitForever to wait until complete.
+ * @return true if the batch is complete.
+ */
+bool storage_batch_wait(StorageBatch* batch, uint32_t timeout);
+
+/**
+ * @brief Get the error of a processed operation.
+ *
+ * @param batch pointer to the complete batch instance.
+ * @param index operation index.
+ * @return FSE_OK on success, FSE_NOT_READY if the operation was skipped, any other error code on failure.
+ */
+FS_Error storage_batch_get_error(StorageBatch* batch, size_t index);
+
+/**
+ * @brief Get the number of bytes read or written by a processed operation.
+ *
+ * @param batch pointer to the complete batch instance.
+ * @param index operation index.
+ * @return actual number of bytes read or written, 0 for other operations.
+ */
+size_t storage_batch_get_result(StorageBatch* batch, size_t index);
+
 /******************* Common Functions *******************/
 
 /**
@@ -288,6 +445,43 @@ bool storage_dir_exists(Storage* storage, const char* path);
  */
 FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t* timestamp);
 
+/**
+ * @brief Get the MD5 hash of a file from the volume hash cache.
+ *
+ * Hashes are kept in a hidden index at the root of the volume, keyed by path, size and
+ * modification time. The storage service drops an entry when its file is opened for
+ * writing or removed. Only volumes that keep modification times are cached.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param path pointer to a zero-terminated string containing the path of the file.
+ * @param md5 pointer to a 16 byte buffer to contain the hash.
+ * @param generation pointer to a value to contain the generation to store the hash with.
+ * @return true if the hash has been found, false otherwise.
+ */
+bool storage_common_md5_cache_get(
+    Storage* storage,
+    const char* path,
+    uint8_t* md5,
+    uint32_t* generation);
+
+/**
+ * @brief Store the MD5 hash of a file in the volume hash cache.
+ *
+ * The hash is not stored if anything on the volume has changed since the generation was
+ * received, as it may not match the file anymore.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param path pointer to a zero-terminated string containing the path of the file.
+ * @param md5 pointer to the 16 byte hash.
+ * @param generation volume generation received before the file was read.
+ * @return true if the hash has been stored, false otherwise.
+ */
+bool storage_common_md5_cache_set(
+    Storage* storage,
+    const char* path,
+    const uint8_t* md5,
+    uint32_t generation);
+
 /**
  * @brief Get information about a file or a directory.
  *
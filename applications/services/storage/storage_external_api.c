@@ -6,6 +6,7 @@
 #include <toolbox/stream/file_stream.h>
 #include <toolbox/dir_walk.h>
 #include "toolbox/path.h"
+#include <m-array.h>
 
 #define MAX_NAME_LENGTH 254
 #define MAX_EXT_LEN 16
@@ -42,7 +43,7 @@
         }};
 
 #define S_RETURN_BOOL (return_data.bool_value);
-#define S_RETURN_UINT16 (return_data.uint16_value);
+#define S_RETURN_SIZE (return_data.size_value);
 #define S_RETURN_UINT64 (return_data.uint64_value);
 #define S_RETURN_ERROR (return_data.error_value);
 #define S_RETURN_CSTRING (return_data.cstring_value);
@@ -142,7 +143,7 @@ bool storage_file_close(File* file) {
     return S_RETURN_BOOL;
 }
 
-static uint16_t storage_file_read_underlying(File* file, void* buff, uint16_t bytes_to_read) {
+size_t storage_file_read(File* file, void* buff, size_t bytes_to_read) {
     if(bytes_to_read == 0) {
         return 0;
     }
@@ -159,11 +160,10 @@ static uint16_t storage_file_read_underlying(File* file, void* buff, uint16_t by
 
     S_API_MESSAGE(StorageCommandFileRead);
     S_API_EPILOGUE;
-    return S_RETURN_UINT16;
+    return S_RETURN_SIZE;
 }
 
-static uint16_t
-    storage_file_write_underlying(File* file, const void* buff, uint16_t bytes_to_write) {
+size_t storage_file_write(File* file, const void* buff, size_t bytes_to_write) {
     if(bytes_to_write == 0) {
         return 0;
     }
@@ -180,43 +180,37 @@ static uint16_t
 
     S_API_MESSAGE(StorageCommandFileWrite);
     S_API_EPILOGUE;
-    return S_RETURN_UINT16;
+    return S_RETURN_SIZE;
 }
 
-size_t storage_file_read(File* file, void* buff, size_t to_read) {
-    size_t total = 0;
-
-    const size_t max_chunk = UINT16_MAX;
-    do {
-        const size_t chunk = MIN((to_read - total), max_chunk);
-        size_t read = storage_file_read_underlying(file, buff + total, chunk);
-        total += read;
+static size_t storage_file_iov_underlying(
+    File* file,
+    const StorageIoVec* iov,
+    size_t count,
+    StorageCommand command) {
+    S_FILE_API_PROLOGUE;
+    S_API_PROLOGUE;
 
-        if(storage_file_get_error(file) != FSE_OK || read != chunk) {
-            break;
-        }
-    } while(total != to_read);
+    SAData data = {
+        .fiov = {
+            .file = file,
+            .iov = iov,
+            .count = count,
+        }};
 
-    return total;
+    S_API_MESSAGE(command);
+    S_API_EPILOGUE;
+    return S_RETURN_UINT64;
 }
 
-size_t storage_file_write(File* file, const void* buff, size_t to_write) {
-    furi_check(file);
-
-    size_t total = 0;
-
-    const size_t max_chunk = UINT16_MAX;
-    do {
-        const size_t chunk = MIN((to_write - total), max_chunk);
-        size_t written = storage_file_write_underlying(file, buff + total, chunk);
-        total += written;
-
-        if(storage_file_get_error(file) != FSE_OK || written != chunk) {
-            break;
-        }
-    } while(total != to_write);
+size_t storage_file_read_v(File* file, const StorageIoVec* iov, size_t count) {
+    furi_check(iov || count == 0);
+    return storage_file_iov_underlying(file, iov, count, StorageCommandFileReadV);
+}
 
-    return total;
+size_t storage_file_write_v(File* file, const StorageIoVec* iov, size_t count) {
+    furi_check(iov || count == 0);
+    return storage_file_iov_underlying(file, iov, count, StorageCommandFileWriteV);
 }
 
 bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
@@ -441,6 +435,164 @@ bool storage_dir_exists(Storage* storage, const char* path) {
 
     return exist;
 }
+
+/****************** BATCH ******************/
+
+ARRAY_DEF(StorageBatchOpArray, StorageBatchOp, M_POD_OPLIST);
+
+struct StorageBatch {
+    Storage* storage;
+    StorageBatchOpArray_t ops;
+    FuriApiLock lock;
+    bool pending;
+    SAData data;
+    SAReturn return_data;
+    StorageMessage message;
+};
+
+StorageBatch* storage_batch_alloc(Storage* storage) {
+    furi_check(storage);
+
+    StorageBatch* batch = malloc(sizeof(StorageBatch));
+    batch->storage = storage;
+    StorageBatchOpArray_init(batch->ops);
+    batch->lock = api_lock_alloc_locked();
+    batch->pending = false;
+
+    return batch;
+}
+
+void storage_batch_free(StorageBatch* batch) {
+    furi_check(batch);
+
+    storage_batch_wait(batch, FuriWaitForever);
+    api_lock_free(batch->lock);
+    StorageBatchOpArray_clear(batch->ops);
+    free(batch);
+}
+
+void storage_batch_reset(StorageBatch* batch) {
+    furi_check(batch);
+    furi_check(!batch->pending);
+
+    StorageBatchOpArray_reset(batch->ops);
+}
+
+static StorageBatchOp* storage_batch_push_op(StorageBatch* batch, StorageBatchOpType type) {
+    furi_check(batch);
+    furi_check(!batch->pending);
+
+    StorageBatchOp* op = StorageBatchOpArray_push_new(batch->ops);
+    memset(op, 0, sizeof(StorageBatchOp));
+    op->type = type;
+    op->error = FSE_NOT_READY;
+
+    return op;
+}
+
+size_t storage_batch_add_read(StorageBatch* batch, File* file, void* buff, size_t bytes_to_read) {
+    furi_check(file);
+
+    StorageBatchOp* op = storage_batch_push_op(batch, StorageBatchOpTypeRead);
+    op->file = file;
+    op->buff = buff;
+    op->size = bytes_to_read;
+
+    return StorageBatchOpArray_size(batch->ops) - 1;
+}
+
+size_t storage_batch_add_write(
+    StorageBatch* batch,
+    File* file,
+    const void* buff,
+    size_t bytes_to_write) {
+    furi_check(file);
+
+    StorageBatchOp* op = storage_batch_push_op(batch, StorageBatchOpTypeWrite);
+    op->file = file;
+    op->data = buff;
+    op->size = bytes_to_write;
+
+    return StorageBatchOpArray_size(batch->ops) - 1;
+}
+
+size_t storage_batch_add_seek(StorageBatch* batch, File* file, uint32_t offset, bool from_start) {
+    furi_check(file);
+
+    StorageBatchOp* op = storage_batch_push_op(batch, StorageBatchOpTypeSeek);
+    op->file = file;
+    op->size = offset;
+    op->from_start = from_start;
+
+    return StorageBatchOpArray_size(batch->ops) - 1;
+}
+
+size_t storage_batch_add_stat(StorageBatch* batch, const char* path, FileInfo* fileinfo) {
+    furi_check(path);
+
+    StorageBatchOp* op = storage_batch_push_op(batch, StorageBatchOpTypeStat);
+    op->path = path;
+    op->fileinfo = fileinfo;
+
+    return StorageBatchOpArray_size(batch->ops) - 1;
+}
+
+void storage_batch_submit(StorageBatch* batch) {
+    furi_check(batch);
+    furi_check(!batch->pending);
+
+    size_t count = StorageBatchOpArray_size(batch->ops);
+    if(count == 0) return;
+
+    batch->data.batch.ops = StorageBatchOpArray_ref(batch->ops, 0);
+    batch->data.batch.count = count;
+    batch->data.batch.thread_id = furi_thread_get_current_id();
+
+    batch->message.lock = batch->lock;
+    batch->message.command = StorageCommandBatch;
+    batch->message.data = &batch->data;
+    batch->message.return_data = &batch->return_data;
+
+    batch->pending = true;
+    furi_check(
+        furi_message_queue_put(batch->storage->message_queue, &batch->message, FuriWaitForever) ==
+        FuriStatusOk);
+}
+
+bool storage_batch_is_complete(StorageBatch* batch) {
+    return storage_batch_wait(batch, 0);
+}
+
+bool storage_batch_wait(StorageBatch* batch, uint32_t timeout) {
+    furi_check(batch);
+
+    if(batch->pending) {
+        uint32_t flags =
+            furi_event_flag_wait(batch->lock, API_LOCK_EVENT, FuriFlagWaitAny, timeout);
+        if(!(flags & FuriFlagError)) {
+            batch->pending = false;
+        }
+    }
+
+    return !batch->pending;
+}
+
+FS_Error storage_batch_get_error(StorageBatch* batch, size_t index) {
+    furi_check(batch);
+    furi_check(!batch->pending);
+    furi_check(index < StorageBatchOpArray_size(batch->ops));
+
+    return StorageBatchOpArray_cget(batch->ops, index)->error;
+}
+
+size_t storage_batch_get_result(StorageBatch* batch, size_t index) {
+    furi_check(batch);
+    furi_check(!batch->pending);
+    furi_check(index < StorageBatchOpArray_size(batch->ops));
+
+    return StorageBatchOpArray_cget(batch->ops, index)->result;
+}
+
 /****************** COMMON ******************/
 
 FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t* timestamp) {
@@ -459,6 +611,51 @@ FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t*
     return S_RETURN_ERROR;
 }
 
+bool storage_common_md5_cache_get(
+    Storage* storage,
+    const char* path,
+    uint8_t* md5,
+    uint32_t* generation) {
+    furi_check(storage);
+    furi_check(md5);
+    furi_check(generation);
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .cmd5cache = {
+            .path = path,
+            .md5 = md5,
+            .generation = generation,
+            .thread_id = furi_thread_get_current_id(),
+        }};
+
+    S_API_MESSAGE(StorageCommandCommonMd5CacheGet);
+    S_API_EPILOGUE;
+    return S_RETURN_BOOL;
+}
+
+bool storage_common_md5_cache_set(
+    Storage* storage,
+    const char* path,
+    const uint8_t* md5,
+    uint32_t generation) {
+    furi_check(storage);
+    furi_check(md5);
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .cmd5cache = {
+            .path = path,
+            .md5 = (uint8_t*)md5,
+            .generation = &generation,
+            .thread_id = furi_thread_get_current_id(),
+        }};
+
+    S_API_MESSAGE(StorageCommandCommonMd5CacheSet);
+    S_API_EPILOGUE;
+    return S_RETURN_BOOL;
+}
+
 FS_Error storage_common_stat(Storage* storage, const char* path, FileInfo* fileinfo) {
     furi_check(storage);
 
@@ -33,6 +33,8 @@ void storage_data_init(StorageData* storage) {
     storage->data = NULL;
     storage->status = StorageStatusNotReady;
     StorageFileList_init(storage->files);
+    storage->generation = 0;
+    storage->hash_cache_stale = false;
 }
 
 StorageStatus storage_data_status(StorageData* storage) {
@@ -67,6 +69,7 @@ const char* storage_data_status_text(StorageData* storage) {
 
 void storage_data_timestamp(StorageData* storage) {
     storage->timestamp = furi_hal_rtc_get_timestamp();
+    storage->generation++;
 }
 
 uint32_t storage_data_get_timestamp(StorageData* storage) {
@@ -58,6 +58,8 @@ struct StorageData {
     StorageStatus status;
     StorageFileList_t files;
     uint32_t timestamp;
+    uint32_t generation; // Bumped together with timestamp, guards hash cache updates
+    bool hash_cache_stale;
 };
 
 bool storage_has_file(const File* file, StorageData* storage_data);
@@ -0,0 +1,320 @@
+#include "storage_hash_cache.h"
+#include "storage.h"
+#include <ctype.h>
+
+#define TAG "StorageHashCache"
+
+#define STORAGE_HASH_CACHE_PREFIX_LEN (sizeof(STORAGE_EXT_PATH_PREFIX) - 1)
+
+// Index file at the root of every volume with modification times
+#define STORAGE_HASH_CACHE_NAME "/.hash_cache"
+#define STORAGE_HASH_CACHE_MAGIC (0x43485348UL)
+#define STORAGE_HASH_CACHE_VERSION (1U)
+// 4096 entries in 128 KiB, a bucket is read and written as a whole
+#define STORAGE_HASH_CACHE_BUCKETS (512U)
+#define STORAGE_HASH_CACHE_SLOTS (8U)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t buckets;
+    uint32_t slots;
+    uint8_t reserved[16];
+} StorageHashCacheHeader;
+
+typedef struct {
+    uint64_t key; // Case folded path hash, 0 for a free slot
+    uint32_t size; // Lower 32 bits of the file size
+    uint32_t mtime;
+    uint8_t md5[STORAGE_HASH_CACHE_MD5_SIZE];
+} StorageHashCacheSlot;
+
+typedef struct {
+    StorageHashCacheSlot slots[STORAGE_HASH_CACHE_SLOTS];
+} StorageHashCacheBucket;
+
+_Static_assert(sizeof(StorageHashCacheHeader) == 32, "Hash cache header size mismatch");
+_Static_assert(sizeof(StorageHashCacheSlot) == 32, "Hash cache slot size mismatch");
+
+typedef struct {
+    StorageData* storage;
+    FuriString* path;
+    File file;
+    uint64_t key;
+    uint32_t offset;
+    StorageHashCacheBucket bucket;
+} StorageHashCacheIndex;
+
+static const char* storage_hash_cache_volume_path(FuriString* path) {
+    const char* path_cstr = furi_string_get_cstr(path);
+    return path_cstr + MIN(STORAGE_HASH_CACHE_PREFIX_LEN, strlen(path_cstr));
+}
+
+static bool storage_hash_cache_supported(StorageData* storage, FuriString* path) {
+    return storage->status == StorageStatusOK && storage->fs_api->common.mtime &&
+           strcasecmp(storage_hash_cache_volume_path(path), STORAGE_HASH_CACHE_NAME) != 0;
+}
+
+// FNV-1a, folded because FAT names are case insensitive
+static uint64_t storage_hash_cache_key(FuriString* path) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for(const char* c = storage_hash_cache_volume_path(path); *c; c++) {
+        hash ^= (uint8_t)tolower((unsigned char)*c);
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash ? hash : 1;
+}
+
+static bool storage_hash_cache_stat(
+    StorageData* storage,
+    FuriString* path,
+    uint32_t* size,
+    uint32_t* mtime) {
+    const char* volume_path = storage_hash_cache_volume_path(path);
+    FileInfo fileinfo;
+
+    if(storage->fs_api->common.stat(storage, volume_path, &fileinfo) != FSE_OK) return false;
+    if(file_info_is_dir(&fileinfo)) return false;
+    if(storage->fs_api->common.mtime(storage, volume_path, mtime) != FSE_OK) return false;
+
+    *size = (uint32_t)fileinfo.size;
+    return true;
+}
+
+static StorageHashCacheIndex*
+    storage_hash_cache_index_alloc(StorageData* storage, FuriString* path) {
+    StorageHashCacheIndex* index = malloc(sizeof(StorageHashCacheIndex));
+    index->storage = storage;
+    index->path = furi_string_alloc();
+    furi_string_set_strn(index->path, furi_string_get_cstr(path), STORAGE_HASH_CACHE_PREFIX_LEN);
+    furi_string_cat(index->path, STORAGE_HASH_CACHE_NAME);
+    index->key = storage_hash_cache_key(path);
+    index->offset = sizeof(StorageHashCacheHeader) +
+                    (index->key % STORAGE_HASH_CACHE_BUCKETS) * sizeof(StorageHashCacheBucket);
+    return index;
+}
+
+static void storage_hash_cache_index_free(StorageHashCacheIndex* index) {
+    furi_string_free(index->path);
+    free(index);
+}
+
+// Same bookkeeping as a file opened through the API, keeps unmount and open checks correct
+static bool storage_hash_cache_index_open(
+    StorageHashCacheIndex* index,
+    FS_AccessMode access_mode,
+    FS_OpenMode open_mode) {
+    StorageData* storage = index->storage;
+    if(storage_path_already_open(index->path, storage)) return false;
+
+    storage_push_storage_file(&index->file, index->path, storage);
+    if(storage->fs_api->file.open(
+           storage,
+           &index->file,
+           storage_hash_cache_volume_path(index->path),
+           access_mode,
+           open_mode)) {
+        return true;
+    }
+
+    storage->fs_api->file.close(storage, &index->file);
+    storage_pop_storage_file(&index->file, storage);
+    return false;
+}
+
+static void storage_hash_cache_index_close(StorageHashCacheIndex* index) {
+    index->storage->fs_api->file.close(index->storage, &index->file);
+    storage_pop_storage_file(&index->file, index->storage);
+}
+
+static bool storage_hash_cache_index_io(
+    StorageHashCacheIndex* index,
+    uint32_t offset,
+    void* data,
+    size_t size,
+    bool write) {
+    StorageData* storage = index->storage;
+    if(!storage->fs_api->file.seek(storage, &index->file, offset, true)) return false;
+
+    if(write) {
+        return storage->fs_api->file.write(storage, &index->file, data, size) == size;
+    } else {
+        return storage->fs_api->file.read(storage, &index->file, data, size) == size;
+    }
+}
+
+static bool storage_hash_cache_index_check(StorageHashCacheIndex* index) {
+    StorageHashCacheHeader header;
+    return storage_hash_cache_index_io(index, 0, &header, sizeof(header), false) &&
+           header.magic == STORAGE_HASH_CACHE_MAGIC &&
+           header.version == STORAGE_HASH_CACHE_VERSION &&
+           header.buckets == STORAGE_HASH_CACHE_BUCKETS &&
+           header.slots == STORAGE_HASH_CACHE_SLOTS;
+}
+
+static bool storage_hash_cache_index_create(StorageHashCacheIndex* index) {
+    if(!storage_hash_cache_index_open(index, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS)) return false;
+
+    StorageHashCacheHeader header = {
+        .magic = STORAGE_HASH_CACHE_MAGIC,
+        .version = STORAGE_HASH_CACHE_VERSION,
+        .buckets = STORAGE_HASH_CACHE_BUCKETS,
+        .slots = STORAGE_HASH_CACHE_SLOTS,
+    };
+    bool result = storage_hash_cache_index_io(index, 0, &header, sizeof(header), true);
+
+    memset(&index->bucket, 0, sizeof(StorageHashCacheBucket));
+    for(size_t i = 0; result && i < STORAGE_HASH_CACHE_BUCKETS; i++) {
+        result = index->storage->fs_api->file.write(
+                     index->storage,
+                     &index->file,
+                     &index->bucket,
+                     sizeof(StorageHashCacheBucket)) == sizeof(StorageHashCacheBucket);
+    }
+
+    if(!result) {
+        FURI_LOG_E(TAG, "Failed to create %s", furi_string_get_cstr(index->path));
+        storage_hash_cache_index_close(index);
+    }
+
+    return result;
+}
+
+static bool storage_hash_cache_index_read_bucket(StorageHashCacheIndex* index) {
+    return storage_hash_cache_index_io(
+        index, index->offset, &index->bucket, sizeof(StorageHashCacheBucket), false);
+}
+
+static bool storage_hash_cache_index_write_slot(StorageHashCacheIndex* index, size_t slot) {
+    return storage_hash_cache_index_io(
+        index,
+        index->offset + slot * sizeof(StorageHashCacheSlot),
+        &index->bucket.slots[slot],
+        sizeof(StorageHashCacheSlot),
+        true);
+}
+
+bool storage_hash_cache_get(StorageData* storage, FuriString* path, uint8_t* md5) {
+    furi_check(storage);
+    furi_check(path);
+    furi_check(md5);
+
+    if(!storage_hash_cache_supported(storage, path)) return false;
+    if(storage->hash_cache_stale) return false;
+
+    uint32_t size, mtime;
+    if(!storage_hash_cache_stat(storage, path, &size, &mtime)) return false;
+
+    bool result = false;
+    StorageHashCacheIndex* index = storage_hash_cache_index_alloc(storage, path);
+
+    if(storage_hash_cache_index_open(index, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        if(storage_hash_cache_index_check(index) && storage_hash_cache_index_read_bucket(index)) {
+            for(size_t i = 0; i < STORAGE_HASH_CACHE_SLOTS; i++) {
+                const StorageHashCacheSlot* slot = &index->bucket.slots[i];
+                if(slot->key == index->key && slot->size == size && slot->mtime == mtime) {
+                    memcpy(md5, slot->md5, STORAGE_HASH_CACHE_MD5_SIZE);
+                    result = true;
+                    break;
+                }
+            }
+        }
+        storage_hash_cache_index_close(index);
+    }
+
+    storage_hash_cache_index_free(index);
+    return result;
+}
+
+bool storage_hash_cache_set(
+    StorageData* storage,
+    FuriString* path,
+    const uint8_t* md5,
+    uint32_t generation) {
+    furi_check(storage);
+    furi_check(path);
+    furi_check(md5);
+
+    // Anything written since the file was read may have changed it
+    if(generation != storage->generation) return false;
+    if(storage_path_already_open(path, storage)) return false;
+    if(!storage_hash_cache_supported(storage, path)) return false;
+
+    uint32_t size, mtime;
+    if(!storage_hash_cache_stat(storage, path, &size, &mtime)) return false;
+
+    bool result = false;
+    StorageHashCacheIndex* index = storage_hash_cache_index_alloc(storage, path);
+
+    do {
+        if(storage->hash_cache_stale) {
+            // Some entry could not be dropped, nothing in the index can be trusted
+            if(!storage_hash_cache_index_create(index)) break;
+            storage->hash_cache_stale = false;
+        } else if(storage_hash_cache_index_open(index, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
+            if(!storage_hash_cache_index_check(index)) {
+                storage_hash_cache_index_close(index);
+                if(!storage_hash_cache_index_create(index)) break;
+            }
+        } else if(!storage_hash_cache_index_create(index)) {
+            break;
+        }
+
+        if(storage_hash_cache_index_read_bucket(index)) {
+            // Same path, then a free slot, then whatever the key points at
+            size_t slot = (index->key >> 32) % STORAGE_HASH_CACHE_SLOTS;
+            for(size_t i = 0; i < STORAGE_HASH_CACHE_SLOTS; i++) {
+                if(index->bucket.slots[i].key == index->key) {
+                    slot = i;
+                    break;
+                } else if(index->bucket.slots[i].key == 0) {
+                    slot = i;
+                }
+            }
+
+            StorageHashCacheSlot* entry = &index->bucket.slots[slot];
+            entry->key = index->key;
+            entry->size = size;
+            entry->mtime = mtime;
+            memcpy(entry->md5, md5, STORAGE_HASH_CACHE_MD5_SIZE);
+            result = storage_hash_cache_index_write_slot(index, slot);
+        }
+
+        storage_hash_cache_index_close(index);
+    } while(false);
+
+    storage_hash_cache_index_free(index);
+    return result;
+}
+
+void storage_hash_cache_invalidate(StorageData* storage, FuriString* path) {
+    furi_check(storage);
+    furi_check(path);
+
+    if(!storage_hash_cache_supported(storage, path)) return;
+
+    if(storage->hash_cache_stale) return;
+
+    StorageHashCacheIndex* index = storage_hash_cache_index_alloc(storage, path);
+
+    if(storage_hash_cache_index_open(index, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
+        if(storage_hash_cache_index_check(index) && storage_hash_cache_index_read_bucket(index)) {
+            for(size_t i = 0; i < STORAGE_HASH_CACHE_SLOTS; i++) {
+                if(index->bucket.slots[i].key == index->key) {
+                    memset(&index->bucket.slots[i], 0, sizeof(StorageHashCacheSlot));
+                    if(!storage_hash_cache_index_write_slot(index, i)) {
+                        FURI_LOG_E(TAG, "Failed to drop %s", furi_string_get_cstr(path));
+                        storage->hash_cache_stale = true;
+                    }
+                }
+            }
+        }
+        storage_hash_cache_index_close(index);
+    } else if(storage_path_already_open(index->path, storage)) {
+        // Opened by a client, the entry stays until the index is rebuilt
+        storage->hash_cache_stale = true;
+    }
+
+    storage_hash_cache_index_free(index);
+}
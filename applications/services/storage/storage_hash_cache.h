@@ -0,0 +1,40 @@
+#pragma once
+#include <furi.h>
+#include "storage_glue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STORAGE_HASH_CACHE_MD5_SIZE (16U)
+
+/** Get cached MD5 of a file, only returned while file size and modification time match
+ * @param storage volume the file is on
+ * @param path full path to the file
+ * @param md5 buffer for the hash
+ * @return true on a hit
+ */
+bool storage_hash_cache_get(StorageData* storage, FuriString* path, uint8_t* md5);
+
+/** Store MD5 of a file in the volume index
+ * @param storage volume the file is on
+ * @param path full path to the file
+ * @param md5 hash to store
+ * @param generation volume generation taken before the file was read
+ * @return true if the hash was stored
+ */
+bool storage_hash_cache_set(
+    StorageData* storage,
+    FuriString* path,
+    const uint8_t* md5,
+    uint32_t generation);
+
+/** Drop cached MD5 of a file that is about to be changed or removed
+ * @param storage volume the file is on
+ * @param path full path to the file
+ */
+void storage_hash_cache_invalidate(StorageData* storage, FuriString* path);
+
+#ifdef __cplusplus
+}
+#endif
@@ -17,15 +17,21 @@ typedef struct {
 typedef struct {
     File* file;
     void* buff;
-    uint16_t bytes_to_read;
+    size_t bytes_to_read;
 } SADataFRead;
 
 typedef struct {
     File* file;
     const void* buff;
-    uint16_t bytes_to_write;
+    size_t bytes_to_write;
 } SADataFWrite;
 
+typedef struct {
+    File* file;
+    const StorageIoVec* iov;
+    size_t count;
+} SADataFIoV;
+
 typedef struct {
     File* file;
     uint32_t offset;
@@ -62,6 +68,13 @@ typedef struct {
     FuriThreadId thread_id;
 } SADataCStat;
 
+typedef struct {
+    const char* path;
+    uint8_t* md5;
+    uint32_t* generation;
+    FuriThreadId thread_id;
+} SADataCMd5Cache;
+
 typedef struct {
     const char* fs_path;
     uint64_t* total_space;
@@ -108,10 +121,39 @@ typedef struct {
     File* image;
 } SAVirtualInit;
 
+typedef enum {
+    StorageBatchOpTypeRead,
+    StorageBatchOpTypeWrite,
+    StorageBatchOpTypeSeek,
+    StorageBatchOpTypeStat,
+} StorageBatchOpType;
+
+typedef struct {
+    StorageBatchOpType type;
+    File* file;
+    const char* path;
+    union {
+        void* buff;
+        const void* data;
+        FileInfo* fileinfo;
+    };
+    size_t size; // bytes to read or write, seek offset
+    bool from_start;
+    size_t result; // bytes read or written
+    FS_Error error;
+} StorageBatchOp;
+
+typedef struct {
+    StorageBatchOp* ops;
+    size_t count;
+    FuriThreadId thread_id;
+} SADataBatch;
+
 typedef union {
     SADataFOpen fopen;
     SADataFRead fread;
     SADataFWrite fwrite;
+    SADataFIoV fiov;
     SADataFSeek fseek;
     SADataFExpand fexpand;
 
@@ -120,6 +162,7 @@ typedef union {
 
     SADataCTimestamp ctimestamp;
     SADataCStat cstat;
+    SADataCMd5Cache cmd5cache;
     SADataCFSInfo cfsinfo;
     SADataCResolvePath cresolvepath;
     SADataCEquivPath cequivpath;
@@ -133,11 +176,13 @@ typedef union {
     SAInfo sdinfo;
 
     SAVirtualInit virtualinit;
+
+    SADataBatch batch;
 } SAData;
 
 typedef union {
     bool bool_value;
-    uint16_t uint16_value;
+    size_t size_value;
     uint64_t uint64_value;
     FS_Error error_value;
     const char* cstring_value;
@@ -177,6 +222,12 @@ typedef enum {
     StorageCommandVirtualMount,
     StorageCommandVirtualUnmount,
     StorageCommandVirtualQuit,
+
+    StorageCommandFileReadV,
+    StorageCommandFileWriteV,
+    StorageCommandBatch,
+    StorageCommandCommonMd5CacheGet,
+    StorageCommandCommonMd5CacheSet,
 } StorageCommand;
 
 typedef struct {
@@ -1,4 +1,5 @@
 #include "storage_processing.h"
+#include "storage_hash_cache.h"
 #include <m-list.h>
 #include <m-dict.h>
 
@@ -123,6 +124,7 @@ bool storage_process_file_open(
         } else {
             if(access_mode & FSAM_WRITE) {
                 storage_data_timestamp(storage);
+                storage_hash_cache_invalidate(storage, path);
             }
             storage_push_storage_file(file, path, storage);
 
@@ -151,9 +153,9 @@ bool storage_process_file_close(Storage* app, File* file) {
     return ret;
 }
 
-static uint16_t
-    storage_process_file_read(Storage* app, File* file, void* buff, uint16_t const bytes_to_read) {
-    uint16_t ret = 0;
+static size_t
+    storage_process_file_read(Storage* app, File* file, void* buff, size_t const bytes_to_read) {
+    size_t ret = 0;
     StorageData* storage = get_storage_by_file(file, app->storage);
 
     if(storage == NULL) {
@@ -165,12 +167,12 @@ static uint16_t
     return ret;
 }
 
-static uint16_t storage_process_file_write(
+static size_t storage_process_file_write(
     Storage* app,
     File* file,
     const void* buff,
-    uint16_t const bytes_to_write) {
-    uint16_t ret = 0;
+    size_t const bytes_to_write) {
+    size_t ret = 0;
     StorageData* storage = get_storage_by_file(file, app->storage);
 
     if(storage == NULL) {
@@ -280,6 +282,26 @@ static bool storage_process_file_eof(Storage* app, File* file) {
     return ret;
 }
 
+static uint64_t storage_process_file_iov(
+    Storage* app,
+    File* file,
+    const StorageIoVec* iov,
+    size_t count,
+    bool write) {
+    uint64_t ret = 0;
+
+    for(size_t i = 0; i < count; i++) {
+        size_t done = write ?
+                          storage_process_file_write(app, file, iov[i].buff, iov[i].size) :
+                          storage_process_file_read(app, file, iov[i].buff, iov[i].size);
+
+        ret += done;
+        if(file->error_id != FSE_OK || done != iov[i].size) break;
+    }
+
+    return ret;
+}
+
 /******************* Dir Functions *******************/
 
 bool storage_process_dir_open(Storage* app, File* file, FuriString* path) {
@@ -361,6 +383,29 @@ static FS_Error
     return ret;
 }
 
+static bool storage_process_common_md5_cache_get(
+    Storage* app,
+    FuriString* path,
+    uint8_t* md5,
+    uint32_t* generation) {
+    StorageData* storage;
+    if(storage_get_data(app, path, &storage) != FSE_OK) return false;
+
+    *generation = storage->generation;
+    return storage_hash_cache_get(storage, path, md5);
+}
+
+static bool storage_process_common_md5_cache_set(
+    Storage* app,
+    FuriString* path,
+    const uint8_t* md5,
+    uint32_t generation) {
+    StorageData* storage;
+    if(storage_get_data(app, path, &storage) != FSE_OK) return false;
+
+    return storage_hash_cache_set(storage, path, md5, generation);
+}
+
 static FS_Error storage_process_common_stat(Storage* app, FuriString* path, FileInfo* fileinfo) {
     StorageData* storage;
     FS_Error ret = storage_get_data(app, path, &storage);
@@ -385,6 +430,7 @@ static FS_Error storage_process_common_remove(Storage* app, FuriString* path) {
         }
 
         storage_data_timestamp(storage);
+        storage_hash_cache_invalidate(storage, path);
         FS_CALL(storage, common.remove(storage, cstr_path_without_vfs_prefix(path)));
     } while(false);
 
@@ -583,6 +629,47 @@ void storage_process_alias(
     }
 }
 
+/****************** Batch processing ******************/
+
+static void storage_process_batch(
+    Storage* app,
+    StorageBatchOp* ops,
+    size_t count,
+    FuriThreadId thread_id) {
+    for(size_t i = 0; i < count; i++) {
+        StorageBatchOp* op = &ops[i];
+
+        switch(op->type) {
+        case StorageBatchOpTypeRead: {
+            StorageIoVec iov = {.buff = op->buff, .size = op->size};
+            op->result = storage_process_file_iov(app, op->file, &iov, 1, false);
+            op->error = op->file->error_id;
+            break;
+        }
+        case StorageBatchOpTypeWrite: {
+            StorageIoVec iov = {.buff = (void*)op->data, .size = op->size};
+            op->result = storage_process_file_iov(app, op->file, &iov, 1, true);
+            op->error = op->file->error_id;
+            break;
+        }
+        case StorageBatchOpTypeSeek:
+            storage_process_file_seek(app, op->file, op->size, op->from_start);
+            op->error = op->file->error_id;
+            break;
+        case StorageBatchOpTypeStat: {
+            FuriString* path = furi_string_alloc_set(op->path);
+            storage_process_alias(app, path, thread_id, false);
+            op->error = storage_process_common_stat(app, path, op->fileinfo);
+            furi_string_free(path);
+            break;
+        }
+        }
+
+        // Following file operations may depend on this one, e.g. read after seek
+        if(op->type != StorageBatchOpTypeStat && op->error != FSE_OK) break;
+    }
+}
+
 /****************** API calls processing ******************/
 
 void storage_process_message_internal(Storage* app, StorageMessage* message) {
@@ -605,14 +692,14 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
             storage_process_file_close(app, message->data->fopen.file);
         break;
     case StorageCommandFileRead:
-        message->return_data->uint16_value = storage_process_file_read(
+        message->return_data->size_value = storage_process_file_read(
             app,
             message->data->fread.file,
             message->data->fread.buff,
             message->data->fread.bytes_to_read);
         break;
     case StorageCommandFileWrite:
-        message->return_data->uint16_value = storage_process_file_write(
+        message->return_data->size_value = storage_process_file_write(
             app,
             message->data->fwrite.file,
             message->data->fwrite.buff,
@@ -648,6 +735,22 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
     case StorageCommandFileEof:
         message->return_data->bool_value = storage_process_file_eof(app, message->data->file.file);
         break;
+    case StorageCommandFileReadV:
+        message->return_data->uint64_value = storage_process_file_iov(
+            app,
+            message->data->fiov.file,
+            message->data->fiov.iov,
+            message->data->fiov.count,
+            false);
+        break;
+    case StorageCommandFileWriteV:
+        message->return_data->uint64_value = storage_process_file_iov(
+            app,
+            message->data->fiov.file,
+            message->data->fiov.iov,
+            message->data->fiov.count,
+            true);
+        break;
 
     // Dir operations
     case StorageCommandDirOpen:
@@ -680,6 +783,18 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         message->return_data->error_value =
             storage_process_common_timestamp(app, path, message->data->ctimestamp.timestamp);
         break;
+    case StorageCommandCommonMd5CacheGet:
+        path = furi_string_alloc_set(message->data->cmd5cache.path);
+        storage_process_alias(app, path, message->data->cmd5cache.thread_id, false);
+        message->return_data->bool_value = storage_process_common_md5_cache_get(
+            app, path, message->data->cmd5cache.md5, message->data->cmd5cache.generation);
+        break;
+    case StorageCommandCommonMd5CacheSet:
+        path = furi_string_alloc_set(message->data->cmd5cache.path);
+        storage_process_alias(app, path, message->data->cmd5cache.thread_id, false);
+        message->return_data->bool_value = storage_process_common_md5_cache_set(
+            app, path, message->data->cmd5cache.md5, *message->data->cmd5cache.generation);
+        break;
     case StorageCommandCommonStat:
         path = furi_string_alloc_set(message->data->cstat.path);
         storage_process_alias(app, path, message->data->cstat.thread_id, false);
@@ -764,6 +879,15 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
     case StorageCommandVirtualQuit:
         message->return_data->error_value = storage_process_virtual_quit(&app->storage[ST_MNT]);
         break;
+
+    // Batch operations
+    case StorageCommandBatch:
+        storage_process_batch(
+            app,
+            message->data->batch.ops,
+            message->data->batch.count,
+            message->data->batch.thread_id);
+        break;
     }
 
     if(path != NULL) { //-V547
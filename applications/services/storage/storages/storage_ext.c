@@ -13,6 +13,9 @@ typedef FRESULT SDError;
 
 #define TAG "StorageExt"
 
+// Largest whole number of sectors that fits FatFs 16 bit transfer size
+#define STORAGE_EXT_RW_CHUNK_SIZE ((UINT16_MAX / _MAX_SS) * _MAX_SS)
+
 /********************* Definitions ********************/
 
 typedef struct {
@@ -365,19 +368,36 @@ static bool storage_ext_file_close(void* ctx, File* file) {
     return (file->error_id == FSE_OK);
 }
 
-static uint16_t
-    storage_ext_file_read(void* ctx, File* file, void* buff, uint16_t const bytes_to_read) {
+// FatFs transfers whole sectors directly between the card and the caller buffer,
+// only the unaligned head and tail go through the sector window. UINT is 16 bit,
+// so chunks end on a sector boundary to keep the middle of the transfer aligned.
+static UINT storage_ext_file_chunk(SDFile* file_data, size_t size) {
+    size_t chunk = STORAGE_EXT_RW_CHUNK_SIZE - (file_data->fptr % _MAX_SS);
+    return MIN(size, chunk);
+}
+
+static size_t
+    storage_ext_file_read(void* ctx, File* file, void* buff, size_t const bytes_to_read) {
     StorageData* storage = ctx;
     SDFile* file_data = storage_get_storage_file_data(file, storage);
-    uint16_t bytes_read = 0;
-    file->internal_error_id = f_read(file_data, buff, bytes_to_read, &bytes_read);
+    size_t bytes_read = 0;
+
+    do {
+        UINT chunk = storage_ext_file_chunk(file_data, bytes_to_read - bytes_read);
+        UINT chunk_read = 0;
+        file->internal_error_id =
+            f_read(file_data, (uint8_t*)buff + bytes_read, chunk, &chunk_read);
+        bytes_read += chunk_read;
+        if(file->internal_error_id != FR_OK || chunk_read != chunk) break;
+    } while(bytes_read < bytes_to_read);
+
     file->error_id = storage_ext_parse_error(file->internal_error_id);
     return bytes_read;
 }
 
-static uint16_t
-    storage_ext_file_write(void* ctx, File* file, const void* buff, uint16_t const bytes_to_write) {
-    uint16_t bytes_written = 0;
+static size_t
+    storage_ext_file_write(void* ctx, File* file, const void* buff, size_t const bytes_to_write) {
+    size_t bytes_written = 0;
 #ifdef FURI_RAM_EXEC
     UNUSED(ctx);
     UNUSED(file);
@@ -387,7 +407,16 @@ static uint16_t
 #else
     StorageData* storage = ctx;
     SDFile* file_data = storage_get_storage_file_data(file, storage);
-    file->internal_error_id = f_write(file_data, buff, bytes_to_write, &bytes_written);
+
+    do {
+        UINT chunk = storage_ext_file_chunk(file_data, bytes_to_write - bytes_written);
+        UINT chunk_written = 0;
+        file->internal_error_id = f_write(
+            file_data, (const uint8_t*)buff + bytes_written, chunk, &chunk_written);
+        bytes_written += chunk_written;
+        if(file->internal_error_id != FR_OK || chunk_written != chunk) break;
+    } while(bytes_written < bytes_to_write);
+
     file->error_id = storage_ext_parse_error(file->internal_error_id);
 #endif
     return bytes_written;
@@ -568,6 +597,20 @@ static FS_Error storage_ext_common_stat(void* ctx, const char* path, FileInfo* f
     return storage_ext_parse_error(result);
 }
 
+static FS_Error storage_ext_common_mtime(void* ctx, const char* path, uint32_t* mtime) {
+    StorageData* storage = ctx;
+    SDFileInfo _fileinfo;
+    char* drive_path = storage_ext_drive_path(storage, path);
+    SDError result = f_stat(drive_path, &_fileinfo);
+    free(drive_path);
+
+    if(result == FR_OK) {
+        *mtime = ((uint32_t)_fileinfo.fdate << 16) | _fileinfo.ftime;
+    }
+
+    return storage_ext_parse_error(result);
+}
+
 static FS_Error storage_ext_common_remove(void* ctx, const char* path) {
     StorageData* storage = ctx;
 #ifdef FURI_RAM_EXEC
@@ -677,6 +720,7 @@ static const FS_Api fs_api = {
             .remove = storage_ext_common_remove,
             .fs_info = storage_ext_common_fs_info,
             .equivalent_path = storage_ext_common_equivalent_path,
+            .mtime = storage_ext_common_mtime,
         },
 };
 
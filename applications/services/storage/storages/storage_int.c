@@ -363,13 +363,13 @@ static bool storage_int_file_close(void* ctx, File* file) {
     return (file->error_id == FSE_OK);
 }
 
-static uint16_t
-    storage_int_file_read(void* ctx, File* file, void* buff, uint16_t const bytes_to_read) {
+static size_t
+    storage_int_file_read(void* ctx, File* file, void* buff, size_t const bytes_to_read) {
     StorageData* storage = ctx;
     lfs_t* lfs = lfs_get_from_storage(storage);
     LFSHandle* handle = storage_get_storage_file_data(file, storage);
 
-    uint16_t bytes_read = 0;
+    size_t bytes_read = 0;
 
     if(lfs_handle_is_open(handle)) {
         file->internal_error_id =
@@ -387,13 +387,13 @@ static uint16_t
     return bytes_read;
 }
 
-static uint16_t
-    storage_int_file_write(void* ctx, File* file, const void* buff, uint16_t const bytes_to_write) {
+static size_t
+    storage_int_file_write(void* ctx, File* file, const void* buff, size_t const bytes_to_write) {
     StorageData* storage = ctx;
     lfs_t* lfs = lfs_get_from_storage(storage);
     LFSHandle* handle = storage_get_storage_file_data(file, storage);
 
-    uint16_t bytes_written = 0;
+    size_t bytes_written = 0;
 
     if(lfs_handle_is_open(handle)) {
         file->internal_error_id =
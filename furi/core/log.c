@@ -1,6 +1,8 @@
 #include "log.h"
 #include "check.h"
 #include "mutex.h"
+#include "thread.h"
+#include "common_defines.h"
 #include <furi_hal.h>
 #include <m-list.h>
 
@@ -8,10 +10,69 @@ LIST_DEF(FuriLogHandlersList, FuriLogHandler, M_POD_OPLIST)
 
 #define FURI_LOG_LEVEL_DEFAULT FuriLogLevelInfo
 
+#define FURI_LOG_DEFERRED_BUFFER_SIZE (4096U)
+#define FURI_LOG_DEFERRED_RECORD_MAX (160U)
+#define FURI_LOG_DEFERRED_STRING_MAX (64U)
+#define FURI_LOG_DEFERRED_TAG_MAX (24U)
+#define FURI_LOG_DEFERRED_FORMAT_MAX (80U)
+#define FURI_LOG_DEFERRED_STRING_NULL (0xFFU)
+#define FURI_LOG_DEFERRED_SPEC_MAX (16U)
+#define FURI_LOG_DEFERRED_STACK_SIZE (1536U)
+
+typedef enum {
+    FuriLogDeferredFlagRecord = (1 << 0),
+} FuriLogDeferredFlag;
+
+typedef enum {
+    FuriLogDeferredRecordTruncated = (1 << 0),
+    FuriLogDeferredRecordTagCopied = (1 << 1),
+    FuriLogDeferredRecordFormatCopied = (1 << 2),
+} FuriLogDeferredRecordFlag;
+
+// Record is header, then tag and format copies if they are not in firmware flash,
+// then raw arguments: 4 or 8 bytes for numbers, length and characters for strings,
+// which may not outlive the call
+typedef struct {
+    uint16_t size;
+    uint8_t level;
+    uint8_t flags;
+    uint32_t tick;
+    const char* tag; // NULL for raw records
+    const char* format;
+} FuriLogDeferredHeader;
+
+typedef enum {
+    FuriLogDeferredArgInvalid,
+    FuriLogDeferredArgPercent,
+    FuriLogDeferredArgInt,
+    FuriLogDeferredArgInt64,
+    FuriLogDeferredArgDouble,
+    FuriLogDeferredArgString,
+    FuriLogDeferredArgPointer,
+    FuriLogDeferredArgCount,
+} FuriLogDeferredArg;
+
+typedef struct {
+    FuriLogDeferredArg arg;
+    uint8_t stars; // '*' width and precision, passed as int before the value
+    bool precision_star; // precision is the last '*' argument
+    int precision; // -1 if not given
+} FuriLogDeferredSpec;
+
+typedef struct {
+    uint8_t* buffer;
+    volatile uint32_t head; // written by loggers in critical section
+    volatile uint32_t tail; // written by worker only
+    volatile uint32_t dropped;
+    FuriThread* thread;
+} FuriLogDeferred;
+
 typedef struct {
     FuriLogLevel log_level;
     FuriMutex* mutex;
     FuriLogHandlersList_t tx_handlers;
+    FuriLogDeferred* volatile deferred; // allocated on first enable and kept
+    volatile bool deferred_enabled;
 } FuriLogParams;
 
 static FuriLogParams furi_log = {0};
@@ -107,42 +168,470 @@ void furi_log_puts(const char* data) {
     furi_log_tx((const uint8_t*)data, strlen(data));
 }
 
-void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
-        FuriString* string;
-        string = furi_string_alloc();
+static void furi_log_format_prefix(
+    FuriString* string,
+    FuriLogLevel level,
+    const char* tag,
+    uint32_t tick) {
+    const char* color = _FURI_LOG_CLR_RESET;
+    const char* log_letter = " ";
+    switch(level) {
+    case FuriLogLevelError:
+        color = _FURI_LOG_CLR_E;
+        log_letter = "E";
+        break;
+    case FuriLogLevelWarn:
+        color = _FURI_LOG_CLR_W;
+        log_letter = "W";
+        break;
+    case FuriLogLevelInfo:
+        color = _FURI_LOG_CLR_I;
+        log_letter = "I";
+        break;
+    case FuriLogLevelDebug:
+        color = _FURI_LOG_CLR_D;
+        log_letter = "D";
+        break;
+    case FuriLogLevelTrace:
+        color = _FURI_LOG_CLR_T;
+        log_letter = "T";
+        break;
+    default:
+        break;
+    }
+
+    // Timestamp
+    furi_string_printf(
+        string, "%lu %s[%s][%s] " _FURI_LOG_CLR_RESET, tick, color, log_letter, tag);
+}
 
-        const char* color = _FURI_LOG_CLR_RESET;
-        const char* log_letter = " ";
-        switch(level) {
-        case FuriLogLevelError:
-            color = _FURI_LOG_CLR_E;
-            log_letter = "E";
+// Parse conversion specification, `format` points right after '%'
+static const char* furi_log_deferred_parse_spec(const char* format, FuriLogDeferredSpec* spec) {
+    spec->arg = FuriLogDeferredArgInvalid;
+    spec->stars = 0;
+    spec->precision_star = false;
+    spec->precision = -1;
+
+    while(*format && strchr("-+ #0", *format)) format++;
+    if(*format == '*') {
+        spec->stars++;
+        format++;
+    } else {
+        while(*format >= '0' && *format <= '9') format++;
+    }
+    if(*format == '.') {
+        format++;
+        if(*format == '*') {
+            spec->stars++;
+            spec->precision_star = true;
+            format++;
+        } else {
+            spec->precision = 0;
+            while(*format >= '0' && *format <= '9') {
+                spec->precision = MIN(spec->precision * 10 + (*format - '0'), INT16_MAX);
+                format++;
+            }
+        }
+    }
+
+    bool wide = false;
+    uint8_t longs = 0;
+    while(*format && strchr("hlLqjzt", *format)) {
+        if(*format == 'l') longs++;
+        if(*format == 'q' || *format == 'j') wide = true;
+        format++;
+    }
+    if(longs > 1) wide = true;
+
+    switch(*format) {
+    case '%':
+        spec->arg = FuriLogDeferredArgPercent;
+        break;
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    case 'c':
+        spec->arg = wide ? FuriLogDeferredArgInt64 : FuriLogDeferredArgInt;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        spec->arg = FuriLogDeferredArgDouble;
+        break;
+    case 's':
+        spec->arg = FuriLogDeferredArgString;
+        break;
+    case 'p':
+        spec->arg = FuriLogDeferredArgPointer;
+        break;
+    case 'n':
+        spec->arg = FuriLogDeferredArgCount;
+        break;
+    default:
+        return format;
+    }
+
+    return format + 1;
+}
+
+static bool
+    furi_log_deferred_put(uint8_t* record, size_t* size, const void* data, size_t data_size) {
+    if(*size + data_size > FURI_LOG_DEFERRED_RECORD_MAX) return false;
+    memcpy(&record[*size], data, data_size);
+    *size += data_size;
+    return true;
+}
+
+static void furi_log_deferred_ring_copy(
+    FuriLogDeferred* deferred,
+    uint32_t position,
+    uint8_t* data,
+    size_t size,
+    bool write) {
+    size_t offset = position % FURI_LOG_DEFERRED_BUFFER_SIZE;
+    size_t first = MIN(size, FURI_LOG_DEFERRED_BUFFER_SIZE - offset);
+    if(write) {
+        memcpy(&deferred->buffer[offset], data, first);
+        memcpy(deferred->buffer, &data[first], size - first);
+    } else {
+        memcpy(data, &deferred->buffer[offset], first);
+        memcpy(&data[first], deferred->buffer, size - first);
+    }
+}
+
+// Application may be unloaded before the record is formatted, firmware flash is always there
+static bool furi_log_deferred_is_static(const char* str) {
+    return (size_t)str >= furi_hal_flash_get_base() &&
+           (size_t)str < (size_t)furi_hal_flash_get_free_start_address();
+}
+
+static void furi_log_deferred_put_copy(
+    uint8_t* record,
+    size_t* size,
+    const char* str,
+    size_t max_length) {
+    size_t length = strnlen(str, max_length);
+    furi_assert(*size + length + 1 <= FURI_LOG_DEFERRED_RECORD_MAX);
+    memcpy(&record[*size], str, length);
+    record[*size + length] = '\0';
+    *size += length + 1;
+}
+
+static void furi_log_deferred_print(
+    FuriLogDeferred* deferred,
+    FuriLogLevel level,
+    const char* tag,
+    const char* format,
+    va_list args) {
+    uint32_t record[FURI_LOG_DEFERRED_RECORD_MAX / sizeof(uint32_t)];
+    uint8_t* data = (uint8_t*)record;
+    FuriLogDeferredHeader* header = (FuriLogDeferredHeader*)record;
+    size_t size = sizeof(FuriLogDeferredHeader);
+
+    header->level = level;
+    header->flags = 0;
+    header->tick = furi_get_tick();
+    header->tag = tag;
+    header->format = format;
+
+    if(tag && !furi_log_deferred_is_static(tag)) {
+        furi_log_deferred_put_copy(data, &size, tag, FURI_LOG_DEFERRED_TAG_MAX);
+        header->flags |= FuriLogDeferredRecordTagCopied;
+    }
+    if(!furi_log_deferred_is_static(format)) {
+        furi_log_deferred_put_copy(data, &size, format, FURI_LOG_DEFERRED_FORMAT_MAX);
+        header->flags |= FuriLogDeferredRecordFormatCopied;
+    }
+
+    bool truncated = false;
+    // Arguments are captured as is, formatting happens in the worker
+    FuriLogDeferredSpec spec;
+    const char* cursor = format;
+    while(!truncated && (cursor = strchr(cursor, '%')) != NULL) {
+        cursor = furi_log_deferred_parse_spec(cursor + 1, &spec);
+        if(spec.arg == FuriLogDeferredArgInvalid) break;
+
+        for(uint8_t i = 0; i < spec.stars && !truncated; i++) {
+            int value = va_arg(args, int);
+            truncated = !furi_log_deferred_put(data, &size, &value, sizeof(value));
+            // negative precision is taken as omitted
+            if(spec.precision_star && i == spec.stars - 1) spec.precision = MAX(value, -1);
+        }
+        if(truncated) break;
+
+        if(spec.arg == FuriLogDeferredArgInt) {
+            int value = va_arg(args, int);
+            truncated = !furi_log_deferred_put(data, &size, &value, sizeof(value));
+        } else if(spec.arg == FuriLogDeferredArgInt64) {
+            long long value = va_arg(args, long long);
+            truncated = !furi_log_deferred_put(data, &size, &value, sizeof(value));
+        } else if(spec.arg == FuriLogDeferredArgDouble) {
+            double value = va_arg(args, double);
+            truncated = !furi_log_deferred_put(data, &size, &value, sizeof(value));
+        } else if(spec.arg == FuriLogDeferredArgPointer || spec.arg == FuriLogDeferredArgCount) {
+            void* value = va_arg(args, void*);
+            truncated = !furi_log_deferred_put(data, &size, &value, sizeof(value));
+        } else if(spec.arg == FuriLogDeferredArgString) {
+            const char* value = va_arg(args, const char*);
+            if(size + 1 > FURI_LOG_DEFERRED_RECORD_MAX) {
+                truncated = true;
+            } else if(value == NULL) {
+                data[size++] = FURI_LOG_DEFERRED_STRING_NULL;
+            } else {
+                // string with precision doesn't have to be terminated
+                size_t length = FURI_LOG_DEFERRED_STRING_MAX;
+                if(spec.precision >= 0) length = MIN(length, (size_t)spec.precision);
+                length = strnlen(value, length);
+                if(length > FURI_LOG_DEFERRED_RECORD_MAX - size - 1) {
+                    length = FURI_LOG_DEFERRED_RECORD_MAX - size - 1;
+                    truncated = true;
+                }
+                data[size++] = length;
+                memcpy(&data[size], value, length);
+                size += length;
+            }
+        }
+    }
+    if(truncated) header->flags |= FuriLogDeferredRecordTruncated;
+    header->size = size;
+
+    bool pushed = false;
+    FURI_CRITICAL_ENTER();
+    uint32_t head = deferred->head;
+    if(FURI_LOG_DEFERRED_BUFFER_SIZE - (head - deferred->tail) >= size) {
+        furi_log_deferred_ring_copy(deferred, head, data, size, true);
+        deferred->head = head + size;
+        pushed = true;
+    } else {
+        deferred->dropped++;
+    }
+    FURI_CRITICAL_EXIT();
+
+    if(pushed) {
+        furi_thread_flags_set(furi_thread_get_id(deferred->thread), FuriLogDeferredFlagRecord);
+    }
+}
+
+// Single conversion with its '*' arguments, format is the spec taken from the original format
+#define FURI_LOG_DEFERRED_CAT(string, format, star_count, stars, arg)               \
+    do {                                                                            \
+        if((star_count) == 2) {                                                     \
+            furi_string_cat_printf(string, format, (stars)[0], (stars)[1], arg);    \
+        } else if((star_count) == 1) {                                              \
+            furi_string_cat_printf(string, format, (stars)[0], arg);                \
+        } else {                                                                    \
+            furi_string_cat_printf(string, format, arg);                            \
+        }                                                                           \
+    } while(0)
+
+// Point tag and format to their copies in the record, returns arguments offset
+static size_t furi_log_deferred_fixup(uint8_t* data) {
+    FuriLogDeferredHeader* header = (FuriLogDeferredHeader*)data;
+    size_t position = sizeof(FuriLogDeferredHeader);
+
+    if(header->flags & FuriLogDeferredRecordTagCopied) {
+        header->tag = (const char*)&data[position];
+        position += strlen(header->tag) + 1;
+    }
+    if(header->flags & FuriLogDeferredRecordFormatCopied) {
+        header->format = (const char*)&data[position];
+        position += strlen(header->format) + 1;
+    }
+
+    return position;
+}
+
+static void furi_log_deferred_format(FuriString* string, const uint8_t* data, size_t position) {
+    const FuriLogDeferredHeader* header = (const FuriLogDeferredHeader*)data;
+    const char* cursor = header->format;
+    char spec_str[FURI_LOG_DEFERRED_SPEC_MAX + 1];
+    bool complete = true;
+
+    while(*cursor) {
+        const char* percent = strchr(cursor, '%');
+        if(percent == NULL) {
+            furi_string_cat_str(string, cursor);
             break;
-        case FuriLogLevelWarn:
-            color = _FURI_LOG_CLR_W;
-            log_letter = "W";
+        }
+        furi_string_cat_printf(string, "%.*s", (int)(percent - cursor), cursor);
+
+        FuriLogDeferredSpec spec;
+        cursor = furi_log_deferred_parse_spec(percent + 1, &spec);
+        if(spec.arg == FuriLogDeferredArgInvalid) {
+            furi_string_cat_str(string, percent);
             break;
-        case FuriLogLevelInfo:
-            color = _FURI_LOG_CLR_I;
-            log_letter = "I";
+        } else if(spec.arg == FuriLogDeferredArgPercent) {
+            furi_string_push_back(string, '%');
+            continue;
+        }
+
+        size_t spec_length = MIN((size_t)(cursor - percent), FURI_LOG_DEFERRED_SPEC_MAX);
+        memcpy(spec_str, percent, spec_length);
+        spec_str[spec_length] = '\0';
+
+        int stars[2] = {0};
+        for(uint8_t i = 0; i < spec.stars; i++) {
+            if(position + sizeof(int) > header->size) break;
+            memcpy(&stars[i], &data[position], sizeof(int));
+            position += sizeof(int);
+        }
+
+        size_t value_size = sizeof(int);
+        if(spec.arg == FuriLogDeferredArgInt64) {
+            value_size = sizeof(long long);
+        } else if(spec.arg == FuriLogDeferredArgDouble) {
+            value_size = sizeof(double);
+        } else if(spec.arg == FuriLogDeferredArgPointer || spec.arg == FuriLogDeferredArgCount) {
+            value_size = sizeof(void*);
+        } else if(spec.arg == FuriLogDeferredArgString) {
+            value_size = 1;
+        }
+        if(position + value_size > header->size) {
+            complete = false;
             break;
-        case FuriLogLevelDebug:
-            color = _FURI_LOG_CLR_D;
-            log_letter = "D";
+        }
+
+        union {
+            int i;
+            long long ll;
+            double d;
+            void* p;
+        } value;
+        char string_value[FURI_LOG_DEFERRED_STRING_MAX + 1];
+        const char* string_arg = string_value;
+
+        if(spec.arg == FuriLogDeferredArgString) {
+            uint8_t length = data[position++];
+            if(length == FURI_LOG_DEFERRED_STRING_NULL) {
+                string_arg = NULL;
+            } else {
+                length = MIN(length, header->size - position);
+                memcpy(string_value, &data[position], length);
+                string_value[length] = '\0';
+                position += length;
+            }
+        } else {
+            memcpy(&value, &data[position], value_size);
+            position += value_size;
+        }
+
+        switch(spec.arg) {
+        case FuriLogDeferredArgInt:
+            FURI_LOG_DEFERRED_CAT(string, spec_str, spec.stars, stars, value.i);
+            break;
+        case FuriLogDeferredArgInt64:
+            FURI_LOG_DEFERRED_CAT(string, spec_str, spec.stars, stars, value.ll);
             break;
-        case FuriLogLevelTrace:
-            color = _FURI_LOG_CLR_T;
-            log_letter = "T";
+        case FuriLogDeferredArgDouble:
+            FURI_LOG_DEFERRED_CAT(string, spec_str, spec.stars, stars, value.d);
+            break;
+        case FuriLogDeferredArgPointer:
+            FURI_LOG_DEFERRED_CAT(string, spec_str, spec.stars, stars, value.p);
+            break;
+        case FuriLogDeferredArgString:
+            FURI_LOG_DEFERRED_CAT(
+                string, spec_str, spec.stars, stars, string_arg ? string_arg : "(null)");
             break;
         default:
+            // %n makes no sense for the call which already returned
             break;
         }
+    }
+
+    if((header->flags & FuriLogDeferredRecordTruncated) || !complete) {
+        furi_string_cat_str(string, "...");
+    }
+}
+
+static int32_t furi_log_deferred_worker(void* context) {
+    FuriLogDeferred* deferred = context;
+    uint32_t record[FURI_LOG_DEFERRED_RECORD_MAX / sizeof(uint32_t)];
+    uint8_t* data = (uint8_t*)record;
+    FuriString* string = furi_string_alloc();
+    uint32_t dropped = 0;
+
+    while(true) {
+        furi_thread_flags_wait(FuriLogDeferredFlagRecord, FuriFlagWaitAny, FuriWaitForever);
+
+        uint32_t tail = deferred->tail;
+        while(tail != deferred->head) {
+            const FuriLogDeferredHeader* header = (const FuriLogDeferredHeader*)data;
+            furi_log_deferred_ring_copy(
+                deferred, tail, data, sizeof(FuriLogDeferredHeader), false);
+            furi_log_deferred_ring_copy(deferred, tail, data, header->size, false);
+            tail += header->size;
+            deferred->tail = tail;
+            size_t position = furi_log_deferred_fixup(data);
+
+            furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+
+            if(deferred->dropped != dropped) {
+                furi_string_printf(
+                    string, "%lu log records dropped\r\n", deferred->dropped - dropped);
+                furi_log_puts(furi_string_get_cstr(string));
+                dropped = deferred->dropped;
+            }
+
+            if(header->tag) {
+                furi_log_format_prefix(string, header->level, header->tag, header->tick);
+            } else {
+                furi_string_reset(string);
+            }
+            furi_log_deferred_format(string, data, position);
+            if(header->tag) {
+                furi_string_cat_str(string, "\r\n");
+            }
+            furi_log_puts(furi_string_get_cstr(string));
+
+            furi_check(furi_mutex_release(furi_log.mutex) == FuriStatusOk);
+        }
+    }
+
+    furi_string_free(string);
+
+    return 0;
+}
+
+void furi_log_set_deferred(bool enable) {
+    if(enable && furi_log.deferred == NULL) {
+        FuriLogDeferred* deferred = malloc(sizeof(FuriLogDeferred));
+        deferred->buffer = malloc(FURI_LOG_DEFERRED_BUFFER_SIZE);
+        deferred->thread = furi_thread_alloc_ex(
+            "LogDeferred", FURI_LOG_DEFERRED_STACK_SIZE, furi_log_deferred_worker, deferred);
+        furi_thread_mark_as_service(deferred->thread);
+        furi_thread_set_priority(deferred->thread, FuriThreadPriorityLowest);
+        furi_thread_start(deferred->thread);
+        furi_log.deferred = deferred;
+    }
 
-        // Timestamp
-        furi_string_printf(
-            string, "%lu %s[%s][%s] " _FURI_LOG_CLR_RESET, furi_get_tick(), color, log_letter, tag);
+    furi_log.deferred_enabled = enable;
+}
+
+bool furi_log_is_deferred(void) {
+    return furi_log.deferred_enabled;
+}
+
+void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
+    if(level <= furi_log.log_level && furi_log.deferred_enabled) {
+        va_list args;
+        va_start(args, format);
+        furi_log_deferred_print(furi_log.deferred, level, tag, format, args);
+        va_end(args);
+    } else if(
+        level <= furi_log.log_level &&
+        furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+        FuriString* string;
+        string = furi_string_alloc();
+
+        furi_log_format_prefix(string, level, tag, furi_get_tick());
         furi_log_puts(furi_string_get_cstr(string));
         furi_string_reset(string);
 
@@ -161,8 +650,14 @@ void furi_log_print_format(FuriLogLevel level, const char* tag, const char* form
 }
 
 void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+    if(level <= furi_log.log_level && furi_log.deferred_enabled) {
+        va_list args;
+        va_start(args, format);
+        furi_log_deferred_print(furi_log.deferred, level, NULL, format, args);
+        va_end(args);
+    } else if(
+        level <= furi_log.log_level &&
+        furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
         FuriString* string;
         string = furi_string_alloc();
         va_list args;
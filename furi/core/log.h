@@ -109,6 +109,26 @@ void furi_log_set_level(FuriLogLevel level);
  */
 FuriLogLevel furi_log_get_level(void);
 
+/** Enable or disable deferred logging
+ *
+ * In deferred mode log call only stores timestamp, tag, format pointer and raw
+ * arguments into a ring buffer, formatting and output happen later in a low
+ * priority thread. So log calls in timing sensitive code do not change its
+ * behavior. String arguments are copied, up to 64 characters. Records which do
+ * not fit into the buffer are dropped and counted.
+ *
+ * Buffer and thread are allocated on first enable and kept.
+ *
+ * @param[in]  enable  true to enable deferred mode
+ */
+void furi_log_set_deferred(bool enable);
+
+/** Check if deferred logging is enabled
+ *
+ * @return     true if enabled
+ */
+bool furi_log_is_deferred(void);
+
 /** Log level to string
  *
  * @param[in]  level  The level
@@ -3,16 +3,18 @@
 #include <string.h>
 #include <furi_hal_memory.h>
 
-extern void* pvPortMalloc(size_t xSize);
-extern void* pvPortAllocAligned(size_t xSize, size_t xAlignment);
-extern void* pvPortRealloc(void* pv, size_t xSize);
 extern void vPortFree(void* pv);
 extern size_t xPortGetFreeHeapSize(void);
 extern size_t xPortGetTotalHeapSize(void);
 extern size_t xPortGetMinimumEverFreeHeapSize(void);
 
+// Same as pvPort* functions, but with the caller address for the allocation profiler
+extern void* memmgr_heap_malloc(size_t size, void* caller);
+extern void* memmgr_heap_alloc_aligned(size_t size, size_t alignment, void* caller);
+extern void* memmgr_heap_realloc(void* ptr, size_t size, void* caller);
+
 void* malloc(size_t size) {
-    return pvPortMalloc(size);
+    return memmgr_heap_malloc(size, __builtin_return_address(0));
 }
 
 void free(void* ptr) {
@@ -20,11 +22,11 @@ void free(void* ptr) {
 }
 
 void* realloc(void* ptr, size_t size) {
-    return pvPortRealloc(ptr, size);
+    return memmgr_heap_realloc(ptr, size, __builtin_return_address(0));
 }
 
 void* calloc(size_t count, size_t size) {
-    return pvPortMalloc(count * size);
+    return memmgr_heap_malloc(count * size, __builtin_return_address(0));
 }
 
 char* strdup(const char* s) {
@@ -32,14 +34,14 @@ char* strdup(const char* s) {
     furi_check(((uint32_t)s << 2) != 0);
 
     size_t siz = strlen(s) + 1;
-    char* y = pvPortMalloc(siz);
+    char* y = memmgr_heap_malloc(siz, __builtin_return_address(0));
     memcpy(y, s, siz);
 
     return y;
 }
 
 void* aligned_alloc(size_t alignment, size_t size) {
-    return pvPortAllocAligned(size, alignment);
+    return memmgr_heap_alloc_aligned(size, alignment, __builtin_return_address(0));
 }
 
 size_t memmgr_get_free_heap(void) {
@@ -56,7 +58,7 @@ size_t memmgr_get_minimum_free_heap(void) {
 
 void* __wrap__malloc_r(struct _reent* r, size_t size) {
     UNUSED(r);
-    return pvPortMalloc(size);
+    return memmgr_heap_malloc(size, __builtin_return_address(0));
 }
 
 void __wrap__free_r(struct _reent* r, void* ptr) {
@@ -66,12 +68,12 @@ void __wrap__free_r(struct _reent* r, void* ptr) {
 
 void* __wrap__calloc_r(struct _reent* r, size_t count, size_t size) {
     UNUSED(r);
-    return calloc(count, size);
+    return memmgr_heap_malloc(count * size, __builtin_return_address(0));
 }
 
 void* __wrap__realloc_r(struct _reent* r, void* ptr, size_t size) {
     UNUSED(r);
-    return realloc(ptr, size);
+    return memmgr_heap_realloc(ptr, size, __builtin_return_address(0));
 }
 
 void* memmgr_aux_pool_alloc(size_t size) {
@@ -26,6 +26,74 @@ DICT_DEF2( //-V1048
 static MemmgrHeapThreadDict_t memmgr_heap_thread_dict = {0};
 static volatile uint32_t memmgr_heap_thread_trace_depth = 0;
 
+// Small allocations are served from size class pages carved out of TLSF.
+// Page is aligned to its size, so owning page is found by masking the pointer.
+#define MEMMGR_SLAB_PAGE_SIZE (1024U)
+#define MEMMGR_SLAB_OBJECT_OFFSET (32U)
+#define MEMMGR_SLAB_OBJECT_SIZE_MAX (256U)
+#define MEMMGR_SLAB_CLASS_COUNT (8U)
+#define MEMMGR_SLAB_OBJECTS_MAX (64U)
+// RAM1 is 192K, leave some room for other targets
+#define MEMMGR_SLAB_HEAP_SIZE_MAX (256U * 1024U)
+#define MEMMGR_SLAB_PAGE_MAP_SIZE (MEMMGR_SLAB_HEAP_SIZE_MAX / MEMMGR_SLAB_PAGE_SIZE / 32U)
+
+typedef struct MemmgrSlabPage MemmgrSlabPage;
+
+struct MemmgrSlabPage {
+    MemmgrSlabPage* next;
+    MemmgrSlabPage* prev;
+    uint32_t used[MEMMGR_SLAB_OBJECTS_MAX / 32U];
+    uint8_t size_class;
+    uint8_t free_count;
+};
+
+_Static_assert(sizeof(MemmgrSlabPage) <= MEMMGR_SLAB_OBJECT_OFFSET, "Slab page header too big");
+
+typedef struct {
+    MemmgrSlabPage* pages; // pages with at least one free object
+    uint16_t object_size;
+    uint8_t object_count;
+    uint8_t empty_count;
+} MemmgrSlabClass;
+
+static MemmgrSlabClass memmgr_slab_classes[MEMMGR_SLAB_CLASS_COUNT] = {
+    {NULL, 16, 62, 0},
+    {NULL, 32, 31, 0},
+    {NULL, 48, 20, 0},
+    {NULL, 64, 15, 0},
+    {NULL, 96, 10, 0},
+    {NULL, 128, 7, 0},
+    {NULL, 192, 5, 0},
+    {NULL, 256, 3, 0},
+};
+
+// Size class index for every 16 bytes step
+static const uint8_t memmgr_slab_class_lookup[MEMMGR_SLAB_OBJECT_SIZE_MAX / 16U + 1U] = {
+    0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7};
+
+// Pages currently owned by slab, one bit per page size step of the heap
+static uint32_t memmgr_slab_page_map[MEMMGR_SLAB_PAGE_MAP_SIZE] = {0};
+
+// Allocation site profiler
+#define MEMMGR_HEAP_PROFILER_SITE_NONE (0xFFU)
+
+typedef struct {
+    uint32_t pointer;
+    uint32_t tick;
+    uint32_t size : 24;
+    uint32_t site : 8;
+} MemmgrHeapProfilerRecord;
+
+typedef struct {
+    MemmgrHeapProfilerRecord* records; // open addressing by pointer
+    size_t records_size; // power of 2
+    size_t records_count;
+    MemmgrHeapProfilerSite sites[MEMMGR_HEAP_PROFILER_SITES_MAX]; // open addressing by caller
+    MemmgrHeapProfilerStats stats;
+} MemmgrHeapProfiler;
+
+static MemmgrHeapProfiler* memmgr_heap_profiler = NULL;
+
 static inline void memmgr_lock(void) {
     vTaskSuspendAll();
 }
@@ -45,6 +113,7 @@ static void memmgr_heap_init(void) {
 
 __attribute__((constructor)) static void memmgr_init(void) {
     size_t pool_size = (size_t)&__heap_end__ - (size_t)&__heap_start__;
+    furi_check(pool_size <= MEMMGR_SLAB_HEAP_SIZE_MAX - MEMMGR_SLAB_PAGE_SIZE);
     tlsf = tlsf_create_with_pool((void*)&__heap_start__, pool_size, pool_size);
     memmgr_heap_init();
 }
@@ -73,7 +142,266 @@ void memmgr_heap_disable_thread_trace(FuriThreadId thread_id) {
     memmgr_unlock();
 }
 
-static inline void memmgr_heap_trace_malloc(void* pointer, size_t size) {
+static inline size_t memmgr_slab_page_index(const void* pointer) {
+    return ((size_t)pointer - ((size_t)&__heap_start__ & ~(MEMMGR_SLAB_PAGE_SIZE - 1))) /
+           MEMMGR_SLAB_PAGE_SIZE;
+}
+
+static inline MemmgrSlabPage* memmgr_slab_page_from_ptr(const void* pointer) {
+    if((size_t)pointer < (size_t)&__heap_start__ || (size_t)pointer >= (size_t)&__heap_end__) {
+        return NULL;
+    }
+
+    size_t index = memmgr_slab_page_index(pointer);
+    if(!(memmgr_slab_page_map[index / 32U] & (1UL << (index % 32U)))) {
+        return NULL;
+    }
+
+    return (MemmgrSlabPage*)((size_t)pointer & ~(MEMMGR_SLAB_PAGE_SIZE - 1));
+}
+
+// Returns object index, or MEMMGR_SLAB_OBJECTS_MAX if pointer is not an object start
+static inline size_t memmgr_slab_object_index(MemmgrSlabPage* page, const void* pointer) {
+    size_t offset = (size_t)pointer - (size_t)page;
+    if(offset < MEMMGR_SLAB_OBJECT_OFFSET) return MEMMGR_SLAB_OBJECTS_MAX;
+    offset -= MEMMGR_SLAB_OBJECT_OFFSET;
+
+    const MemmgrSlabClass* slab_class = &memmgr_slab_classes[page->size_class];
+    if(offset % slab_class->object_size) return MEMMGR_SLAB_OBJECTS_MAX;
+
+    size_t index = offset / slab_class->object_size;
+    return (index < slab_class->object_count) ? index : MEMMGR_SLAB_OBJECTS_MAX;
+}
+
+static inline bool memmgr_slab_object_is_used(MemmgrSlabPage* page, size_t index) {
+    if(index >= MEMMGR_SLAB_OBJECTS_MAX) return false;
+    return page->used[index / 32U] & (1UL << (index % 32U));
+}
+
+static inline void memmgr_slab_page_link(MemmgrSlabClass* slab_class, MemmgrSlabPage* page) {
+    page->prev = NULL;
+    page->next = slab_class->pages;
+    if(slab_class->pages) slab_class->pages->prev = page;
+    slab_class->pages = page;
+}
+
+static inline void memmgr_slab_page_unlink(MemmgrSlabClass* slab_class, MemmgrSlabPage* page) {
+    if(page->prev) {
+        page->prev->next = page->next;
+    } else {
+        slab_class->pages = page->next;
+    }
+    if(page->next) page->next->prev = page->prev;
+    page->next = NULL;
+    page->prev = NULL;
+}
+
+static MemmgrSlabPage* memmgr_slab_page_alloc(uint8_t size_class) {
+    MemmgrSlabPage* page = tlsf_memalign(tlsf, MEMMGR_SLAB_PAGE_SIZE, MEMMGR_SLAB_PAGE_SIZE);
+    if(page == NULL) return NULL;
+
+    memset(page, 0, MEMMGR_SLAB_OBJECT_OFFSET);
+    page->size_class = size_class;
+    page->free_count = memmgr_slab_classes[size_class].object_count;
+
+    size_t index = memmgr_slab_page_index(page);
+    memmgr_slab_page_map[index / 32U] |= 1UL << (index % 32U);
+
+    // Whole page counts as used, including free slots
+    heap_used += tlsf_block_size(page);
+    heap_used += tlsf_alloc_overhead();
+    if(heap_used > heap_max_used) {
+        heap_max_used = heap_used;
+    }
+
+    return page;
+}
+
+static void memmgr_slab_page_free(MemmgrSlabPage* page) {
+    size_t index = memmgr_slab_page_index(page);
+    memmgr_slab_page_map[index / 32U] &= ~(1UL << (index % 32U));
+
+    heap_used -= tlsf_block_size(page);
+    heap_used -= tlsf_alloc_overhead();
+
+    // vPortFree leaves released memory zeroed, keep it that way
+    memset(page, 0, MEMMGR_SLAB_OBJECT_OFFSET);
+    tlsf_free(tlsf, page);
+}
+
+// Must be called under memmgr lock, returns NULL if size is not served by slab or no page
+static void* memmgr_slab_malloc(size_t size) {
+    if(size == 0 || size > MEMMGR_SLAB_OBJECT_SIZE_MAX) return NULL;
+
+    uint8_t size_class = memmgr_slab_class_lookup[(size + 15U) / 16U];
+    MemmgrSlabClass* slab_class = &memmgr_slab_classes[size_class];
+
+    MemmgrSlabPage* page = slab_class->pages;
+    if(page == NULL) {
+        page = memmgr_slab_page_alloc(size_class);
+        if(page == NULL) return NULL;
+        memmgr_slab_page_link(slab_class, page);
+    } else if(page->free_count == slab_class->object_count) {
+        slab_class->empty_count--;
+    }
+
+    size_t index = 0;
+    for(size_t i = 0; i < COUNT_OF(page->used); i++) {
+        uint32_t free_mask = ~page->used[i];
+        if(free_mask) {
+            index = i * 32U + __builtin_ctz(free_mask);
+            break;
+        }
+    }
+    furi_check(index < slab_class->object_count);
+
+    page->used[index / 32U] |= 1UL << (index % 32U);
+    page->free_count--;
+    if(page->free_count == 0) {
+        memmgr_slab_page_unlink(slab_class, page);
+    }
+
+    return (uint8_t*)page + MEMMGR_SLAB_OBJECT_OFFSET + index * slab_class->object_size;
+}
+
+// Must be called under memmgr lock
+static void memmgr_slab_free(MemmgrSlabPage* page, void* pointer) {
+    MemmgrSlabClass* slab_class = &memmgr_slab_classes[page->size_class];
+    size_t index = memmgr_slab_object_index(page, pointer);
+    if(!memmgr_slab_object_is_used(page, index)) {
+        furi_crash("invalid free");
+    }
+
+    memset(pointer, 0, slab_class->object_size);
+
+    page->used[index / 32U] &= ~(1UL << (index % 32U));
+    if(page->free_count == 0) {
+        memmgr_slab_page_link(slab_class, page);
+    }
+    page->free_count++;
+
+    // Keep one empty page per class, so alloc/free pairs do not bounce pages to TLSF
+    if(page->free_count == slab_class->object_count) {
+        if(slab_class->empty_count) {
+            memmgr_slab_page_unlink(slab_class, page);
+            memmgr_slab_page_free(page);
+        } else {
+            slab_class->empty_count++;
+        }
+    }
+}
+
+static inline size_t
+    memmgr_heap_profiler_record_home(MemmgrHeapProfiler* profiler, uint32_t pointer) {
+    return (pointer >> 3) & (profiler->records_size - 1);
+}
+
+static uint8_t memmgr_heap_profiler_site_get(MemmgrHeapProfiler* profiler, void* caller) {
+    size_t index = (((uint32_t)caller >> 1) * 2654435761U) % MEMMGR_HEAP_PROFILER_SITES_MAX;
+    for(size_t i = 0; i < MEMMGR_HEAP_PROFILER_SITES_MAX; i++) {
+        MemmgrHeapProfilerSite* site = &profiler->sites[index];
+        if(site->caller == caller) {
+            return index;
+        } else if(site->caller == NULL) {
+            site->caller = caller;
+            return index;
+        }
+        index = (index + 1) % MEMMGR_HEAP_PROFILER_SITES_MAX;
+    }
+    return MEMMGR_HEAP_PROFILER_SITE_NONE;
+}
+
+static void memmgr_heap_profiler_malloc(void* pointer, size_t size, void* caller) {
+    MemmgrHeapProfiler* profiler = memmgr_heap_profiler;
+
+    size_t size_bucket = 0;
+    while(size_bucket < MEMMGR_HEAP_PROFILER_SIZE_BUCKETS - 1 && size > (16U << size_bucket)) {
+        size_bucket++;
+    }
+    profiler->stats.size_histogram[size_bucket]++;
+
+    MemmgrHeapProfilerSite* site = NULL;
+    uint8_t site_index = memmgr_heap_profiler_site_get(profiler, caller);
+    if(site_index == MEMMGR_HEAP_PROFILER_SITE_NONE) {
+        profiler->stats.sites_dropped++;
+    } else {
+        site = &profiler->sites[site_index];
+        site->alloc_count++;
+    }
+
+    // keep load factor under 3/4, so probing stays short
+    // live stats only cover tracked allocations, their frees can be matched
+    if(profiler->records_count >= profiler->records_size / 4 * 3) {
+        profiler->stats.untracked++;
+        if(site) site->untracked_count++;
+        return;
+    }
+
+    size_t mask = profiler->records_size - 1;
+    size_t index = memmgr_heap_profiler_record_home(profiler, (uint32_t)pointer);
+    while(profiler->records[index].pointer) {
+        index = (index + 1) & mask;
+    }
+
+    MemmgrHeapProfilerRecord* record = &profiler->records[index];
+    record->pointer = (uint32_t)pointer;
+    record->tick = furi_get_tick();
+    record->size = MIN(size, 0xFFFFFFU);
+    record->site = site_index;
+    profiler->records_count++;
+
+    if(site) {
+        site->live_count++;
+        site->live_size += record->size;
+    }
+}
+
+static void memmgr_heap_profiler_free(void* pointer) {
+    MemmgrHeapProfiler* profiler = memmgr_heap_profiler;
+
+    size_t mask = profiler->records_size - 1;
+    size_t hole = memmgr_heap_profiler_record_home(profiler, (uint32_t)pointer);
+    while(profiler->records[hole].pointer != (uint32_t)pointer) {
+        // allocated before profiler start or not tracked
+        if(profiler->records[hole].pointer == 0) return;
+        hole = (hole + 1) & mask;
+    }
+
+    MemmgrHeapProfilerRecord* record = &profiler->records[hole];
+    uint32_t lifetime = furi_get_tick() - record->tick;
+    size_t lifetime_bucket = 0;
+    for(uint32_t limit = 1; lifetime_bucket < MEMMGR_HEAP_PROFILER_LIFETIME_BUCKETS - 1;
+        limit *= 10) {
+        if(lifetime < limit) break;
+        lifetime_bucket++;
+    }
+    profiler->stats.lifetime_histogram[lifetime_bucket]++;
+
+    if(record->site != MEMMGR_HEAP_PROFILER_SITE_NONE) {
+        MemmgrHeapProfilerSite* site = &profiler->sites[record->site];
+        site->live_count--;
+        site->live_size -= record->size;
+    }
+
+    // backward shift deletion, no tombstones to clean up later
+    size_t next = (hole + 1) & mask;
+    while(profiler->records[next].pointer) {
+        size_t home = memmgr_heap_profiler_record_home(profiler, profiler->records[next].pointer);
+        if(((next - home) & mask) >= ((next - hole) & mask)) {
+            profiler->records[hole] = profiler->records[next];
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+    profiler->records[hole].pointer = 0;
+    profiler->records_count--;
+}
+
+static inline void memmgr_heap_trace_malloc(void* pointer, size_t size, void* caller) {
+    if(memmgr_heap_profiler && memmgr_heap_thread_trace_depth == 0) {
+        memmgr_heap_profiler_malloc(pointer, size, caller);
+    }
+
     FuriThreadId thread_id = furi_thread_get_current_id();
     if(thread_id && memmgr_heap_thread_trace_depth == 0) {
         memmgr_heap_thread_trace_depth++;
@@ -87,6 +415,10 @@ static inline void memmgr_heap_trace_malloc(void* pointer, size_t size) {
 }
 
 static inline void memmgr_heap_trace_free(void* pointer) {
+    if(memmgr_heap_profiler && memmgr_heap_thread_trace_depth == 0) {
+        memmgr_heap_profiler_free(pointer);
+    }
+
     FuriThreadId thread_id = furi_thread_get_current_id();
     if(thread_id && memmgr_heap_thread_trace_depth == 0) {
         memmgr_heap_thread_trace_depth++;
@@ -116,9 +448,17 @@ size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
                 MemmgrHeapAllocDict_next(alloc_dict_it)) {
                 MemmgrHeapAllocDict_itref_t* data = MemmgrHeapAllocDict_ref(alloc_dict_it);
                 if(data->key != 0) {
-                    block_header_t* block = block_from_ptr((uint8_t*)data->key);
-                    if(!block_is_free(block)) {
-                        leftovers += data->value;
+                    MemmgrSlabPage* page = memmgr_slab_page_from_ptr((void*)data->key);
+                    if(page) {
+                        size_t index = memmgr_slab_object_index(page, (void*)data->key);
+                        if(memmgr_slab_object_is_used(page, index)) {
+                            leftovers += data->value;
+                        }
+                    } else {
+                        block_header_t* block = block_from_ptr((uint8_t*)data->key);
+                        if(!block_is_free(block)) {
+                            leftovers += data->value;
+                        }
                     }
                 }
             }
@@ -174,7 +514,150 @@ void memmgr_heap_walk_blocks(BlockWalker walker, void* context) {
     memmgr_unlock();
 }
 
-void* pvPortMalloc(size_t xSize) {
+typedef struct {
+    MemmgrHeapFragmentation* fragmentation;
+    uint8_t* map;
+    size_t cell_size;
+} MemmgrHeapFragmentationContext;
+
+static bool tlsf_walker_fragmentation(void* ptr, size_t size, int used, void* user) {
+    MemmgrHeapFragmentationContext* context = user;
+    MemmgrHeapFragmentation* fragmentation = context->fragmentation;
+
+    if(used) {
+        fragmentation->used_count++;
+    } else {
+        fragmentation->free_count++;
+        fragmentation->free_size += size;
+        if(size > fragmentation->free_max) {
+            fragmentation->free_max = size;
+        }
+    }
+
+    if(used && context->map) {
+        size_t start = (size_t)ptr - (size_t)&__heap_start__;
+        size_t end = MIN(start + size, memmgr_get_heap_size());
+        while(start < end) {
+            size_t cell = start / context->cell_size;
+            size_t cell_end = MIN((cell + 1) * context->cell_size, end);
+            size_t percent = context->map[cell] + (cell_end - start) * 100 / context->cell_size;
+            context->map[cell] = MIN(percent, 100U);
+            start = cell_end;
+        }
+    }
+
+    return true;
+}
+
+void memmgr_heap_get_fragmentation(
+    MemmgrHeapFragmentation* fragmentation,
+    uint8_t* map,
+    size_t map_size) {
+    furi_check(fragmentation);
+    furi_check(map == NULL || map_size > 0);
+
+    memset(fragmentation, 0, sizeof(MemmgrHeapFragmentation));
+    if(map) memset(map, 0, map_size);
+
+    MemmgrHeapFragmentationContext context = {
+        .fragmentation = fragmentation,
+        .map = map,
+        .cell_size = map ? (memmgr_get_heap_size() + map_size - 1) / map_size : 1,
+    };
+
+    memmgr_lock();
+
+    pool_t pool = tlsf_get_pool(tlsf);
+    tlsf_walk_pool(pool, tlsf_walker_fragmentation, &context);
+
+    memmgr_unlock();
+}
+
+bool memmgr_heap_profiler_start(size_t records) {
+    furi_check(records > 0);
+
+    size_t records_size = 4;
+    while(records_size < records) {
+        records_size <<= 1;
+    }
+
+    // allocated before the profiler is installed, so not profiled itself
+    MemmgrHeapProfiler* profiler = malloc(sizeof(MemmgrHeapProfiler));
+    profiler->records = malloc(records_size * sizeof(MemmgrHeapProfilerRecord));
+    profiler->records_size = records_size;
+
+    bool started = false;
+    memmgr_lock();
+    if(memmgr_heap_profiler == NULL) {
+        memmgr_heap_profiler = profiler;
+        started = true;
+    }
+    memmgr_unlock();
+
+    if(!started) {
+        free(profiler->records);
+        free(profiler);
+    }
+
+    return started;
+}
+
+void memmgr_heap_profiler_stop(void) {
+    memmgr_lock();
+    MemmgrHeapProfiler* profiler = memmgr_heap_profiler;
+    memmgr_heap_profiler = NULL;
+    memmgr_unlock();
+
+    if(profiler) {
+        free(profiler->records);
+        free(profiler);
+    }
+}
+
+bool memmgr_heap_profiler_is_running(void) {
+    return memmgr_heap_profiler != NULL;
+}
+
+void memmgr_heap_profiler_get_stats(MemmgrHeapProfilerStats* stats) {
+    furi_check(stats);
+
+    memmgr_lock();
+    if(memmgr_heap_profiler) {
+        *stats = memmgr_heap_profiler->stats;
+    } else {
+        memset(stats, 0, sizeof(MemmgrHeapProfilerStats));
+    }
+    memmgr_unlock();
+}
+
+size_t memmgr_heap_profiler_get_sites(MemmgrHeapProfilerSite* sites, size_t count) {
+    furi_check(sites);
+
+    size_t written = 0;
+
+    memmgr_lock();
+    MemmgrHeapProfiler* profiler = memmgr_heap_profiler;
+    for(size_t i = 0; profiler && i < MEMMGR_HEAP_PROFILER_SITES_MAX; i++) {
+        const MemmgrHeapProfilerSite* site = &profiler->sites[i];
+        if(site->caller == NULL) continue;
+
+        // insertion into top list, biggest live size first
+        size_t position = written;
+        while(position > 0 && sites[position - 1].live_size < site->live_size) {
+            if(position < count) sites[position] = sites[position - 1];
+            position--;
+        }
+        if(position < count) {
+            sites[position] = *site;
+            if(written < count) written++;
+        }
+    }
+    memmgr_unlock();
+
+    return written;
+}
+
+void* memmgr_heap_malloc(size_t xSize, void* caller) {
     // memory management in ISR is not allowed
     if(FURI_IS_IRQ_MODE()) {
         furi_crash("memmgt in ISR");
@@ -182,25 +665,29 @@ void* pvPortMalloc(size_t xSize) {
 
     memmgr_lock();
 
-    // allocate block
-    void* data = tlsf_malloc(tlsf, xSize);
+    // allocate from size class page, fallback to TLSF
+    void* data = memmgr_slab_malloc(xSize);
     if(data == NULL) {
-        if(xSize == 0) {
-            furi_crash("malloc(0)");
-        } else {
-            furi_crash("out of memory");
+        // allocate block
+        data = tlsf_malloc(tlsf, xSize);
+        if(data == NULL) {
+            if(xSize == 0) {
+                furi_crash("malloc(0)");
+            } else {
+                furi_crash("out of memory");
+            }
         }
-    }
 
-    // update heap usage
-    heap_used += tlsf_block_size(data);
-    heap_used += tlsf_alloc_overhead();
-    if(heap_used > heap_max_used) {
-        heap_max_used = heap_used;
+        // update heap usage
+        heap_used += tlsf_block_size(data);
+        heap_used += tlsf_alloc_overhead();
+        if(heap_used > heap_max_used) {
+            heap_max_used = heap_used;
+        }
     }
 
     // trace allocation
-    memmgr_heap_trace_malloc(data, xSize);
+    memmgr_heap_trace_malloc(data, xSize, caller);
 
     memmgr_unlock();
 
@@ -220,18 +707,23 @@ void vPortFree(void* pv) {
     if(pv != NULL) {
         memmgr_lock();
 
-        // get block size
-        size_t block_size = tlsf_block_size(pv);
+        MemmgrSlabPage* page = memmgr_slab_page_from_ptr(pv);
+        if(page) {
+            memmgr_slab_free(page, pv);
+        } else {
+            // get block size
+            size_t block_size = tlsf_block_size(pv);
 
-        // clear block content
-        memset(pv, 0, block_size);
+            // clear block content
+            memset(pv, 0, block_size);
 
-        // update heap usage
-        heap_used -= block_size;
-        heap_used -= tlsf_alloc_overhead();
+            // update heap usage
+            heap_used -= block_size;
+            heap_used -= tlsf_alloc_overhead();
 
-        // free
-        tlsf_free(tlsf, pv);
+            // free
+            tlsf_free(tlsf, pv);
+        }
 
         // trace free
         memmgr_heap_trace_free(pv);
@@ -240,7 +732,11 @@ void vPortFree(void* pv) {
     }
 }
 
-extern void* pvPortAllocAligned(size_t xSize, size_t xAlignment) {
+void* pvPortMalloc(size_t xSize) {
+    return memmgr_heap_malloc(xSize, __builtin_return_address(0));
+}
+
+void* memmgr_heap_alloc_aligned(size_t xSize, size_t xAlignment, void* caller) {
     // memory management in ISR is not allowed
     if(FURI_IS_IRQ_MODE()) {
         furi_crash("memmgt in ISR");
@@ -271,7 +767,7 @@ extern void* pvPortAllocAligned(size_t xSize, size_t xAlignment) {
     }
 
     // trace allocation
-    memmgr_heap_trace_malloc(data, xSize);
+    memmgr_heap_trace_malloc(data, xSize, caller);
 
     memmgr_unlock();
 
@@ -281,7 +777,11 @@ extern void* pvPortAllocAligned(size_t xSize, size_t xAlignment) {
     return data;
 }
 
-extern void* pvPortRealloc(void* pv, size_t xSize) {
+extern void* pvPortAllocAligned(size_t xSize, size_t xAlignment) {
+    return memmgr_heap_alloc_aligned(xSize, xAlignment, __builtin_return_address(0));
+}
+
+void* memmgr_heap_realloc(void* pv, size_t xSize, void* caller) {
     // realloc(ptr, 0) is equivalent to free(ptr)
     if(xSize == 0) {
         vPortFree(pv);
@@ -290,7 +790,7 @@ extern void* pvPortRealloc(void* pv, size_t xSize) {
 
     // realloc(NULL, size) is equivalent to malloc(size)
     if(pv == NULL) {
-        return pvPortMalloc(xSize);
+        return memmgr_heap_malloc(xSize, caller);
     }
 
     /* realloc things */
@@ -302,27 +802,59 @@ extern void* pvPortRealloc(void* pv, size_t xSize) {
 
     memmgr_lock();
 
-    // trace old block as free
-    size_t old_size = tlsf_block_size(pv);
+    void* data = NULL;
+    size_t old_size = 0;
+    MemmgrSlabPage* page = memmgr_slab_page_from_ptr(pv);
 
-    // trace free
-    memmgr_heap_trace_free(pv);
+    if(page) {
+        old_size = memmgr_slab_classes[page->size_class].object_size;
 
-    // reallocate block
-    void* data = tlsf_realloc(tlsf, pv, xSize);
-    if(data == NULL) {
-        furi_crash("out of memory");
-    }
+        // trace free
+        memmgr_heap_trace_free(pv);
 
-    // update heap usage
-    heap_used -= old_size;
-    heap_used += tlsf_block_size(data);
-    if(heap_used > heap_max_used) {
-        heap_max_used = heap_used;
+        if(xSize <= old_size) {
+            // object is big enough already
+            data = pv;
+        } else {
+            // move object to bigger class or to TLSF
+            data = memmgr_slab_malloc(xSize);
+            if(data == NULL) {
+                data = tlsf_malloc(tlsf, xSize);
+                if(data == NULL) {
+                    furi_crash("out of memory");
+                }
+                heap_used += tlsf_block_size(data);
+                heap_used += tlsf_alloc_overhead();
+                if(heap_used > heap_max_used) {
+                    heap_max_used = heap_used;
+                }
+            }
+            memcpy(data, pv, old_size);
+            memmgr_slab_free(page, pv);
+        }
+    } else {
+        // trace old block as free
+        old_size = tlsf_block_size(pv);
+
+        // trace free
+        memmgr_heap_trace_free(pv);
+
+        // reallocate block
+        data = tlsf_realloc(tlsf, pv, xSize);
+        if(data == NULL) {
+            furi_crash("out of memory");
+        }
+
+        // update heap usage
+        heap_used -= old_size;
+        heap_used += tlsf_block_size(data);
+        if(heap_used > heap_max_used) {
+            heap_max_used = heap_used;
+        }
     }
 
     // trace allocation
-    memmgr_heap_trace_malloc(data, xSize);
+    memmgr_heap_trace_malloc(data, xSize, caller);
 
     memmgr_unlock();
 
@@ -335,6 +867,10 @@ extern void* pvPortRealloc(void* pv, size_t xSize) {
     return data;
 }
 
+extern void* pvPortRealloc(void* pv, size_t xSize) {
+    return memmgr_heap_realloc(pv, xSize, __builtin_return_address(0));
+}
+
 size_t xPortGetFreeHeapSize(void) {
     return memmgr_get_heap_size() - heap_used - tlsf_size(tlsf);
 }
@@ -52,6 +52,85 @@ typedef bool (*BlockWalker)(void* pointer, size_t size, bool used, void* context
  */
 void memmgr_heap_walk_blocks(BlockWalker walker, void* context);
 
+/** Heap fragmentation summary */
+typedef struct {
+    size_t free_size; /**< Total size of free blocks */
+    size_t free_count; /**< Free block count */
+    size_t free_max; /**< Largest free block size */
+    size_t used_count; /**< Used block count */
+} MemmgrHeapFragmentation;
+
+/** Memmgr heap get fragmentation summary and map
+ *
+ * Heap is split into map_size equal cells, every cell gets percentage of used memory in it.
+ *
+ * @param      fragmentation  - fragmentation summary
+ * @param      map            - fragmentation map, can be NULL
+ * @param      map_size       - fragmentation map size
+ */
+void memmgr_heap_get_fragmentation(
+    MemmgrHeapFragmentation* fragmentation,
+    uint8_t* map,
+    size_t map_size);
+
+#define MEMMGR_HEAP_PROFILER_SIZE_BUCKETS (10U)
+#define MEMMGR_HEAP_PROFILER_LIFETIME_BUCKETS (7U)
+#define MEMMGR_HEAP_PROFILER_SITES_MAX (64U)
+
+/** Allocation site, identified by the caller of malloc */
+typedef struct {
+    void* caller; /**< Return address of the allocation call */
+    uint32_t alloc_count; /**< Allocations made since profiler start */
+    uint32_t live_count; /**< Tracked allocations not released yet */
+    size_t live_size; /**< Bytes of tracked allocations not released yet */
+    uint32_t untracked_count; /**< Allocations not tracked because record table was full */
+} MemmgrHeapProfilerSite;
+
+/** Allocation profiler statistics */
+typedef struct {
+    /** Allocations by requested size: up to 16, 32, ... 4096 bytes and bigger */
+    uint32_t size_histogram[MEMMGR_HEAP_PROFILER_SIZE_BUCKETS];
+    /** Released allocations by lifetime: up to 1, 10, ... 100000 ms and longer */
+    uint32_t lifetime_histogram[MEMMGR_HEAP_PROFILER_LIFETIME_BUCKETS];
+    uint32_t untracked; /**< Allocations not tracked because record table was full */
+    uint32_t sites_dropped; /**< Allocations from sites not fitting into site table */
+} MemmgrHeapProfilerStats;
+
+/** Memmgr heap start allocation profiler
+ *
+ * Profiler records caller, size and lifetime of every allocation made after the start.
+ * Record table is allocated from the heap, so keep it small.
+ *
+ * @param      records  - maximum number of live allocations to track
+ *
+ * @return     true if profiler was started, false if already running
+ */
+bool memmgr_heap_profiler_start(size_t records);
+
+/** Memmgr heap stop allocation profiler and release its memory */
+void memmgr_heap_profiler_stop(void);
+
+/** Memmgr heap check if allocation profiler is running
+ *
+ * @return     true if running
+ */
+bool memmgr_heap_profiler_is_running(void);
+
+/** Memmgr heap get allocation profiler statistics
+ *
+ * @param      stats  - statistics, zeroed if profiler is not running
+ */
+void memmgr_heap_profiler_get_stats(MemmgrHeapProfilerStats* stats);
+
+/** Memmgr heap get allocation sites, sorted by live size
+ *
+ * @param      sites  - site array
+ * @param      count  - site array size
+ *
+ * @return     number of sites written
+ */
+size_t memmgr_heap_profiler_get_sites(MemmgrHeapProfilerSite* sites, size_t count);
+
 #ifdef __cplusplus
 }
 #endif
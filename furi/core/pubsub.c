@@ -2,12 +2,49 @@
 #include "memmgr.h"
 #include "check.h"
 #include "mutex.h"
+#include "kernel.h"
+#include "thread.h"
+#include "semaphore.h"
 
+#include <string.h>
 #include <m-list.h>
 
+#define FURI_PUBSUB_ASYNC_STACK_SIZE (1024U)
+
+typedef enum {
+    FuriPubSubAsyncFlagMessage = (1 << 0),
+    FuriPubSubAsyncFlagStop = (1 << 1),
+} FuriPubSubAsyncFlag;
+
+#define FURI_PUBSUB_ASYNC_FLAGS_ALL (FuriPubSubAsyncFlagMessage | FuriPubSubAsyncFlagStop)
+
+// Single producer (publishers are serialized by the pubsub mutex), single consumer ring
+typedef struct {
+    FuriPubSubCallback callback;
+    void* callback_context;
+    FuriPubSubOverflow overflow;
+
+    FuriThread* thread;
+    FuriSemaphore* space;
+    volatile bool space_wait;
+    uint32_t users; // waiting publishers and unsubscriber, guarded by pubsub mutex
+    bool closed; // unsubscribed, guarded by pubsub mutex
+
+    uint8_t* messages;
+    uint32_t* ticks;
+    size_t message_size;
+    size_t slot_size; // message size aligned to 4
+    uint32_t queue_size; // power of 2
+    uint32_t head; // written by publisher only
+    uint32_t tail; // written by delivery thread only
+
+    FuriPubSubSubscriptionStats stats;
+} FuriPubSubAsync;
+
 struct FuriPubSubSubscription {
     FuriPubSubCallback callback;
     void* callback_context;
+    FuriPubSubAsync* async; // NULL for synchronous delivery
 };
 
 LIST_DEF(FuriPubSubSubscriptionList, FuriPubSubSubscription, M_POD_OPLIST);
@@ -40,11 +77,142 @@ void furi_pubsub_free(FuriPubSub* pubsub) {
     free(pubsub);
 }
 
-FuriPubSubSubscription*
-    furi_pubsub_subscribe(FuriPubSub* pubsub, FuriPubSubCallback callback, void* callback_context) {
-    furi_check(pubsub);
-    furi_check(callback);
+static int32_t furi_pubsub_async_worker(void* context) {
+    FuriPubSubAsync* async = context;
+
+    while(true) {
+        uint32_t flags =
+            furi_thread_flags_wait(FURI_PUBSUB_ASYNC_FLAGS_ALL, FuriFlagWaitAny, FuriWaitForever);
+        furi_check((flags & FuriFlagError) == 0);
+        if(flags & FuriPubSubAsyncFlagStop) break;
+
+        uint32_t tail = async->tail;
+        while(tail != __atomic_load_n(&async->head, __ATOMIC_ACQUIRE)) {
+            uint32_t index = tail & (async->queue_size - 1);
+
+            uint32_t latency = furi_get_tick() - async->ticks[index];
+            async->stats.latency_last = latency;
+            async->stats.latency_sum += latency;
+            if(latency > async->stats.latency_max) {
+                async->stats.latency_max = latency;
+            }
+
+            // message is delivered straight from its slot, slot is released after the callback
+            async->callback(&async->messages[index * async->slot_size], async->callback_context);
+            async->stats.delivered++;
+
+            tail++;
+            __atomic_store_n(&async->tail, tail, __ATOMIC_RELEASE);
+            if(async->space_wait) {
+                furi_semaphore_release(async->space);
+            }
+        }
+    }
+
+    return 0;
+}
+
+static FuriPubSubAsync* furi_pubsub_async_alloc(
+    size_t message_size,
+    size_t queue_size,
+    FuriPubSubOverflow overflow,
+    FuriPubSubCallback callback,
+    void* callback_context) {
+    FuriPubSubAsync* async = malloc(sizeof(FuriPubSubAsync));
+
+    async->callback = callback;
+    async->callback_context = callback_context;
+    async->overflow = overflow;
+
+    async->queue_size = 1;
+    while(async->queue_size < queue_size) {
+        async->queue_size <<= 1;
+    }
+    async->message_size = message_size;
+    async->slot_size = (message_size + 3U) & ~3U;
+    async->messages = malloc(async->queue_size * async->slot_size);
+    async->ticks = malloc(async->queue_size * sizeof(uint32_t));
+    async->space = furi_semaphore_alloc(1, 0);
+
+    // deliver with the priority of the subscriber
+    async->thread = furi_thread_alloc_ex(
+        "PubSubAsync", FURI_PUBSUB_ASYNC_STACK_SIZE, furi_pubsub_async_worker, async);
+    furi_thread_set_priority(async->thread, furi_thread_get_current_priority());
+    furi_thread_start(async->thread);
+
+    return async;
+}
+
+static void furi_pubsub_async_stop(FuriPubSubAsync* async) {
+    furi_thread_flags_set(furi_thread_get_id(async->thread), FuriPubSubAsyncFlagStop);
+    furi_thread_join(async->thread);
+    furi_thread_free(async->thread);
+}
+
+static void furi_pubsub_async_free(FuriPubSubAsync* async) {
+    furi_semaphore_free(async->space);
+    free(async->ticks);
+    free(async->messages);
+    free(async);
+}
+
+// Called with pubsub mutex held, returns false if publisher has to wait for a free slot
+static bool furi_pubsub_async_try_publish(FuriPubSubAsync* async, const void* message) {
+    uint32_t head = async->head;
+
+    if(head - __atomic_load_n(&async->tail, __ATOMIC_ACQUIRE) == async->queue_size) {
+        // delivery thread publishing to itself would wait forever
+        if(async->overflow == FuriPubSubOverflowDrop ||
+           furi_thread_get_current_id() == furi_thread_get_id(async->thread)) {
+            async->stats.dropped++;
+            return true;
+        }
+        return false;
+    }
+
+    uint32_t index = head & (async->queue_size - 1);
+    memcpy(&async->messages[index * async->slot_size], message, async->message_size);
+    async->ticks[index] = furi_get_tick();
+    __atomic_store_n(&async->head, head + 1, __ATOMIC_RELEASE);
 
+    furi_thread_flags_set(furi_thread_get_id(async->thread), FuriPubSubAsyncFlagMessage);
+
+    return true;
+}
+
+// Called with pubsub mutex held, mutex is released while waiting so subscribers are not blocked
+static void furi_pubsub_async_publish_wait(
+    FuriPubSub* pubsub,
+    FuriPubSubAsync* async,
+    const void* message) {
+    while(!async->closed) {
+        // re-check after announcing the wait, so the release from the consumer is not lost
+        async->space_wait = true;
+        if(furi_pubsub_async_try_publish(async, message)) break;
+
+        furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+        furi_check(furi_semaphore_acquire(async->space, FuriWaitForever) == FuriStatusOk);
+        furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+    }
+
+    async->users--;
+    if(async->users == 0) {
+        if(async->closed) {
+            furi_pubsub_async_free(async);
+        } else {
+            async->space_wait = false;
+        }
+    } else {
+        // one release wakes one waiter, pass it on
+        furi_semaphore_release(async->space);
+    }
+}
+
+static FuriPubSubSubscription* furi_pubsub_subscribe_internal(
+    FuriPubSub* pubsub,
+    FuriPubSubCallback callback,
+    void* callback_context,
+    FuriPubSubAsync* async) {
     furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
     // put uninitialized item to the list
     FuriPubSubSubscription* item = FuriPubSubSubscriptionList_push_raw(pubsub->items);
@@ -52,18 +220,47 @@ FuriPubSubSubscription*
     // initialize item
     item->callback = callback;
     item->callback_context = callback_context;
+    item->async = async;
 
     furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
 
     return item;
 }
 
+FuriPubSubSubscription*
+    furi_pubsub_subscribe(FuriPubSub* pubsub, FuriPubSubCallback callback, void* callback_context) {
+    furi_check(pubsub);
+    furi_check(callback);
+
+    return furi_pubsub_subscribe_internal(pubsub, callback, callback_context, NULL);
+}
+
+FuriPubSubSubscription* furi_pubsub_subscribe_async(
+    FuriPubSub* pubsub,
+    size_t message_size,
+    size_t queue_size,
+    FuriPubSubOverflow overflow,
+    FuriPubSubCallback callback,
+    void* callback_context) {
+    furi_check(pubsub);
+    furi_check(callback);
+    furi_check(message_size > 0);
+    furi_check(queue_size > 0);
+    furi_check(overflow == FuriPubSubOverflowDrop || overflow == FuriPubSubOverflowWait);
+
+    FuriPubSubAsync* async =
+        furi_pubsub_async_alloc(message_size, queue_size, overflow, callback, callback_context);
+
+    return furi_pubsub_subscribe_internal(pubsub, callback, callback_context, async);
+}
+
 void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_subscription) {
     furi_assert(pubsub);
     furi_assert(pubsub_subscription);
 
     furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
     bool result = false;
+    FuriPubSubAsync* async = NULL;
 
     // iterate over items
     FuriPubSubSubscriptionList_it_t it;
@@ -73,6 +270,11 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
 
         // if the iterator is equal to our element
         if(item == pubsub_subscription) {
+            async = item->async;
+            if(async) {
+                async->closed = true;
+                async->users++;
+            }
             FuriPubSubSubscriptionList_remove(pubsub->items, it);
             result = true;
             break;
@@ -81,11 +283,47 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
 
     furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
     furi_check(result);
+
+    // publishers can't reach it anymore, undelivered messages are dropped
+    if(async) {
+        furi_pubsub_async_stop(async);
+
+        // publishers still waiting for space are woken up, the last one frees it
+        furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+        async->users--;
+        bool last = (async->users == 0);
+        if(!last) {
+            furi_semaphore_release(async->space);
+        }
+        furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+
+        if(last) {
+            furi_pubsub_async_free(async);
+        }
+    }
+}
+
+void furi_pubsub_subscription_get_stats(
+    FuriPubSubSubscription* pubsub_subscription,
+    FuriPubSubSubscriptionStats* stats) {
+    furi_check(pubsub_subscription);
+    furi_check(stats);
+
+    FuriPubSubAsync* async = pubsub_subscription->async;
+    if(async) {
+        *stats = async->stats;
+        stats->pending = async->head - async->tail;
+    } else {
+        memset(stats, 0, sizeof(FuriPubSubSubscriptionStats));
+    }
 }
 
 void furi_pubsub_publish(FuriPubSub* pubsub, void* message) {
     furi_check(pubsub);
 
+    FuriPubSubAsync** waiting = NULL;
+    size_t waiting_count = 0;
+
     furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
 
     // iterate over subscribers
@@ -93,8 +331,23 @@ void furi_pubsub_publish(FuriPubSub* pubsub, void* message) {
     for(FuriPubSubSubscriptionList_it(it, pubsub->items); !FuriPubSubSubscriptionList_end_p(it);
         FuriPubSubSubscriptionList_next(it)) {
         const FuriPubSubSubscription* item = FuriPubSubSubscriptionList_cref(it);
-        item->callback(message, item->callback_context);
+        if(item->async) {
+            if(!furi_pubsub_async_try_publish(item->async, message)) {
+                // full queues are waited for after the list walk, list may change meanwhile
+                item->async->users++;
+                waiting = realloc(waiting, (waiting_count + 1) * sizeof(FuriPubSubAsync*));
+                waiting[waiting_count++] = item->async;
+            }
+        } else {
+            item->callback(message, item->callback_context);
+        }
+    }
+
+    for(size_t i = 0; i < waiting_count; i++) {
+        furi_pubsub_async_publish_wait(pubsub, waiting[i], message);
     }
 
     furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+
+    free(waiting);
 }
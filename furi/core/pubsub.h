@@ -4,6 +4,10 @@
  */
 #pragma once
 
+#include "base.h"
+
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -17,6 +21,23 @@ typedef struct FuriPubSub FuriPubSub;
 /** FuriPubSubSubscription type */
 typedef struct FuriPubSubSubscription FuriPubSubSubscription;
 
+/** What to do when asynchronous subscriber queue is full */
+typedef enum {
+    FuriPubSubOverflowDrop, /**< Drop the new message, publisher never waits */
+    FuriPubSubOverflowWait, /**< Publisher waits for a free slot, messages published from the
+                                 subscription callback are dropped instead */
+} FuriPubSubOverflow;
+
+/** Asynchronous subscription counters, latency is in ticks from publish to delivery */
+typedef struct {
+    uint32_t delivered; /**< Messages delivered to the callback */
+    uint32_t dropped; /**< Messages dropped because queue was full */
+    uint32_t pending; /**< Messages waiting in the queue */
+    uint32_t latency_last; /**< Latency of the last delivered message */
+    uint32_t latency_max; /**< Maximum latency */
+    uint64_t latency_sum; /**< Latency sum of all delivered messages */
+} FuriPubSubSubscriptionStats;
+
 /** Allocate FuriPubSub
  *
  * Reentrable, Not threadsafe, one owner
@@ -44,9 +65,47 @@ void furi_pubsub_free(FuriPubSub* pubsub);
 FuriPubSubSubscription*
     furi_pubsub_subscribe(FuriPubSub* pubsub, FuriPubSubCallback callback, void* callback_context);
 
+/** Subscribe to FuriPubSub with asynchronous delivery
+ *
+ * Published message is copied into subscriber queue and callback is called from a separate
+ * thread with the priority of the subscribing thread, so slow callback doesn't block publisher.
+ * Callback gets pointer into the queue slot, valid until callback returns.
+ *
+ * Threadsafe, Reentrable
+ *
+ * @param      pubsub            pointer to FuriPubSub instance
+ * @param      message_size      size of published messages
+ * @param      queue_size        queue size in messages, rounded up to power of 2
+ * @param      overflow          what to do when queue is full
+ * @param[in]  callback          The callback
+ * @param      callback_context  The callback context
+ *
+ * @return     pointer to FuriPubSubSubscription instance
+ */
+FuriPubSubSubscription* furi_pubsub_subscribe_async(
+    FuriPubSub* pubsub,
+    size_t message_size,
+    size_t queue_size,
+    FuriPubSubOverflow overflow,
+    FuriPubSubCallback callback,
+    void* callback_context);
+
+/** Get asynchronous subscription counters
+ *
+ * Counters are zero for synchronous subscriptions
+ *
+ * @param      pubsub_subscription  pointer to FuriPubSubSubscription instance
+ * @param      stats                counters
+ */
+void furi_pubsub_subscription_get_stats(
+    FuriPubSubSubscription* pubsub_subscription,
+    FuriPubSubSubscriptionStats* stats);
+
 /** Unsubscribe from FuriPubSub
  * 
  * No use of `pubsub_subscription` allowed after call of this method
+ * Undelivered messages of asynchronous subscription are dropped, must not be called from
+ * the subscription callback.
  * Threadsafe, Reentrable.
  *
  * @param      pubsub               pointer to FuriPubSub instance
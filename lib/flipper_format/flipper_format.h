@@ -208,6 +208,18 @@ void flipper_format_free(FlipperFormat* flipper_format);
  */
 void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_mode);
 
+/** Enable key offset index.
+ *
+ * Positions of all keys are collected in one pass on the first key lookup, so
+ * reading, counting and updating values does not rescan the file from the
+ * start. Worth enabling for large files with many keys. Index is dropped on
+ * open and close, and when the raw stream is requested. Disabled by default.
+ *
+ * @param      flipper_format  Pointer to a FlipperFormat instance
+ * @param      enable          True to enable the index
+ */
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool enable);
+
 /** Rewind the RW pointer.
  *
  * @param      flipper_format  Pointer to a FlipperFormat instance
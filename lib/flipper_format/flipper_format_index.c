@@ -0,0 +1,283 @@
+#include <core/check.h>
+#include <core/string.h>
+#include <m-array.h>
+#include "flipper_format_index.h"
+#include "flipper_format_stream_i.h"
+
+// 8 bytes per key line, larger files are searched by scanning
+#define FLIPPER_FORMAT_INDEX_ENTRIES_MAX (1024U)
+#define FLIPPER_FORMAT_INDEX_BUFFER_SIZE (256U)
+
+typedef struct {
+    uint32_t line_start;
+    uint16_t key_id;
+} FlipperFormatIndexEntry;
+
+ARRAY_DEF(FlipperFormatIndexEntryArray, FlipperFormatIndexEntry, M_POD_OPLIST);
+ARRAY_DEF(FlipperFormatIndexKeyArray, FuriString*, FURI_STRING_OPLIST);
+
+typedef enum {
+    FlipperFormatIndexStateStale,
+    FlipperFormatIndexStateValid,
+    FlipperFormatIndexStateOverflow,
+} FlipperFormatIndexState;
+
+struct FlipperFormatIndex {
+    FlipperFormatIndexEntryArray_t entries; // In stream order
+    FlipperFormatIndexKeyArray_t keys; // Unique keys, entry key_id is an index here
+    FlipperFormatIndexState state;
+};
+
+FlipperFormatIndex* flipper_format_index_alloc(void) {
+    FlipperFormatIndex* index = malloc(sizeof(FlipperFormatIndex));
+    FlipperFormatIndexEntryArray_init(index->entries);
+    FlipperFormatIndexKeyArray_init(index->keys);
+    index->state = FlipperFormatIndexStateStale;
+    return index;
+}
+
+void flipper_format_index_free(FlipperFormatIndex* index) {
+    furi_check(index);
+    FlipperFormatIndexEntryArray_clear(index->entries);
+    FlipperFormatIndexKeyArray_clear(index->keys);
+    free(index);
+}
+
+void flipper_format_index_reset(FlipperFormatIndex* index) {
+    furi_check(index);
+    FlipperFormatIndexEntryArray_reset(index->entries);
+    FlipperFormatIndexKeyArray_reset(index->keys);
+    index->state = FlipperFormatIndexStateStale;
+}
+
+static bool flipper_format_index_find_key(
+    FlipperFormatIndex* index,
+    const char* key,
+    size_t key_size,
+    uint16_t* key_id) {
+    for(size_t i = 0; i < FlipperFormatIndexKeyArray_size(index->keys); i++) {
+        const FuriString* indexed_key = *FlipperFormatIndexKeyArray_cget(index->keys, i);
+        if(furi_string_size(indexed_key) == key_size &&
+           memcmp(furi_string_get_cstr(indexed_key), key, key_size) == 0) {
+            *key_id = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static uint16_t flipper_format_index_get_key_id(FlipperFormatIndex* index, const char* key) {
+    uint16_t key_id;
+    if(!flipper_format_index_find_key(index, key, strlen(key), &key_id)) {
+        key_id = FlipperFormatIndexKeyArray_size(index->keys);
+        FuriString* new_key = furi_string_alloc_set(key);
+        FlipperFormatIndexKeyArray_push_back(index->keys, new_key);
+        furi_string_free(new_key);
+    }
+
+    return key_id;
+}
+
+static bool
+    flipper_format_index_add(FlipperFormatIndex* index, size_t line_start, const char* key) {
+    if(FlipperFormatIndexEntryArray_size(index->entries) >= FLIPPER_FORMAT_INDEX_ENTRIES_MAX) {
+        return false;
+    }
+
+    FlipperFormatIndexEntry entry = {
+        .line_start = line_start,
+        .key_id = flipper_format_index_get_key_id(index, key),
+    };
+    FlipperFormatIndexEntryArray_push_back(index->entries, entry);
+    return true;
+}
+
+static void flipper_format_index_overflow(FlipperFormatIndex* index) {
+    FlipperFormatIndexEntryArray_reset(index->entries);
+    FlipperFormatIndexKeyArray_reset(index->keys);
+    index->state = FlipperFormatIndexStateOverflow;
+}
+
+// Same state machine as the key search in flipper_format_stream.c, run once over the stream
+static bool flipper_format_index_build(FlipperFormatIndex* index, Stream* stream) {
+    uint8_t buffer[FLIPPER_FORMAT_INDEX_BUFFER_SIZE];
+    FuriString* key = furi_string_alloc();
+
+    size_t offset = 0;
+    size_t line_start = 0;
+    bool accumulate = true;
+    bool new_line = true;
+    bool result = true;
+
+    while(result) {
+        size_t was_read = stream_read(stream, buffer, sizeof(buffer));
+        if(was_read == 0) break;
+
+        for(size_t i = 0; i < was_read; i++) {
+            uint8_t data = buffer[i];
+            if(data == flipper_format_eoln) {
+                furi_string_reset(key);
+                accumulate = true;
+                new_line = true;
+                line_start = offset + i + 1;
+            } else if(data == flipper_format_eolr) {
+                // ignore
+            } else if(data == flipper_format_comment && new_line) {
+                accumulate = false;
+                new_line = false;
+            } else if(data == flipper_format_delimiter) {
+                if(new_line) {
+                    furi_string_reset(key);
+                    accumulate = false;
+                    new_line = false;
+                } else if(accumulate) {
+                    if(!flipper_format_index_add(index, line_start, furi_string_get_cstr(key))) {
+                        result = false;
+                        break;
+                    }
+                    accumulate = false;
+                }
+            } else {
+                new_line = false;
+                if(accumulate) {
+                    furi_string_push_back(key, data);
+                }
+            }
+        }
+
+        offset += was_read;
+    }
+
+    furi_string_free(key);
+    return result;
+}
+
+bool flipper_format_index_update(FlipperFormatIndex* index, Stream* stream) {
+    furi_check(index);
+    furi_check(stream);
+
+    if(index->state == FlipperFormatIndexStateStale) {
+        size_t position = stream_tell(stream);
+        bool built = stream_rewind(stream) && flipper_format_index_build(index, stream);
+        if(!stream_seek(stream, position, StreamOffsetFromStart)) built = false;
+
+        if(built) {
+            index->state = FlipperFormatIndexStateValid;
+        } else {
+            flipper_format_index_overflow(index);
+        }
+    }
+
+    return index->state == FlipperFormatIndexStateValid;
+}
+
+bool flipper_format_index_has_key(FlipperFormatIndex* index, const char* key) {
+    furi_check(index);
+    furi_check(index->state == FlipperFormatIndexStateValid);
+
+    uint16_t key_id;
+    if(!flipper_format_index_find_key(index, key, strlen(key), &key_id)) return false;
+
+    for
+        M_EACH(entry, index->entries, FlipperFormatIndexEntryArray_t) {
+            if(entry->key_id == key_id) return true;
+        }
+
+    return false;
+}
+
+// First entry with line start at or after the position
+static size_t flipper_format_index_lower_bound(FlipperFormatIndex* index, size_t position) {
+    size_t low = 0;
+    size_t high = FlipperFormatIndexEntryArray_size(index->entries);
+
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(FlipperFormatIndexEntryArray_cget(index->entries, middle)->line_start < position) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+bool flipper_format_index_seek_to_key(
+    FlipperFormatIndex* index,
+    Stream* stream,
+    const char* key,
+    bool strict_mode,
+    size_t* line_start) {
+    furi_check(index);
+    furi_check(index->state == FlipperFormatIndexStateValid);
+
+    uint16_t key_id;
+    bool known = flipper_format_index_find_key(index, key, strlen(key), &key_id);
+
+    size_t count = FlipperFormatIndexEntryArray_size(index->entries);
+    size_t first = flipper_format_index_lower_bound(index, stream_tell(stream));
+    for(size_t i = first; i < count; i++) {
+        const FlipperFormatIndexEntry* entry =
+            FlipperFormatIndexEntryArray_cget(index->entries, i);
+
+        if(known && entry->key_id == key_id) {
+            if(line_start) *line_start = entry->line_start;
+            return stream_seek(stream, entry->line_start, StreamOffsetFromStart);
+        }
+
+        if(strict_mode) {
+            const FuriString* found_key =
+                *FlipperFormatIndexKeyArray_cget(index->keys, entry->key_id);
+            stream_seek(
+                stream, entry->line_start + furi_string_size(found_key), StreamOffsetFromStart);
+            return false;
+        }
+    }
+
+    stream_seek(stream, 0, StreamOffsetFromEnd);
+    return false;
+}
+
+void flipper_format_index_append(FlipperFormatIndex* index, size_t line_start, const char* key) {
+    furi_check(index);
+
+    if(index->state != FlipperFormatIndexStateValid) return;
+
+    if(!flipper_format_index_add(index, line_start, key)) {
+        flipper_format_index_overflow(index);
+    }
+}
+
+void flipper_format_index_replace(
+    FlipperFormatIndex* index,
+    size_t line_start,
+    size_t old_size,
+    size_t new_size,
+    const char* key) {
+    furi_check(index);
+
+    if(index->state != FlipperFormatIndexStateValid) return;
+
+    size_t i = flipper_format_index_lower_bound(index, line_start);
+    if(i == FlipperFormatIndexEntryArray_size(index->entries) ||
+       FlipperFormatIndexEntryArray_cget(index->entries, i)->line_start != line_start) {
+        // Not a line we know about, start over
+        flipper_format_index_reset(index);
+        return;
+    }
+
+    if(key) {
+        FlipperFormatIndexEntryArray_get(index->entries, i)->key_id =
+            flipper_format_index_get_key_id(index, key);
+        i++;
+    } else {
+        FlipperFormatIndexEntryArray_erase(index->entries, i);
+    }
+
+    for(; i < FlipperFormatIndexEntryArray_size(index->entries); i++) {
+        FlipperFormatIndexEntry* entry = FlipperFormatIndexEntryArray_get(index->entries, i);
+        entry->line_start = entry->line_start - old_size + new_size;
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <toolbox/stream/stream.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Key offset index.
+ *
+ * Keeps the position of every key line in the stream, so seeking to a key does
+ * not scan the stream. Built in one pass over the stream when first needed.
+ */
+typedef struct FlipperFormatIndex FlipperFormatIndex;
+
+/** Allocate index
+ *
+ * @return     FlipperFormatIndex* pointer to a FlipperFormatIndex instance
+ */
+FlipperFormatIndex* flipper_format_index_alloc(void);
+
+/** Free index
+ *
+ * @param      index  Pointer to a FlipperFormatIndex instance
+ */
+void flipper_format_index_free(FlipperFormatIndex* index);
+
+/** Drop indexed keys, index will be rebuilt when needed
+ *
+ * @param      index  Pointer to a FlipperFormatIndex instance
+ */
+void flipper_format_index_reset(FlipperFormatIndex* index);
+
+/** Build index if it was reset, stream position is preserved
+ *
+ * @param      index   Pointer to a FlipperFormatIndex instance
+ * @param      stream  Stream to index
+ *
+ * @return     true if index can be used, false if the stream is too large to be indexed
+ */
+bool flipper_format_index_update(FlipperFormatIndex* index, Stream* stream);
+
+/** Check if the key is present anywhere in the indexed stream
+ *
+ * @param      index  Pointer to a built FlipperFormatIndex instance
+ * @param      key    Key
+ *
+ * @return     true if key is present
+ */
+bool flipper_format_index_has_key(FlipperFormatIndex* index, const char* key);
+
+/** Seek to the start of the line with the key, searching from the current position.
+ *
+ * On failure the stream is left at the same position as after a scanning search: at
+ * the end of the stream, or in strict mode right at the delimiter of the first key found.
+ *
+ * @param      index        Pointer to a built FlipperFormatIndex instance
+ * @param      stream       Indexed stream
+ * @param      key          Key
+ * @param      strict_mode  Fail if the first key after the current position is another key
+ * @param      line_start   Line start position, can be NULL
+ *
+ * @return     true if the key is found
+ */
+bool flipper_format_index_seek_to_key(
+    FlipperFormatIndex* index,
+    Stream* stream,
+    const char* key,
+    bool strict_mode,
+    size_t* line_start);
+
+/** Add key line appended at the end of the stream
+ *
+ * @param      index       Pointer to a FlipperFormatIndex instance
+ * @param      line_start  Line start position
+ * @param      key         Key
+ */
+void flipper_format_index_append(FlipperFormatIndex* index, size_t line_start, const char* key);
+
+/** Replace key line, shifting lines after it
+ *
+ * @param      index       Pointer to a FlipperFormatIndex instance
+ * @param      line_start  Line start position
+ * @param      old_size    Replaced line size, including EOL
+ * @param      new_size    New line size, including EOL
+ * @param      key         New line key, NULL if the line was deleted
+ */
+void flipper_format_index_replace(
+    FlipperFormatIndex* index,
+    size_t line_start,
+    size_t old_size,
+    size_t new_size,
+    const char* key);
+
+#ifdef __cplusplus
+}
+#endif
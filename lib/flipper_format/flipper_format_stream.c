@@ -477,14 +477,23 @@ bool flipper_format_stream_delete_key_and_write(
     Stream* stream,
     FlipperStreamWriteData* write_data,
     bool strict_mode) {
+    if(!stream_rewind(stream)) return false;
+    return flipper_format_stream_delete_key_and_write_here(
+        stream, write_data, strict_mode, NULL, NULL);
+}
+
+bool flipper_format_stream_delete_key_and_write_here(
+    Stream* stream,
+    FlipperStreamWriteData* write_data,
+    bool strict_mode,
+    size_t* deleted_start,
+    size_t* deleted_end) {
     bool result = false;
 
     do {
         size_t size = stream_size(stream);
         if(size == 0) break;
 
-        if(!stream_rewind(stream)) break;
-
         // find key
         if(!flipper_format_stream_seek_to_key(stream, write_data->key, strict_mode)) break;
 
@@ -513,6 +522,8 @@ bool flipper_format_stream_delete_key_and_write(
                write_data))
             break;
 
+        if(deleted_start) *deleted_start = start_position;
+        if(deleted_end) *deleted_end = end_position;
         result = true;
     } while(false);
 
@@ -29,6 +29,24 @@ bool flipper_format_stream_write_eol(Stream* stream);
  */
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode);
 
+/**
+ * Delete key line and write data in its place.
+ * Key is searched from the current position of the stream.
+ * @param stream 
+ * @param write_data 
+ * @param strict_mode 
+ * @param deleted_start position of the deleted line start, can be NULL
+ * @param deleted_end position of the deleted line end, including EOL, can be NULL
+ * @return true on success
+ * @return false on error
+ */
+bool flipper_format_stream_delete_key_and_write_here(
+    Stream* stream,
+    FlipperStreamWriteData* write_data,
+    bool strict_mode,
+    size_t* deleted_start,
+    size_t* deleted_end);
+
 #ifdef __cplusplus
 }
 #endif
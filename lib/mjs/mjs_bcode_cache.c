@@ -0,0 +1,180 @@
+#include <furi.h>
+#include <storage/storage.h>
+#include <toolbox/md5_calc.h>
+#include <toolbox/version.h>
+#include "mjs_internal.h"
+#include "mjs_exec.h"
+
+#define TAG "MjsBcodeCache"
+
+#define MJS_BCODE_CACHE_MAGIC (0x43534A4DU) // "MJSC"
+#define MJS_BCODE_CACHE_SCRIPT_EXT ".js"
+#define MJS_BCODE_CACHE_EXT ".jsc"
+#define MJS_BCODE_CACHE_GITHASH_SIZE (16U)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    char githash[MJS_BCODE_CACHE_GITHASH_SIZE]; // zero padded, not terminated when full
+    uint32_t source_size;
+    uint32_t bcode_size;
+    uint8_t source_md5[16];
+} MjsBcodeCacheHeader;
+
+typedef struct {
+    Storage* storage;
+    const char* script_path;
+    FuriString* cache_path;
+    MjsBcodeCacheHeader header;
+} MjsBcodeCache;
+
+static void mjs_bcode_cache_init(MjsBcodeCache* cache, const char* path) {
+    memset(cache, 0, sizeof(MjsBcodeCache));
+    cache->storage = furi_record_open(RECORD_STORAGE);
+    cache->script_path = path;
+    cache->cache_path = furi_string_alloc_set(path);
+
+    if(furi_string_end_with_str(cache->cache_path, MJS_BCODE_CACHE_SCRIPT_EXT)) {
+        furi_string_left(
+            cache->cache_path,
+            furi_string_size(cache->cache_path) - strlen(MJS_BCODE_CACHE_SCRIPT_EXT));
+    }
+    furi_string_cat(cache->cache_path, MJS_BCODE_CACHE_EXT);
+}
+
+static void mjs_bcode_cache_deinit(MjsBcodeCache* cache) {
+    furi_string_free(cache->cache_path);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static bool mjs_bcode_cache_hash_script(MjsBcodeCache* cache) {
+    FileInfo file_info;
+    uint32_t generation;
+
+    if(storage_common_stat(cache->storage, cache->script_path, &file_info) != FSE_OK) return false;
+
+    if(!storage_common_md5_cache_get(
+           cache->storage, cache->script_path, cache->header.source_md5, &generation)) {
+        File* file = storage_file_alloc(cache->storage);
+        bool hashed = md5_calc_file(file, cache->script_path, cache->header.source_md5, NULL);
+        storage_file_free(file);
+        if(!hashed) return false;
+
+        storage_common_md5_cache_set(
+            cache->storage, cache->script_path, cache->header.source_md5, generation);
+    }
+
+    cache->header.magic = MJS_BCODE_CACHE_MAGIC;
+    cache->header.version = MJS_BCODE_VERSION;
+    // Opcodes and builtins may change between builds without a format version bump
+    strncpy(cache->header.githash, version_get_githash(NULL), sizeof(cache->header.githash));
+    cache->header.source_size = file_info.size;
+
+    return true;
+}
+
+// Leaves the file positioned at the bytecode if the header matches the script
+static bool mjs_bcode_cache_open(MjsBcodeCache* cache, File* file) {
+    MjsBcodeCacheHeader header;
+
+    if(!storage_file_open(
+           file, furi_string_get_cstr(cache->cache_path), FSAM_READ, FSOM_OPEN_EXISTING))
+        return false;
+    if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) return false;
+
+    cache->header.bcode_size = header.bcode_size;
+    if(memcmp(&header, &cache->header, sizeof(header)) != 0) return false;
+
+    return header.bcode_size == storage_file_size(file) - sizeof(header);
+}
+
+static char* mjs_bcode_cache_load(MjsBcodeCache* cache, size_t* bcode_size) {
+    File* file = storage_file_alloc(cache->storage);
+    char* bcode = NULL;
+
+    if(mjs_bcode_cache_open(cache, file)) {
+        size_t size = cache->header.bcode_size;
+        bcode = malloc(size);
+        if(storage_file_read(file, bcode, size) != size || !mjs_bcode_is_valid(bcode, size)) {
+            FURI_LOG_W(TAG, "Invalid %s", furi_string_get_cstr(cache->cache_path));
+            free(bcode);
+            bcode = NULL;
+        } else {
+            *bcode_size = size;
+        }
+    }
+
+    storage_file_free(file);
+
+    return bcode;
+}
+
+static void mjs_bcode_cache_save(
+    struct mjs* mjs,
+    const char* path,
+    const char* bcode,
+    size_t len,
+    void* context) {
+    UNUSED(mjs);
+    MjsBcodeCache* cache = context;
+
+    // Scripts loaded by the main one are parsed on every run
+    if(strcmp(path, cache->script_path) != 0) return;
+
+    cache->header.bcode_size = len;
+
+    File* file = storage_file_alloc(cache->storage);
+    bool saved =
+        storage_file_open(
+            file, furi_string_get_cstr(cache->cache_path), FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+        (storage_file_write(file, &cache->header, sizeof(cache->header)) ==
+         sizeof(cache->header)) &&
+        (storage_file_write(file, bcode, len) == len);
+    storage_file_free(file);
+
+    if(!saved) {
+        FURI_LOG_W(TAG, "Failed to save %s", furi_string_get_cstr(cache->cache_path));
+        storage_simply_remove(cache->storage, furi_string_get_cstr(cache->cache_path));
+    }
+}
+
+mjs_err_t mjs_exec_file_cached(struct mjs* mjs, const char* path, mjs_val_t* res) {
+    MjsBcodeCache cache;
+    mjs_bcode_cache_init(&cache, path);
+
+    bool script_hashed = mjs_bcode_cache_hash_script(&cache);
+    size_t bcode_size = 0;
+    char* bcode = script_hashed ? mjs_bcode_cache_load(&cache, &bcode_size) : NULL;
+
+    mjs_err_t err;
+    if(bcode) {
+        FURI_LOG_D(TAG, "Running %s", furi_string_get_cstr(cache.cache_path));
+        err = mjs_exec_bcode(mjs, bcode, bcode_size, res);
+    } else {
+        if(script_hashed) {
+            mjs_set_bcode_callback(mjs, mjs_bcode_cache_save, &cache);
+        }
+        err = mjs_exec_file(mjs, path, res);
+        mjs_set_bcode_callback(mjs, NULL, NULL);
+    }
+
+    mjs_bcode_cache_deinit(&cache);
+
+    return err;
+}
+
+int mjs_bcode_cache_is_fresh(const char* path) {
+    MjsBcodeCache cache;
+    mjs_bcode_cache_init(&cache, path);
+
+    bool fresh = false;
+    if(mjs_bcode_cache_hash_script(&cache)) {
+        File* file = storage_file_alloc(cache.storage);
+        fresh = mjs_bcode_cache_open(&cache, file);
+        storage_file_free(file);
+    }
+
+    mjs_bcode_cache_deinit(&cache);
+
+    return fresh;
+}
@@ -70,6 +70,10 @@ void mjs_destroy(struct mjs* mjs) {
     free(mjs);
 }
 
+MJS_PRIVATE void mjs_getprop_cache_reset(struct mjs* mjs) {
+    memset(mjs->getprop_cache, 0, sizeof(mjs->getprop_cache));
+}
+
 struct mjs* mjs_create(void* context) {
     mjs_val_t global_object;
     struct mjs* mjs = calloc(1, sizeof(*mjs));
@@ -114,6 +118,7 @@ struct mjs* mjs_create(void* context) {
         MJS_FUNC_FFI_ARENA_SIZE,
         MJS_FUNC_FFI_ARENA_INC_SIZE);
     mjs->ffi_sig_arena.destructor = mjs_ffi_sig_destructor;
+    mjs->object_arena.destructor = mjs_object_destructor;
 
     global_object = mjs_mk_object(mjs);
     mjs_init_builtin(mjs, global_object);
@@ -148,6 +153,11 @@ void mjs_set_exec_flags_poller(struct mjs* mjs, mjs_flags_poller_t poller) {
     mjs->exec_flags_poller = poller;
 }
 
+void mjs_set_bcode_callback(struct mjs* mjs, mjs_bcode_callback_t callback, void* context) {
+    mjs->bcode_callback = callback;
+    mjs->bcode_callback_context = context;
+}
+
 void* mjs_get_context(struct mjs* mjs) {
     return mjs->context;
 }
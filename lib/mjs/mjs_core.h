@@ -16,6 +16,10 @@ extern "C" {
 
 #define JUMP_INSTRUCTION_SIZE 2
 
+#ifndef MJS_GETPROP_CACHE_SIZE
+#define MJS_GETPROP_CACHE_SIZE 32
+#endif
+
 enum mjs_call_stack_frame_item {
     CALL_STACK_FRAME_ITEM_RETVAL_STACK_IDX, /* TOS */
     CALL_STACK_FRAME_ITEM_LOOP_ADDR_IDX,
@@ -38,6 +42,17 @@ struct mjs_vals {
     mjs_val_t last_getprop_obj;
 };
 
+/*
+ * Inline cache of an OP_GET site: the own property last found there. Sites
+ * share entries by bcode offset modulo MJS_GETPROP_CACHE_SIZE.
+ */
+struct mjs_getprop_cache {
+    size_t site; /* Global bcode offset of OP_GET */
+    mjs_val_t obj;
+    mjs_val_t key;
+    struct mjs_property* prop;
+};
+
 struct mjs_bcode_part {
     /* Global index of the bcode part */
     size_t start_idx;
@@ -83,12 +98,16 @@ struct mjs {
     ffi_cb_args_t* ffi_cb_args; /* List of FFI args descriptors */
     size_t cur_bcode_offset;
     mjs_flags_poller_t exec_flags_poller;
+    mjs_bcode_callback_t bcode_callback;
+    void* bcode_callback_context;
     void* context;
 
     struct gc_arena object_arena;
     struct gc_arena property_arena;
     struct gc_arena ffi_sig_arena;
 
+    struct mjs_getprop_cache getprop_cache[MJS_GETPROP_CACHE_SIZE];
+
     unsigned inhibit_gc : 1;
     unsigned need_gc : 1;
     unsigned generate_jsc : 1;
@@ -130,6 +149,12 @@ MJS_PRIVATE mjs_val_t mjs_pop(struct mjs* mjs);
 MJS_PRIVATE void mjs_push(struct mjs* mjs, mjs_val_t v);
 MJS_PRIVATE void mjs_die(struct mjs* mjs);
 
+/*
+ * Drops inline caches. Must be called whenever a cached property may go away
+ * or a cached value may move: on property deletion and on GC.
+ */
+MJS_PRIVATE void mjs_getprop_cache_reset(struct mjs* mjs);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -135,6 +135,13 @@ typedef enum mjs_err {
 
 typedef void (*mjs_flags_poller_t)(struct mjs* mjs);
 
+typedef void (*mjs_bcode_callback_t)(
+    struct mjs* mjs,
+    const char* path,
+    const char* bcode,
+    size_t len,
+    void* context);
+
 struct mjs;
 
 /* Create MJS instance */
@@ -227,6 +234,13 @@ void mjs_exit(struct mjs* mjs);
 
 void mjs_set_exec_flags_poller(struct mjs* mjs, mjs_flags_poller_t poller);
 
+/*
+ * Sets a callback which is given the bytecode of every parsed script, right
+ * before it is executed. The bytecode can be saved and run later with
+ * `mjs_exec_bcode()`.
+ */
+void mjs_set_bcode_callback(struct mjs* mjs, mjs_bcode_callback_t callback, void* context);
+
 void* mjs_get_context(struct mjs* mjs);
 
 /*
@@ -602,6 +602,50 @@ static int getprop_builtin(struct mjs* mjs, mjs_val_t val, mjs_val_t name, mjs_v
     return handled;
 }
 
+static int getprop_cache_hit(
+    struct mjs* mjs,
+    const struct mjs_getprop_cache* ic,
+    size_t site,
+    mjs_val_t obj,
+    mjs_val_t key) {
+    size_t n;
+    const char* s;
+
+    if(ic->site != site || ic->obj != obj) return 0;
+    if(ic->key == key) return 1;
+
+    /* Long names pushed by the site are new strings on every run */
+    if(!mjs_is_string(key)) return 0;
+    s = mjs_get_string(mjs, &key, &n);
+    return mjs_strcmp(mjs, &ic->prop->name, s, n) == 0;
+}
+
+/*
+ * Same as `mjs_get_v_proto()`, but remembers own properties of plain objects
+ * in the inline cache of the site
+ */
+static mjs_val_t getprop_object(
+    struct mjs* mjs,
+    struct mjs_getprop_cache* ic,
+    size_t site,
+    mjs_val_t obj,
+    mjs_val_t key) {
+    struct mjs_property* p = mjs_get_own_property_v(mjs, obj, key);
+
+    if(p != NULL) {
+        if((obj & MJS_TAG_MASK) == MJS_TAG_OBJECT && mjs_is_string(key)) {
+            ic->site = site;
+            ic->obj = obj;
+            ic->key = key;
+            ic->prop = p;
+        }
+        return p->value;
+    }
+
+    p = mjs_get_own_property(mjs, obj, MJS_PROTO_PROP_NAME, sizeof(MJS_PROTO_PROP_NAME) - 1);
+    return p == NULL ? MJS_UNDEFINED : mjs_get_v_proto(mjs, p->value, key);
+}
+
 MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
     size_t i;
     uint8_t prev_opcode = OP_MAX;
@@ -741,10 +785,14 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
             mjs_val_t obj = mjs_pop(mjs);
             mjs_val_t key = mjs_pop(mjs);
             mjs_val_t val = MJS_UNDEFINED;
+            size_t site = bp.start_idx + i;
+            struct mjs_getprop_cache* ic = &mjs->getprop_cache[site % MJS_GETPROP_CACHE_SIZE];
 
-            if(!getprop_builtin(mjs, obj, key, &val)) {
+            if(getprop_cache_hit(mjs, ic, site, obj, key)) {
+                val = ic->prop->value;
+            } else if(!getprop_builtin(mjs, obj, key, &val)) {
                 if(mjs_is_object(obj)) {
-                    val = mjs_get_v_proto(mjs, obj, key);
+                    val = getprop_object(mjs, ic, site, obj, key);
                 } else if((mjs_is_data_view(obj) && (mjs_is_number(key)))) {
                     val = mjs_dataview_get_prop(mjs, obj, key);
                 } else {
@@ -1139,6 +1187,11 @@ MJS_PRIVATE mjs_err_t mjs_exec_internal(
         (void)generate_jsc;
 #endif
 
+        if(mjs->bcode_callback != NULL) {
+            struct mjs_bcode_part* bp = mjs_bcode_part_get(mjs, mjs_bcode_parts_cnt(mjs) - 1);
+            mjs->bcode_callback(mjs, path, bp->data.p, bp->data.len, mjs->bcode_callback_context);
+        }
+
         mjs_execute(mjs, off, &r);
     }
     if(res != NULL) *res = r;
@@ -1170,6 +1223,47 @@ clean:
     return error;
 }
 
+/*
+ * Checks the layout committed by the parser: OP_BCODE_HEADER, header items,
+ * file name, bcode and line number map
+ */
+MJS_PRIVATE int mjs_bcode_is_valid(const char* bcode, size_t len) {
+    mjs_header_item_t hdr[MJS_HDR_ITEMS_CNT];
+
+    if(len < 1 + sizeof(hdr) || (uint8_t)bcode[0] != OP_BCODE_HEADER) return 0;
+    memcpy(hdr, bcode + 1, sizeof(hdr));
+
+    return hdr[MJS_HDR_ITEM_TOTAL_SIZE] == len - 1 && hdr[MJS_HDR_ITEM_BCODE_OFFSET] < len - 1 &&
+           hdr[MJS_HDR_ITEM_MAP_OFFSET] < len - 1;
+}
+
+mjs_err_t mjs_exec_bcode(struct mjs* mjs, char* bcode, size_t len, mjs_val_t* res) {
+    size_t off = mjs->bcode_len;
+    mjs_val_t r = MJS_UNDEFINED;
+    struct mjs_bcode_part bp;
+
+    if(!mjs_bcode_is_valid(bcode, len)) {
+        free(bcode);
+        mjs_set_errorf(mjs, MJS_BAD_ARGS_ERROR, "invalid bcode");
+        goto clean;
+    }
+
+    memset(&bp, 0, sizeof(bp));
+    bp.data.p = bcode;
+    bp.data.len = len;
+    bp.start_idx = mjs->bcode_len;
+    bp.exec_res = MJS_ERRS_CNT;
+    mjs_bcode_part_add(mjs, &bp);
+    mjs->bcode_len += len;
+
+    mjs->error = MJS_OK;
+    mjs_execute(mjs, off, &r);
+
+clean:
+    if(res != NULL) *res = r;
+    return mjs->error;
+}
+
 mjs_err_t
     mjs_call(struct mjs* mjs, mjs_val_t* res, mjs_val_t func, mjs_val_t this_val, int nargs, ...) {
     va_list ap;
@@ -20,6 +20,12 @@ extern "C" {
 
 MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res);
 
+/*
+ * Checks the header of bytecode given by the callback set with
+ * `mjs_set_bcode_callback()`, returns non-zero if it may be executed.
+ */
+MJS_PRIVATE int mjs_bcode_is_valid(const char* bcode, size_t len);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -16,6 +16,35 @@ extern "C" {
 mjs_err_t mjs_exec(struct mjs*, const char* src, mjs_val_t* res);
 
 mjs_err_t mjs_exec_file(struct mjs* mjs, const char* path, mjs_val_t* res);
+
+/*
+ * Version of the bytecode format. Must be bumped whenever bytecode saved by a
+ * former version may not run the same way.
+ */
+#define MJS_BCODE_VERSION 1
+
+/*
+ * Executes bytecode given by the callback set with `mjs_set_bcode_callback()`,
+ * skipping the parser. `bcode` must be allocated with malloc(), mjs takes
+ * ownership of it, also on error.
+ */
+mjs_err_t mjs_exec_bcode(struct mjs* mjs, char* bcode, size_t len, mjs_val_t* res);
+
+/*
+ * Same as `mjs_exec_file()`, but runs the bytecode cached next to the script,
+ * `<script>.jsc`, when it is up to date. If it is missing, stale or invalid,
+ * the script is parsed as usual and the cache is written anew. The cache is
+ * keyed on size and MD5 of the script, on MJS_BCODE_VERSION and on the
+ * firmware git hash. Scripts loaded by the given one are parsed every time.
+ */
+mjs_err_t mjs_exec_file_cached(struct mjs* mjs, const char* path, mjs_val_t* res);
+
+/*
+ * Returns non-zero if `mjs_exec_file_cached()` would run the script from its
+ * bytecode cache.
+ */
+int mjs_bcode_cache_is_fresh(const char* path);
+
 mjs_err_t mjs_apply(
     struct mjs* mjs,
     mjs_val_t* res,
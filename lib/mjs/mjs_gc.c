@@ -495,6 +495,7 @@ void mjs_gc(struct mjs* mjs, int full) {
     gc_mark_ffi_cbargs_list(mjs, mjs->ffi_cb_args);
 
     gc_compact_strings(mjs);
+    mjs_getprop_cache_reset(mjs);
 
     gc_sweep(mjs, &mjs->object_arena, 0);
     gc_sweep(mjs, &mjs->property_arena, 0);
@@ -12,6 +12,120 @@
 
 #include "common/mg_str.h"
 
+/*
+ * Objects with more properties than that get a hash index of property names,
+ * smaller ones are searched linearly.
+ */
+#ifndef MJS_PROPERTY_INDEX_THRESHOLD
+#define MJS_PROPERTY_INDEX_THRESHOLD 8
+#endif
+
+#define MJS_PROPERTY_INDEX_MIN_SIZE 16
+
+struct mjs_property_index_slot {
+    uint32_t hash;
+    struct mjs_property* prop;
+};
+
+/*
+ * Open addressing table with linear probing, kept at most 3/4 full.
+ * It holds pointers to property cells, which never move, so it survives GC.
+ */
+struct mjs_property_index {
+    size_t count; /* Number of properties of the object */
+    size_t mask; /* Number of slots minus one */
+    struct mjs_property_index_slot slots[];
+};
+
+static uint32_t mjs_property_name_hash(const char* name, size_t len) {
+    uint32_t hash = 2166136261u;
+    for(size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void mjs_property_index_insert(
+    struct mjs* mjs,
+    struct mjs_property_index* index,
+    struct mjs_property* prop) {
+    size_t len;
+    const char* name = mjs_get_string(mjs, &prop->name, &len);
+    uint32_t hash = mjs_property_name_hash(name, len);
+    size_t i = hash & index->mask;
+
+    while(index->slots[i].prop != NULL) {
+        i = (i + 1) & index->mask;
+    }
+    index->slots[i].hash = hash;
+    index->slots[i].prop = prop;
+}
+
+static struct mjs_property* mjs_property_index_find(
+    struct mjs* mjs,
+    struct mjs_property_index* index,
+    const char* name,
+    size_t len) {
+    uint32_t hash = mjs_property_name_hash(name, len);
+
+    for(size_t i = hash & index->mask; index->slots[i].prop != NULL; i = (i + 1) & index->mask) {
+        struct mjs_property_index_slot* slot = &index->slots[i];
+        if(slot->hash == hash && mjs_strcmp(mjs, &slot->prop->name, name, len) == 0) {
+            return slot->prop;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * (Re)builds the index from the property list, or drops it if the object
+ * became small enough. On allocation failure the list is used as is.
+ */
+static void mjs_object_index_build(struct mjs* mjs, struct mjs_object* o) {
+    struct mjs_property* p;
+    size_t count = 0, size = MJS_PROPERTY_INDEX_MIN_SIZE;
+
+    free(o->index);
+    o->index = NULL;
+
+    for(p = o->properties; p != NULL; p = p->next) count++;
+    if(count <= MJS_PROPERTY_INDEX_THRESHOLD) return;
+
+    while(size * 3 < count * 4) size <<= 1;
+
+    o->index = calloc(
+        1, sizeof(struct mjs_property_index) + size * sizeof(struct mjs_property_index_slot));
+    if(o->index == NULL) return;
+
+    o->index->count = count;
+    o->index->mask = size - 1;
+    for(p = o->properties; p != NULL; p = p->next) {
+        mjs_property_index_insert(mjs, o->index, p);
+    }
+}
+
+/* Accounts for a property just added at the head of the list */
+static void
+    mjs_object_index_add(struct mjs* mjs, struct mjs_object* o, struct mjs_property* p) {
+    struct mjs_property_index* index = o->index;
+
+    if(index != NULL && (index->count + 1) * 4 <= (index->mask + 1) * 3) {
+        mjs_property_index_insert(mjs, index, p);
+        index->count++;
+    } else {
+        mjs_object_index_build(mjs, o);
+    }
+}
+
+MJS_PRIVATE void mjs_object_destructor(struct mjs* mjs, void* cell) {
+    struct mjs_object* o = (struct mjs_object*)cell;
+    (void)mjs;
+    free(o->index);
+    o->index = NULL;
+}
+
 MJS_PRIVATE mjs_val_t mjs_object_to_value(struct mjs_object* o) {
     if(o == NULL) {
         return MJS_NULL;
@@ -61,6 +175,10 @@ MJS_PRIVATE struct mjs_property*
 
     o = get_object_struct(obj);
 
+    if(o->index != NULL) {
+        return mjs_property_index_find(mjs, o->index, name, len);
+    }
+
     if(len <= 5) {
         mjs_val_t ss = mjs_mk_string(mjs, name, len, 1);
         for(p = o->properties; p != NULL; p = p->next) {
@@ -199,6 +317,7 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
         o = get_object_struct(obj);
         p->next = o->properties;
         o->properties = p;
+        mjs_object_index_add(mjs, o, p);
     }
 
     p->value = val;
@@ -232,12 +351,17 @@ int mjs_del(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
         size_t n;
         const char* s = mjs_get_string(mjs, &prop->name, &n);
         if(n == len && strncmp(s, name, len) == 0) {
+            struct mjs_object* o = get_object_struct(obj);
             if(prev) {
                 prev->next = prop->next;
             } else {
-                get_object_struct(obj)->properties = prop->next;
+                o->properties = prop->next;
             }
             mjs_destroy_property(&prop);
+            if(o->index != NULL) {
+                mjs_object_index_build(mjs, o);
+            }
+            mjs_getprop_cache_reset(mjs);
             return 0;
         }
     }
@@ -21,8 +21,11 @@ struct mjs_property {
     mjs_val_t value; /* Property value */
 };
 
+struct mjs_property_index;
+
 struct mjs_object {
     struct mjs_property* properties;
+    struct mjs_property_index* index; /* Name hash of properties, for large objects only */
 };
 
 MJS_PRIVATE struct mjs_object* get_object_struct(mjs_val_t v);
@@ -32,6 +35,11 @@ MJS_PRIVATE struct mjs_property*
 MJS_PRIVATE struct mjs_property*
     mjs_get_own_property_v(struct mjs* mjs, mjs_val_t obj, mjs_val_t key);
 
+/*
+ * Frees the property index of an object cell that is being collected
+ */
+MJS_PRIVATE void mjs_object_destructor(struct mjs* mjs, void* cell);
+
 /*
  * A worker function for `mjs_set()` and `mjs_set_v()`: it takes name as both
  * ptr+len and mjs_val_t. If `name` pointer is not NULL, it takes precedence
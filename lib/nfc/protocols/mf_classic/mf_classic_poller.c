@@ -62,10 +62,12 @@ static NfcCommand mf_classic_poller_handle_data_update(MfClassicPoller* instance
     return instance->callback(instance->general_event, instance->context);
 }
 
-static void mf_classic_poller_check_key_b_is_readable(
+static bool mf_classic_poller_check_key_b_is_readable(
     MfClassicPoller* instance,
     uint8_t block_num,
     MfClassicBlock* data) {
+    bool key_b_found = false;
+
     do {
         if(!mf_classic_is_sector_trailer(block_num)) break;
         if(!mf_classic_is_allowed_access(
@@ -75,8 +77,67 @@ static void mf_classic_poller_check_key_b_is_readable(
         MfClassicSectorTrailer* sec_tr = (MfClassicSectorTrailer*)data;
         uint64_t key_b = bit_lib_bytes_to_num_be(sec_tr->key_b.data, sizeof(MfClassicKey));
         uint8_t sector_num = mf_classic_get_sector_by_block(block_num);
+        key_b_found = !mf_classic_is_key_found(instance->data, sector_num, MfClassicKeyTypeB);
         mf_classic_set_key_found(instance->data, sector_num, MfClassicKeyTypeB, key_b);
     } while(false);
+
+    return key_b_found;
+}
+
+static bool
+    mf_classic_poller_is_key_predicted(MfClassicPoller* instance, const MfClassicKey* key) {
+    MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
+
+    bool key_predicted = false;
+    for(uint8_t i = 0; (i < instance->sectors_total) && !key_predicted; i++) {
+        MfClassicSectorTrailer* sec_tr =
+            mf_classic_get_sector_trailer_by_sector(instance->data, i);
+        if(FURI_BIT(dict_attack_ctx->predicted_key_tried_mask[MfClassicKeyTypeA], i)) {
+            key_predicted = (memcmp(sec_tr->key_a.data, key->data, sizeof(MfClassicKey)) == 0);
+        }
+        if(FURI_BIT(dict_attack_ctx->predicted_key_tried_mask[MfClassicKeyTypeB], i) &&
+           !key_predicted) {
+            key_predicted = (memcmp(sec_tr->key_b.data, key->data, sizeof(MfClassicKey)) == 0);
+        }
+    }
+
+    return key_predicted;
+}
+
+static bool
+    mf_classic_poller_get_next_predicted_key(MfClassicPoller* instance, MfClassicKey* key) {
+    MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
+
+    // Candidates are keys which did not go through key reuse yet: keys provided with the
+    // initial data and keys B read out of sector trailers. Each unique key is tried once.
+    bool key_found = false;
+    for(uint8_t i = 0; (i < instance->sectors_total) && !key_found; i++) {
+        MfClassicSectorTrailer* sec_tr =
+            mf_classic_get_sector_trailer_by_sector(instance->data, i);
+        for(MfClassicKeyType key_type = MfClassicKeyTypeA; key_type <= MfClassicKeyTypeB;
+            key_type++) {
+            if(!FURI_BIT(dict_attack_ctx->predicted_key_mask[key_type], i)) continue;
+            FURI_BIT_CLEAR(dict_attack_ctx->predicted_key_mask[key_type], i);
+
+            const MfClassicKey* candidate =
+                (key_type == MfClassicKeyTypeA) ? &sec_tr->key_a : &sec_tr->key_b;
+            if(mf_classic_poller_is_key_predicted(instance, candidate)) continue;
+
+            FURI_BIT_SET(dict_attack_ctx->predicted_key_tried_mask[key_type], i);
+            *key = *candidate;
+            key_found = true;
+            break;
+        }
+    }
+
+    return key_found;
+}
+
+static uint32_t mf_classic_poller_get_sector_time_ms(MfClassicPoller* instance) {
+    MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
+
+    uint32_t ticks = furi_get_tick() - dict_attack_ctx->sector_start_tick;
+    return (uint32_t)((uint64_t)ticks * 1000 / furi_kernel_get_tick_frequency());
 }
 
 NfcCommand mf_classic_poller_handler_detect_type(MfClassicPoller* instance) {
@@ -121,7 +182,11 @@ NfcCommand mf_classic_poller_handler_start(MfClassicPoller* instance) {
     command = instance->callback(instance->general_event, instance->context);
 
     if(instance->mfc_event_data.poller_mode.mode == MfClassicPollerModeDictAttack) {
+        MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
         mf_classic_copy(instance->data, instance->mfc_event_data.poller_mode.data);
+        dict_attack_ctx->predicted_key_mask[MfClassicKeyTypeA] = instance->data->key_a_mask;
+        dict_attack_ctx->predicted_key_mask[MfClassicKeyTypeB] = instance->data->key_b_mask;
+        dict_attack_ctx->sector_start_tick = furi_get_tick();
         instance->state = MfClassicPollerStateRequestKey;
     } else if(instance->mfc_event_data.poller_mode.mode == MfClassicPollerModeRead) {
         instance->state = MfClassicPollerStateRequestReadSector;
@@ -509,13 +574,28 @@ NfcCommand mf_classic_poller_handler_request_key(MfClassicPoller* instance) {
     NfcCommand command = NfcCommandContinue;
     MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
 
-    instance->mfc_event.type = MfClassicPollerEventTypeRequestKey;
-    command = instance->callback(instance->general_event, instance->context);
-    if(instance->mfc_event_data.key_request_data.key_provided) {
-        dict_attack_ctx->current_key = instance->mfc_event_data.key_request_data.key;
-        instance->state = MfClassicPollerStateAuthKeyA;
+    MfClassicKey predicted_key = {};
+    if(mf_classic_poller_get_next_predicted_key(instance, &predicted_key)) {
+        // Known keys go through the key reuse pass over all sectors before the dictionary
+        FURI_LOG_D(TAG, "Trying predicted key on all sectors");
+        dict_attack_ctx->current_key = predicted_key;
+        dict_attack_ctx->current_key_type = MfClassicKeyTypeA;
+        dict_attack_ctx->auth_passed = false;
+        dict_attack_ctx->reuse_key_sector = 0;
+        instance->mfc_event.type = MfClassicPollerEventTypeKeyAttackStart;
+        instance->mfc_event_data.key_attack_data.current_sector =
+            dict_attack_ctx->reuse_key_sector;
+        command = instance->callback(instance->general_event, instance->context);
+        instance->state = MfClassicPollerStateKeyReuseAuthKeyA;
     } else {
-        instance->state = MfClassicPollerStateNextSector;
+        instance->mfc_event.type = MfClassicPollerEventTypeRequestKey;
+        command = instance->callback(instance->general_event, instance->context);
+        if(instance->mfc_event_data.key_request_data.key_provided) {
+            dict_attack_ctx->current_key = instance->mfc_event_data.key_request_data.key;
+            instance->state = MfClassicPollerStateAuthKeyA;
+        } else {
+            instance->state = MfClassicPollerStateNextSector;
+        }
     }
 
     return command;
@@ -599,12 +679,17 @@ NfcCommand mf_classic_poller_handler_next_sector(MfClassicPoller* instance) {
     NfcCommand command = NfcCommandContinue;
     MfClassicPollerDictAttackContext* dict_attack_ctx = &instance->mode_ctx.dict_attack_ctx;
 
+    uint32_t sector_time_ms = mf_classic_poller_get_sector_time_ms(instance);
+    FURI_LOG_D(TAG, "Sector %d done in %lu ms", dict_attack_ctx->current_sector, sector_time_ms);
+
     dict_attack_ctx->current_sector++;
+    dict_attack_ctx->sector_start_tick = furi_get_tick();
     if(dict_attack_ctx->current_sector == instance->sectors_total) {
         instance->state = MfClassicPollerStateSuccess;
     } else {
         instance->mfc_event.type = MfClassicPollerEventTypeNextSector;
         instance->mfc_event_data.next_sector_data.current_sector = dict_attack_ctx->current_sector;
+        instance->mfc_event_data.next_sector_data.sector_time_ms = sector_time_ms;
         command = instance->callback(instance->general_event, instance->context);
         instance->state = MfClassicPollerStateRequestKey;
     }
@@ -646,8 +731,10 @@ NfcCommand mf_classic_poller_handler_read_sector(MfClassicPoller* instance) {
             FURI_LOG_D(TAG, "Failed to read block %d", block_num);
         } else {
             mf_classic_set_block_read(instance->data, block_num, &block);
-            if(dict_attack_ctx->current_key_type == MfClassicKeyTypeA) {
-                mf_classic_poller_check_key_b_is_readable(instance, block_num, &block);
+            if((dict_attack_ctx->current_key_type == MfClassicKeyTypeA) &&
+               mf_classic_poller_check_key_b_is_readable(instance, block_num, &block)) {
+                uint8_t sector_num = mf_classic_get_sector_by_block(block_num);
+                FURI_BIT_SET(dict_attack_ctx->predicted_key_mask[MfClassicKeyTypeB], sector_num);
             }
         }
     } while(false);
@@ -809,8 +896,10 @@ NfcCommand mf_classic_poller_handler_key_reuse_read_sector(MfClassicPoller* inst
             FURI_LOG_D(TAG, "Failed to read block %d", block_num);
         } else {
             mf_classic_set_block_read(instance->data, block_num, &block);
-            if(dict_attack_ctx->current_key_type == MfClassicKeyTypeA) {
-                mf_classic_poller_check_key_b_is_readable(instance, block_num, &block);
+            if((dict_attack_ctx->current_key_type == MfClassicKeyTypeA) &&
+               mf_classic_poller_check_key_b_is_readable(instance, block_num, &block)) {
+                uint8_t sector_num = mf_classic_get_sector_by_block(block_num);
+                FURI_BIT_SET(dict_attack_ctx->predicted_key_mask[MfClassicKeyTypeB], sector_num);
             }
         }
     } while(false);
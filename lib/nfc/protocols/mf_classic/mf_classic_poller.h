@@ -65,6 +65,7 @@ typedef struct {
  */
 typedef struct {
     uint8_t current_sector; /**< Current sector number. */
+    uint32_t sector_time_ms; /**< Time spent on the previous sector, in milliseconds. */
 } MfClassicPollerEventDataDictAttackNextSector;
 
 /**
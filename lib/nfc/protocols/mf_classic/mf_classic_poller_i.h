@@ -70,6 +70,9 @@ typedef struct {
     bool auth_passed;
     uint16_t current_block;
     uint8_t reuse_key_sector;
+    uint64_t predicted_key_mask[MfClassicKeyTypeB + 1];
+    uint64_t predicted_key_tried_mask[MfClassicKeyTypeB + 1];
+    uint32_t sector_start_tick;
 } MfClassicPollerDictAttackContext;
 
 typedef struct {
@@ -20,6 +20,19 @@ void subghz_block_generic_get_preset_name(const char* preset_name, FuriString* p
     furi_string_set(preset_str, preset_name_temp);
 }
 
+void subghz_block_generic_get_result(
+    const SubGhzBlockGeneric* instance,
+    SubGhzProtocolDecoderResult* result) {
+    furi_check(instance);
+    furi_check(result);
+
+    result->key = instance->data;
+    result->bits = instance->data_count_bit;
+    result->serial = instance->serial;
+    result->button = instance->btn;
+    result->counter = instance->cnt;
+}
+
 SubGhzProtocolStatus subghz_block_generic_serialize(
     SubGhzBlockGeneric* instance,
     FlipperFormat* flipper_format,
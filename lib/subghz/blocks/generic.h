@@ -36,6 +36,15 @@ struct SubGhzBlockGeneric {
  */
 void subghz_block_generic_get_preset_name(const char* preset_name, FuriString* preset_str);
 
+/**
+ * Fill key fields of SubGhzProtocolDecoderResult from SubGhzBlockGeneric.
+ * @param instance Pointer to a SubGhzBlockGeneric instance
+ * @param result Pointer to a SubGhzProtocolDecoderResult instance
+ */
+void subghz_block_generic_get_result(
+    const SubGhzBlockGeneric* instance,
+    SubGhzProtocolDecoderResult* result);
+
 /**
  * Serialize data SubGhzBlockGeneric.
  * @param instance Pointer to a SubGhzBlockGeneric instance
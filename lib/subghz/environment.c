@@ -1,11 +1,21 @@
 #include "environment.h"
 #include "registry.h"
 
+#define TAG "SubGhzEnvironment"
+
+typedef enum {
+    SubGhzEnvironmentTableStateNotLoaded,
+    SubGhzEnvironmentTableStateLoaded,
+    SubGhzEnvironmentTableStateError,
+} SubGhzEnvironmentTableState;
+
 struct SubGhzEnvironment {
     SubGhzKeystore* keystore;
     const SubGhzProtocolRegistry* protocol_registry;
     const char* nice_flor_s_rainbow_table_file_name;
     const char* alutech_at_4n_rainbow_table_file_name;
+    SubGhzEnvironmentTableState nice_flor_s_rainbow_table_state;
+    uint8_t nice_flor_s_rainbow_table[SUBGHZ_ENVIRONMENT_NICE_FLOR_S_RAINBOW_TABLE_SIZE];
     const char* mfname;
     uint8_t kl_type;
 };
@@ -17,6 +27,7 @@ SubGhzEnvironment* subghz_environment_alloc(void) {
     instance->protocol_registry = NULL;
     instance->nice_flor_s_rainbow_table_file_name = NULL;
     instance->alutech_at_4n_rainbow_table_file_name = NULL;
+    instance->nice_flor_s_rainbow_table_state = SubGhzEnvironmentTableStateNotLoaded;
     instance->mfname = "";
     instance->kl_type = 0;
 
@@ -29,6 +40,7 @@ void subghz_environment_free(SubGhzEnvironment* instance) {
     instance->protocol_registry = NULL;
     instance->nice_flor_s_rainbow_table_file_name = NULL;
     instance->alutech_at_4n_rainbow_table_file_name = NULL;
+    memset(instance->nice_flor_s_rainbow_table, 0, sizeof(instance->nice_flor_s_rainbow_table));
     subghz_keystore_free(instance->keystore);
 
     free(instance);
@@ -82,6 +94,11 @@ void subghz_environment_set_nice_flor_s_rainbow_table_file_name(
     const char* filename) {
     furi_check(instance);
 
+    if(instance->nice_flor_s_rainbow_table_file_name != filename &&
+       (!instance->nice_flor_s_rainbow_table_file_name || !filename ||
+        strcmp(instance->nice_flor_s_rainbow_table_file_name, filename) != 0)) {
+        instance->nice_flor_s_rainbow_table_state = SubGhzEnvironmentTableStateNotLoaded;
+    }
     instance->nice_flor_s_rainbow_table_file_name = filename;
 }
 
@@ -92,6 +109,34 @@ const char*
     return instance->nice_flor_s_rainbow_table_file_name;
 }
 
+const uint8_t* subghz_environment_get_nice_flor_s_rainbow_table(SubGhzEnvironment* instance) {
+    furi_check(instance);
+
+    if(!instance->nice_flor_s_rainbow_table_file_name) return NULL;
+
+    if(instance->nice_flor_s_rainbow_table_state == SubGhzEnvironmentTableStateNotLoaded) {
+        // Whole table in one read, protocol only addresses the first 32 bytes
+        if(subghz_keystore_raw_get_data(
+               instance->nice_flor_s_rainbow_table_file_name,
+               0,
+               instance->nice_flor_s_rainbow_table,
+               SUBGHZ_ENVIRONMENT_NICE_FLOR_S_RAINBOW_TABLE_SIZE)) {
+            instance->nice_flor_s_rainbow_table_state = SubGhzEnvironmentTableStateLoaded;
+        } else {
+            FURI_LOG_E(
+                TAG,
+                "Unable to load rainbow table from %s",
+                instance->nice_flor_s_rainbow_table_file_name);
+            instance->nice_flor_s_rainbow_table_state = SubGhzEnvironmentTableStateError;
+        }
+    }
+
+    if(instance->nice_flor_s_rainbow_table_state != SubGhzEnvironmentTableStateLoaded) {
+        return NULL;
+    }
+    return instance->nice_flor_s_rainbow_table;
+}
+
 void subghz_environment_set_protocol_registry(
     SubGhzEnvironment* instance,
     const SubGhzProtocolRegistry* protocol_registry_items) {
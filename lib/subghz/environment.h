@@ -9,6 +9,8 @@
 extern "C" {
 #endif
 
+#define SUBGHZ_ENVIRONMENT_NICE_FLOR_S_RAINBOW_TABLE_SIZE 32
+
 typedef struct SubGhzEnvironment SubGhzEnvironment;
 typedef struct SubGhzProtocolRegistry SubGhzProtocolRegistry;
 
@@ -88,6 +90,14 @@ void subghz_environment_set_nice_flor_s_rainbow_table_file_name(
 const char*
     subghz_environment_get_nice_flor_s_rainbow_table_file_name(SubGhzEnvironment* instance);
 
+/**
+ * Get cached Nice Flor-S rainbow table.
+ * Table is read from the file once and kept until the filename changes.
+ * @param instance Pointer to a SubGhzEnvironment instance
+ * @return Pointer to the table bytes, NULL if not available
+ */
+const uint8_t* subghz_environment_get_nice_flor_s_rainbow_table(SubGhzEnvironment* instance);
+
 /**
  * Set list of protocols to work.
  * @param instance Pointer to a SubGhzEnvironment instance
@@ -55,6 +55,8 @@ const SubGhzProtocolDecoder ws_protocol_acurite_606tx_decoder = {
     .serialize = ws_protocol_decoder_acurite_606tx_serialize,
     .deserialize = ws_protocol_decoder_acurite_606tx_deserialize,
     .get_string = ws_protocol_decoder_acurite_606tx_get_string,
+
+    .timing = &ws_protocol_acurite_606tx_const,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_606tx_encoder = {
@@ -62,6 +62,8 @@ const SubGhzProtocolDecoder ws_protocol_acurite_986_decoder = {
     .serialize = ws_protocol_decoder_acurite_986_serialize,
     .deserialize = ws_protocol_decoder_acurite_986_deserialize,
     .get_string = ws_protocol_decoder_acurite_986_get_string,
+
+    .timing = &ws_protocol_acurite_986_const,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_986_encoder = {
@@ -59,6 +59,9 @@ const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder = {
     .serialize = subghz_protocol_decoder_alutech_at_4n_serialize,
     .deserialize = subghz_protocol_decoder_alutech_at_4n_deserialize,
     .get_string = subghz_protocol_decoder_alutech_at_4n_get_string,
+    .get_result = subghz_protocol_decoder_alutech_at_4n_get_result,
+
+    .timing = &subghz_protocol_alutech_at_4n_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_alutech_at_4n_encoder = {
@@ -658,6 +661,16 @@ uint32_t subghz_protocol_decoder_alutech_at_4n_get_hash_data(void* context) {
     return instance->crc;
 }
 
+void subghz_protocol_decoder_alutech_at_4n_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAlutech_at_4n* instance = context;
+    subghz_protocol_alutech_at_4n_remote_controller(
+        &instance->generic, instance->crc, instance->alutech_at_4n_rainbow_table_file_name);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_alutech_at_4n_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -79,6 +79,15 @@ void subghz_protocol_decoder_alutech_at_4n_feed(void* context, bool level, uint3
  */
 uint32_t subghz_protocol_decoder_alutech_at_4n_get_hash_data(void* context);
 
+/**
+ * Getting the fixed size result of the last received parcel, no formatting is done.
+ * @param context Pointer to a SubGhzProtocolDecoderAlutech_at_4n instance
+ * @param result Pointer to a SubGhzProtocolDecoderResult to fill
+ */
+void subghz_protocol_decoder_alutech_at_4n_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result);
+
 /**
  * Serialize data SubGhzProtocolDecoderAlutech_at_4n.
  * @param context Pointer to a SubGhzProtocolDecoderAlutech_at_4n instance
@@ -70,6 +70,8 @@ const SubGhzProtocolDecoder ws_protocol_ambient_weather_decoder = {
     .serialize = ws_protocol_decoder_ambient_weather_serialize,
     .deserialize = ws_protocol_decoder_ambient_weather_deserialize,
     .get_string = ws_protocol_decoder_ambient_weather_get_string,
+
+    .timing = &ws_protocol_ambient_weather_const,
 };
 
 const SubGhzProtocolEncoder ws_protocol_ambient_weather_encoder = {
@@ -54,6 +54,9 @@ const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .serialize = subghz_protocol_decoder_ansonic_serialize,
     .deserialize = subghz_protocol_decoder_ansonic_deserialize,
     .get_string = subghz_protocol_decoder_ansonic_get_string,
+    .get_result = subghz_protocol_decoder_ansonic_get_result,
+
+    .timing = &subghz_protocol_ansonic_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ansonic_encoder = {
@@ -303,6 +306,15 @@ uint32_t subghz_protocol_decoder_ansonic_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_ansonic_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAnsonic* instance = context;
+    subghz_protocol_ansonic_check_remote_controller(&instance->generic);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_ansonic_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -67,6 +67,8 @@ const SubGhzProtocolDecoder ws_protocol_auriol_ahfl_decoder = {
     .serialize = ws_protocol_decoder_auriol_ahfl_serialize,
     .deserialize = ws_protocol_decoder_auriol_ahfl_deserialize,
     .get_string = ws_protocol_decoder_auriol_ahfl_get_string,
+
+    .timing = &ws_protocol_auriol_ahfl_const,
 };
 
 const SubGhzProtocolEncoder ws_protocol_auriol_ahfl_encoder = {
@@ -91,3 +91,19 @@ uint32_t subghz_protocol_decoder_base_get_hash_data_long(SubGhzProtocolDecoderBa
 
     return hash;
 }
+
+void subghz_protocol_decoder_base_get_result(
+    SubGhzProtocolDecoderBase* decoder_base,
+    SubGhzProtocolDecoderResult* result) {
+    furi_check(decoder_base);
+    furi_check(result);
+
+    memset(result, 0, sizeof(SubGhzProtocolDecoderResult));
+    result->protocol = decoder_base->protocol;
+    result->hash = subghz_protocol_decoder_base_get_hash_data_long(decoder_base);
+
+    if(decoder_base->protocol && decoder_base->protocol->decoder &&
+       decoder_base->protocol->decoder->get_result) {
+        decoder_base->protocol->decoder->get_result(decoder_base, result);
+    }
+}
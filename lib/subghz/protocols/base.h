@@ -80,6 +80,16 @@ uint8_t subghz_protocol_decoder_base_get_hash_data(SubGhzProtocolDecoderBase* de
  */
 uint32_t subghz_protocol_decoder_base_get_hash_data_long(SubGhzProtocolDecoderBase* decoder_base);
 
+/**
+ * Getting the fixed size result of the last received parcel, no formatting is done.
+ * Protocols without result support only fill the protocol and hash.
+ * @param decoder_base Pointer to a SubGhzProtocolDecoderBase instance
+ * @param result Pointer to a SubGhzProtocolDecoderResult to fill
+ */
+void subghz_protocol_decoder_base_get_result(
+    SubGhzProtocolDecoderBase* decoder_base,
+    SubGhzProtocolDecoderResult* result);
+
 // Encoder Base
 typedef struct SubGhzProtocolEncoderBase SubGhzProtocolEncoderBase;
 
@@ -64,6 +64,9 @@ const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
     .serialize = subghz_protocol_decoder_bett_serialize,
     .deserialize = subghz_protocol_decoder_bett_deserialize,
     .get_string = subghz_protocol_decoder_bett_get_string,
+    .get_result = subghz_protocol_decoder_bett_get_result,
+
+    .timing = &subghz_protocol_bett_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_bett_encoder = {
@@ -297,6 +300,12 @@ uint32_t subghz_protocol_decoder_bett_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_bett_get_result(void* context, SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderBETT* instance = context;
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_bett_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -60,6 +60,9 @@ const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .serialize = subghz_protocol_decoder_came_serialize,
     .deserialize = subghz_protocol_decoder_came_deserialize,
     .get_string = subghz_protocol_decoder_came_get_string,
+    .get_result = subghz_protocol_decoder_came_get_result,
+
+    .timing = &subghz_protocol_came_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_encoder = {
@@ -318,6 +321,12 @@ uint32_t subghz_protocol_decoder_came_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_came_get_result(void* context, SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCame* instance = context;
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_came_serialize(
     void* context,
     FlipperFormat* flipper_format,
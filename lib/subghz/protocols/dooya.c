@@ -49,6 +49,9 @@ const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
     .serialize = subghz_protocol_decoder_dooya_serialize,
     .deserialize = subghz_protocol_decoder_dooya_deserialize,
     .get_string = subghz_protocol_decoder_dooya_get_string,
+    .get_result = subghz_protocol_decoder_dooya_get_result,
+
+    .timing = &subghz_protocol_dooya_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_dooya_encoder = {
@@ -355,6 +358,13 @@ uint32_t subghz_protocol_decoder_dooya_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_dooya_get_result(void* context, SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDooya* instance = context;
+    subghz_protocol_dooya_check_remote_controller(&instance->generic);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_dooya_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -80,6 +80,13 @@ void subghz_protocol_decoder_dooya_feed(void* context, bool level, uint32_t dura
  */
 uint32_t subghz_protocol_decoder_dooya_get_hash_data(void* context);
 
+/**
+ * Getting the fixed size result of the last received parcel, no formatting is done.
+ * @param context Pointer to a SubGhzProtocolDecoderDooya instance
+ * @param result Pointer to a SubGhzProtocolDecoderResult to fill
+ */
+void subghz_protocol_decoder_dooya_get_result(void* context, SubGhzProtocolDecoderResult* result);
+
 /**
  * Serialize data SubGhzProtocolDecoderDooya.
  * @param context Pointer to a SubGhzProtocolDecoderDooya instance
@@ -70,6 +70,9 @@ const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
     .serialize = subghz_protocol_decoder_faac_slh_serialize,
     .deserialize = subghz_protocol_decoder_faac_slh_deserialize,
     .get_string = subghz_protocol_decoder_faac_slh_get_string,
+    .get_result = subghz_protocol_decoder_faac_slh_get_result,
+
+    .timing = &subghz_protocol_faac_slh_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_faac_slh_encoder = {
@@ -220,7 +223,7 @@ static bool subghz_protocol_faac_slh_gen_data(SubGhzProtocolEncoderFaacSLH* inst
     }
     for
         M_EACH(manufacture_code, *subghz_keystore_get_data(instance->keystore), SubGhzKeyArray_t) {
-            res = strcmp(furi_string_get_cstr(manufacture_code->name), instance->manufacture_name);
+            res = strcmp(manufacture_code->name, instance->manufacture_name);
             if(res == 0) {
                 switch(manufacture_code->type) {
                 case KEELOQ_LEARNING_FAAC:
@@ -552,18 +555,17 @@ static void subghz_protocol_faac_slh_check_remote_controller(
         faac_prog_mode = false;
     }
 
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            switch(manufacture_code->type) {
-            case KEELOQ_LEARNING_FAAC:
-                // FAAC Learning
-                man = subghz_protocol_keeloq_common_faac_learning(
-                    instance->seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(code_hop, man);
-                *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                break;
-            }
-        }
+    const uint64_t* faac_keys = NULL;
+    const SubGhzKey* const* faac_codes = NULL;
+    size_t faac_count = subghz_keystore_get_learning_type_keys(
+        keystore, KEELOQ_LEARNING_FAAC, &faac_keys, &faac_codes);
+    if(faac_count) {
+        // FAAC Learning, last FAAC key in the keystore is used
+        man = subghz_protocol_keeloq_common_faac_learning(
+            instance->seed, faac_keys[faac_count - 1]);
+        decrypt = subghz_protocol_keeloq_common_decrypt(code_hop, man);
+        *manufacture_name = faac_codes[faac_count - 1]->name;
+    }
     instance->cnt = decrypt & 0xFFFFF;
     // Backup counter in case when we need to use programming mode
     if(code_fix != 0x0) {
@@ -578,6 +580,16 @@ uint32_t subghz_protocol_decoder_faac_slh_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_faac_slh_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderFaacSLH* instance = context;
+    subghz_protocol_faac_slh_check_remote_controller(
+        &instance->generic, instance->keystore, &instance->manufacture_name);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_faac_slh_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -80,6 +80,13 @@ void subghz_protocol_decoder_holtek_feed(void* context, bool level, uint32_t dur
  */
 uint32_t subghz_protocol_decoder_holtek_get_hash_data(void* context);
 
+/**
+ * Getting the fixed size result of the last received parcel, no formatting is done.
+ * @param context Pointer to a SubGhzProtocolDecoderHoltek instance
+ * @param result Pointer to a SubGhzProtocolDecoderResult to fill
+ */
+void subghz_protocol_decoder_holtek_get_result(void* context, SubGhzProtocolDecoderResult* result);
+
 /**
  * Serialize data SubGhzProtocolDecoderHoltek.
  * @param context Pointer to a SubGhzProtocolDecoderHoltek instance
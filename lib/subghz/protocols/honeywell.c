@@ -171,14 +171,27 @@ SubGhzProtocolStatus
         subghz_protocol_honeywell_const.min_count_bit_for_found);
 }
 
+static void subghz_protocol_honeywell_check_remote_controller(SubGhzBlockGeneric* instance) {
+    instance->serial = (instance->data >> 24) & 0xFFFFF;
+    //not exactly button, but can contain btn data too.
+    instance->btn = (instance->data >> 16) & 0xFF;
+}
+
+void subghz_protocol_decoder_honeywell_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoneywell* instance = context;
+    subghz_protocol_honeywell_check_remote_controller(&instance->generic);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 void subghz_protocol_decoder_honeywell_get_string(void* context, FuriString* output) {
     furi_assert(context);
     SubGhzProtocolDecoderHoneywell* instance = context;
 
     // Parse here and not in decode to avoid visual glitches when loading from file
-    instance->generic.serial = (instance->generic.data >> 24) & 0xFFFFF;
-    instance->generic.btn = (instance->generic.data >> 16) &
-                            0xFF; //not exactly button, but can contain btn data too.
+    subghz_protocol_honeywell_check_remote_controller(&instance->generic);
 
     uint8_t channel = (instance->generic.data >> 44) & 0xF;
     uint8_t contact = (instance->generic.btn & 0x80) >> 7;
@@ -350,6 +363,8 @@ const SubGhzProtocolDecoder subghz_protocol_honeywell_decoder = {
     .serialize = subghz_protocol_decoder_honeywell_serialize,
     .deserialize = subghz_protocol_decoder_honeywell_deserialize,
     .get_string = subghz_protocol_decoder_honeywell_get_string,
+    .get_result = subghz_protocol_decoder_honeywell_get_result,
+    .timing = &subghz_protocol_honeywell_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_honeywell_encoder = {
@@ -30,6 +30,10 @@ void subghz_protocol_decoder_honeywell_feed(void* context, bool level, uint32_t
 
 uint32_t subghz_protocol_decoder_honeywell_get_hash_data(void* context);
 
+void subghz_protocol_decoder_honeywell_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result);
+
 SubGhzProtocolStatus subghz_protocol_decoder_honeywell_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -80,6 +80,15 @@ void subghz_protocol_decoder_honeywell_wdb_feed(void* context, bool level, uint3
  */
 uint32_t subghz_protocol_decoder_honeywell_wdb_get_hash_data(void* context);
 
+/**
+ * Getting the fixed size result of the last received parcel, no formatting is done.
+ * @param context Pointer to a SubGhzProtocolDecoderHoneywell_WDB instance
+ * @param result Pointer to a SubGhzProtocolDecoderResult to fill
+ */
+void subghz_protocol_decoder_honeywell_wdb_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result);
+
 /**
  * Serialize data SubGhzProtocolDecoderHoneywell_WDB.
  * @param context Pointer to a SubGhzProtocolDecoderHoneywell_WDB instance
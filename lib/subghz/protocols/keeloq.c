@@ -22,6 +22,33 @@ static const SubGhzBlockConst subghz_protocol_keeloq_const = {
     .min_count_bit_for_found = 64,
 };
 
+typedef enum {
+    KeeloqCandidateManKey, ///< Manufacture key is used as is
+    KeeloqCandidateManNormal, ///< Normal learning derived from the key
+    KeeloqCandidateManSecure, ///< Secure learning derived from the key
+    KeeloqCandidateManReady, ///< Manufacture key is already computed
+} KeeloqCandidateMan;
+
+typedef struct {
+    const SubGhzKey* manufacture_code;
+    uint8_t man_type;
+    uint8_t kl_type; ///< 0 - keep keystore kl_type as is
+    bool centurion;
+} KeeloqCandidate;
+
+/*
+ * Candidates are collected in keystore order and checked KEELOQ_BATCH_SIZE at once
+ * with the bitsliced decrypt, first matching candidate wins
+ */
+typedef struct {
+    KeeloqCandidate candidates[KEELOQ_BATCH_SIZE];
+    uint64_t keys[KEELOQ_BATCH_SIZE];
+    uint64_t man[KEELOQ_BATCH_SIZE];
+    uint64_t learning[KEELOQ_BATCH_SIZE];
+    uint32_t decrypt[KEELOQ_BATCH_SIZE];
+    size_t count;
+} KeeloqCandidateBatch;
+
 struct SubGhzProtocolDecoderKeeloq {
     SubGhzProtocolDecoderBase base;
 
@@ -33,6 +60,7 @@ struct SubGhzProtocolDecoderKeeloq {
     const char* manufacture_name;
 
     FuriString* manufacture_from_file;
+    KeeloqCandidateBatch* batch; // Too big for the worker thread stack
 };
 
 struct SubGhzProtocolEncoderKeeloq {
@@ -45,6 +73,7 @@ struct SubGhzProtocolEncoderKeeloq {
     const char* manufacture_name;
 
     FuriString* manufacture_from_file;
+    KeeloqCandidateBatch* batch; // Too big for the worker thread stack
 };
 
 typedef enum {
@@ -66,6 +95,9 @@ const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .serialize = subghz_protocol_decoder_keeloq_serialize,
     .deserialize = subghz_protocol_decoder_keeloq_deserialize,
     .get_string = subghz_protocol_decoder_keeloq_get_string,
+    .get_result = subghz_protocol_decoder_keeloq_get_result,
+
+    .timing = &subghz_protocol_keeloq_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_keeloq_encoder = {
@@ -92,11 +124,13 @@ const SubGhzProtocol subghz_protocol_keeloq = {
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param batch Pointer to a KeeloqCandidateBatch, owned by the protocol instance
  * @param manufacture_name
  */
 static void subghz_protocol_keeloq_check_remote_controller(
     SubGhzBlockGeneric* instance,
     SubGhzKeystore* keystore,
+    KeeloqCandidateBatch* batch,
     const char** manufacture_name);
 
 void* subghz_protocol_encoder_keeloq_alloc(SubGhzEnvironment* environment) {
@@ -112,6 +146,7 @@ void* subghz_protocol_encoder_keeloq_alloc(SubGhzEnvironment* environment) {
     instance->encoder.is_running = false;
 
     instance->manufacture_from_file = furi_string_alloc();
+    instance->batch = malloc(sizeof(KeeloqCandidateBatch));
 
     return instance;
 }
@@ -120,6 +155,7 @@ void subghz_protocol_encoder_keeloq_free(void* context) {
     furi_assert(context);
     SubGhzProtocolEncoderKeeloq* instance = context;
     furi_string_free(instance->manufacture_from_file);
+    free(instance->batch);
     free(instance->encoder.upload);
     free(instance);
 }
@@ -270,8 +306,7 @@ static bool subghz_protocol_keeloq_gen_data(
                     manufacture_code,
                     *subghz_keystore_get_data(instance->keystore),
                     SubGhzKeyArray_t) {
-                    res = strcmp(
-                        furi_string_get_cstr(manufacture_code->name), instance->manufacture_name);
+                    res = strcmp(manufacture_code->name, instance->manufacture_name);
                     if(res == 0) {
                         switch(manufacture_code->type) {
                         case KEELOQ_LEARNING_SIMPLE:
@@ -537,7 +572,7 @@ SubGhzProtocolStatus
         }
 
         subghz_protocol_keeloq_check_remote_controller(
-            &instance->generic, instance->keystore, &instance->manufacture_name);
+            &instance->generic, instance->keystore, instance->batch, &instance->manufacture_name);
 
         //optional parameter parameter
         flipper_format_read_uint32(
@@ -597,6 +632,7 @@ void* subghz_protocol_decoder_keeloq_alloc(SubGhzEnvironment* environment) {
     instance->generic.protocol_name = instance->base.protocol->name;
     instance->keystore = subghz_environment_get_keystore(environment);
     instance->manufacture_from_file = furi_string_alloc();
+    instance->batch = malloc(sizeof(KeeloqCandidateBatch));
 
     subghz_custom_btn_set_prog_mode(PROG_MODE_OFF);
 
@@ -607,6 +643,7 @@ void subghz_protocol_decoder_keeloq_free(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
     furi_string_free(instance->manufacture_from_file);
+    free(instance->batch);
 
     free(instance);
 }
@@ -763,12 +800,91 @@ static inline bool subghz_protocol_keeloq_check_decrypt_centurion(
     return false;
 }
 
+static void subghz_protocol_keeloq_candidate_push(
+    KeeloqCandidateBatch* batch,
+    const SubGhzKey* manufacture_code,
+    KeeloqCandidateMan man_type,
+    uint64_t key,
+    uint8_t kl_type) {
+    KeeloqCandidate* candidate = &batch->candidates[batch->count];
+    candidate->manufacture_code = manufacture_code;
+    candidate->man_type = man_type;
+    candidate->kl_type = kl_type;
+    candidate->centurion = false;
+    batch->keys[batch->count] = key;
+    batch->count++;
+}
+
+/** 
+ * Decrypt hop with every candidate of the batch and check the result
+ * @param instance Pointer to a SubGhzBlockGeneric* instance
+ * @param batch Pointer to a KeeloqCandidateBatch, emptied on return
+ * @param fix Fix part of the parcel
+ * @param hop Hop encrypted part of the parcel
+ * @return matching candidate or NULL
+ */
+static const KeeloqCandidate* subghz_protocol_keeloq_candidate_batch_check(
+    SubGhzBlockGeneric* instance,
+    KeeloqCandidateBatch* batch,
+    uint32_t fix,
+    uint32_t hop) {
+    uint16_t end_serial = (uint16_t)(fix & 0xFF);
+    uint8_t btn = (uint8_t)(fix >> 28);
+    bool has_normal = false;
+    bool has_secure = false;
+    size_t count = batch->count;
+    batch->count = 0;
+
+    for(size_t i = 0; i < count; i++) {
+        if(batch->candidates[i].man_type == KeeloqCandidateManNormal) has_normal = true;
+        if(batch->candidates[i].man_type == KeeloqCandidateManSecure) has_secure = true;
+        batch->man[i] = batch->keys[i];
+    }
+
+    // Learning is computed for every lane, only results of matching candidates are kept
+    if(has_normal) {
+        subghz_protocol_keeloq_common_normal_learning_batch(
+            fix, batch->keys, count, batch->learning);
+        for(size_t i = 0; i < count; i++) {
+            if(batch->candidates[i].man_type == KeeloqCandidateManNormal) {
+                batch->man[i] = batch->learning[i];
+            }
+        }
+    }
+    if(has_secure) {
+        subghz_protocol_keeloq_common_secure_learning_batch(
+            fix, instance->seed, batch->keys, count, batch->learning);
+        for(size_t i = 0; i < count; i++) {
+            if(batch->candidates[i].man_type == KeeloqCandidateManSecure) {
+                batch->man[i] = batch->learning[i];
+            }
+        }
+    }
+
+    subghz_protocol_keeloq_common_decrypt_batch(hop, batch->man, count, batch->decrypt);
+
+    for(size_t i = 0; i < count; i++) {
+        const KeeloqCandidate* candidate = &batch->candidates[i];
+        if(candidate->centurion) {
+            if(subghz_protocol_keeloq_check_decrypt_centurion(instance, batch->decrypt[i], btn)) {
+                return candidate;
+            }
+        } else if(subghz_protocol_keeloq_check_decrypt(
+                      instance, batch->decrypt[i], btn, end_serial)) {
+            return candidate;
+        }
+    }
+
+    return NULL;
+}
+
 /** 
  * Checking the accepted code against the database manafacture key
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param fix Fix part of the parcel
  * @param hop Hop encrypted part of the parcel
  * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param batch Pointer to a KeeloqCandidateBatch, owned by the protocol instance
  * @param manufacture_name 
  * @return true on successful search
  */
@@ -777,15 +893,12 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     uint32_t fix,
     uint32_t hop,
     SubGhzKeystore* keystore,
+    KeeloqCandidateBatch* batch,
     const char** manufacture_name) {
     // protocol HCS300 uses 10 bits in discriminator, HCS200 uses 8 bits, for backward compatibility, we are looking for the 8-bit pattern
     // HCS300 -> uint16_t end_serial = (uint16_t)(fix & 0x3FF);
     // HCS200 -> uint16_t end_serial = (uint16_t)(fix & 0xFF);
 
-    uint16_t end_serial = (uint16_t)(fix & 0xFF);
-    uint8_t btn = (uint8_t)(fix >> 28);
-    uint32_t decrypt = 0;
-    uint64_t man;
     bool mf_not_set = false;
     // TODO:
     // if(mfname == 0x0) {
@@ -799,186 +912,136 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     } else if(strcmp(mfname, "") == 0) {
         mf_not_set = true;
     }
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
-                switch(manufacture_code->type) {
-                case KEELOQ_LEARNING_SIMPLE:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_NORMAL:
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if((strcmp(furi_string_get_cstr(manufacture_code->name), "Centurion") == 0)) {
-                        if(subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn)) {
-                            *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                            keystore->mfname = *manufacture_name;
-                            return 1;
-                        }
-                    } else {
-                        if(subghz_protocol_keeloq_check_decrypt(
-                               instance, decrypt, btn, end_serial)) {
-                            *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                            keystore->mfname = *manufacture_name;
-                            return 1;
-                        }
-                    }
-                    break;
-                case KEELOQ_LEARNING_SECURE:
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_serial_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
-                    man = subghz_protocol_keeloq_common_magic_serial_type2_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
-                    man = subghz_protocol_keeloq_common_magic_serial_type3_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_UNKNOWN:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
 
-                    // Check for mirrored man
-                    uint64_t man_rev = 0;
-                    uint64_t man_rev_byte = 0;
-                    for(uint8_t i = 0; i < 64; i += 8) {
-                        man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                        man_rev = man_rev | man_rev_byte << (56 - i);
-                    }
-
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-
-                    //###########################
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
+    batch->count = 0;
+    const KeeloqCandidate* found = NULL;
+
+    size_t keys_count = 0;
+    const SubGhzKey* keys = subghz_keystore_get_manufacture_keys(
+        keystore, mf_not_set ? NULL : mfname, &keys_count);
+    size_t key_index = 0;
+    while(!found) {
+        const SubGhzKey* manufacture_code = NULL;
+        if(key_index < keys_count) {
+            manufacture_code = &keys[key_index++];
+        } else if(batch->count == 0) {
+            break;
+        }
 
-                    // Secure Learning
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 3;
-                        return 1;
-                    }
+        if(manufacture_code) {
+            uint64_t key = manufacture_code->key;
+            switch(manufacture_code->type) {
+            case KEELOQ_LEARNING_SIMPLE:
+                // Simple Learning
+                subghz_protocol_keeloq_candidate_push(
+                    batch, manufacture_code, KeeloqCandidateManKey, key, 0);
+                break;
+            case KEELOQ_LEARNING_NORMAL:
+                // Normal Learning
+                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+                subghz_protocol_keeloq_candidate_push(
+                    batch, manufacture_code, KeeloqCandidateManNormal, key, 0);
+                batch->candidates[batch->count - 1].centurion =
+                    (strcmp(manufacture_code->name, "Centurion") == 0);
+                break;
+            case KEELOQ_LEARNING_SECURE:
+                subghz_protocol_keeloq_candidate_push(
+                    batch, manufacture_code, KeeloqCandidateManSecure, key, 0);
+                break;
+            case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
+                subghz_protocol_keeloq_candidate_push(
+                    batch,
+                    manufacture_code,
+                    KeeloqCandidateManReady,
+                    subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, key),
+                    0);
+                break;
+            case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
+                subghz_protocol_keeloq_candidate_push(
+                    batch,
+                    manufacture_code,
+                    KeeloqCandidateManReady,
+                    subghz_protocol_keeloq_common_magic_serial_type1_learning(fix, key),
+                    0);
+                break;
+            case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
+                subghz_protocol_keeloq_candidate_push(
+                    batch,
+                    manufacture_code,
+                    KeeloqCandidateManReady,
+                    subghz_protocol_keeloq_common_magic_serial_type2_learning(fix, key),
+                    0);
+                break;
+            case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
+                subghz_protocol_keeloq_candidate_push(
+                    batch,
+                    manufacture_code,
+                    KeeloqCandidateManReady,
+                    subghz_protocol_keeloq_common_magic_serial_type3_learning(fix, key),
+                    0);
+                break;
+            case KEELOQ_LEARNING_UNKNOWN:
+                // Every learning type with direct and mirrored man, 8 candidates
+                if(batch->count > KEELOQ_BATCH_SIZE - 8) {
+                    found = subghz_protocol_keeloq_candidate_batch_check(instance, batch, fix, hop);
+                    if(found) break;
+                }
 
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 3;
-                        return 1;
-                    }
+                uint64_t man_rev = 0;
+                uint64_t man_rev_byte = 0;
+                for(uint8_t i = 0; i < 64; i += 8) {
+                    man_rev_byte = (uint8_t)(key >> i);
+                    man_rev = man_rev | man_rev_byte << (56 - i);
+                }
 
-                    // Magic xor type1 learning
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 4;
-                        return 1;
-                    }
+                // Simple Learning
+                subghz_protocol_keeloq_candidate_push(
+                    batch, manufacture_code, KeeloqCandidateManKey, key, 1);
+                subghz_protocol_keeloq_candidate_push(
+                    batch, manufacture_code, KeeloqCandidateManKey, man_rev, 1);
+                // Normal Learning
+                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+                subghz_protocol_keeloq_candidate_push(
+                    batch, manufacture_code, KeeloqCandidateManNormal, key, 2);
+                subghz_protocol_keeloq_candidate_push(
+                    batch, manufacture_code, KeeloqCandidateManNormal, man_rev, 2);
+                // Secure Learning
+                subghz_protocol_keeloq_candidate_push(
+                    batch, manufacture_code, KeeloqCandidateManSecure, key, 3);
+                subghz_protocol_keeloq_candidate_push(
+                    batch, manufacture_code, KeeloqCandidateManSecure, man_rev, 3);
+                // Magic xor type1 learning
+                subghz_protocol_keeloq_candidate_push(
+                    batch,
+                    manufacture_code,
+                    KeeloqCandidateManReady,
+                    subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, key),
+                    4);
+                subghz_protocol_keeloq_candidate_push(
+                    batch,
+                    manufacture_code,
+                    KeeloqCandidateManReady,
+                    subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev),
+                    4);
+                break;
+            }
+        }
 
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 4;
-                        return 1;
-                    }
+        // Flush when full or when keystore is exhausted
+        if(!found &&
+           (batch->count == KEELOQ_BATCH_SIZE || (key_index == keys_count && batch->count > 0))) {
+            found = subghz_protocol_keeloq_candidate_batch_check(instance, batch, fix, hop);
+        }
+    }
 
-                    break;
-                }
-            }
+    if(found) {
+        *manufacture_name = found->manufacture_code->name;
+        keystore->mfname = *manufacture_name;
+        if(found->kl_type) {
+            keystore->kl_type = found->kl_type;
         }
+        return 1;
+    }
 
     // MF not found
     *manufacture_name = "Unknown";
@@ -991,6 +1054,7 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
 static void subghz_protocol_keeloq_check_remote_controller(
     SubGhzBlockGeneric* instance,
     SubGhzKeystore* keystore,
+    KeeloqCandidateBatch* batch,
     const char** manufacture_name) {
     // Reverse key, split FIX and HOP parts
     uint64_t key = subghz_protocol_blocks_reverse_key(instance->data, instance->data_count_bit);
@@ -1022,7 +1086,7 @@ static void subghz_protocol_keeloq_check_remote_controller(
                 instance->cnt = key_hop >> 16;
             } else {
                 subghz_protocol_keeloq_check_remote_controller_selector(
-                    instance, key_fix, key_hop, keystore, manufacture_name);
+                    instance, key_fix, key_hop, keystore, batch, manufacture_name);
             }
         } else {
             // If we have mfname and its one of AN-Motors or HCS101 we should preform only check for this system
@@ -1039,7 +1103,7 @@ static void subghz_protocol_keeloq_check_remote_controller(
             } else {
                 // Else we have mfname that is not AN-Motors or HCS101 we should check it via default selector
                 subghz_protocol_keeloq_check_remote_controller_selector(
-                    instance, key_fix, key_hop, keystore, manufacture_name);
+                    instance, key_fix, key_hop, keystore, batch, manufacture_name);
             }
         }
         // Save original counter as temp counter in case of later usage of prog mode
@@ -1084,6 +1148,16 @@ uint32_t subghz_protocol_decoder_keeloq_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_keeloq_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKeeloq* instance = context;
+    subghz_protocol_keeloq_check_remote_controller(
+        &instance->generic, instance->keystore, instance->batch, &instance->manufacture_name);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_keeloq_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -1095,7 +1169,7 @@ SubGhzProtocolStatus subghz_protocol_decoder_keeloq_serialize(
         subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
 
     subghz_protocol_keeloq_check_remote_controller(
-        &instance->generic, instance->keystore, &instance->manufacture_name);
+        &instance->generic, instance->keystore, instance->batch, &instance->manufacture_name);
 
     if(strcmp(instance->manufacture_name, "BFT") == 0) {
         uint8_t seed_data[sizeof(uint32_t)] = {0};
@@ -1295,7 +1369,7 @@ void subghz_protocol_decoder_keeloq_get_string(void* context, FuriString* output
     SubGhzProtocolDecoderKeeloq* instance = context;
 
     subghz_protocol_keeloq_check_remote_controller(
-        &instance->generic, instance->keystore, &instance->manufacture_name);
+        &instance->generic, instance->keystore, instance->batch, &instance->manufacture_name);
 
     uint32_t code_found_hi = instance->generic.data >> 32;
     uint32_t code_found_lo = instance->generic.data & 0x00000000ffffffff;
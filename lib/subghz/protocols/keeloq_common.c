@@ -35,6 +35,67 @@ inline uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const
     return x;
 }
 
+/** Bitsliced KeeLoq NLF
+ * Algebraic normal form of KEELOQ_NLF, every bit of the arguments is a separate lane
+ * @param i0..i4 - NLF inputs, i0 is the least significant bit of the table index
+ * @return NLF output for every lane
+ */
+static inline uint32_t subghz_protocol_keeloq_common_nlf_bitsliced(
+    uint32_t i0,
+    uint32_t i1,
+    uint32_t i2,
+    uint32_t i3,
+    uint32_t i4) {
+    return i0 ^ i1 ^ (i0 & i1) ^ (i1 & i2) ^ (i0 & i3) ^ (i2 & i3) ^
+           (i4 & (i0 ^ i2 ^ (i0 & i1) ^ (i0 & i2) ^ (i1 & i3) ^ (i2 & i3)));
+}
+
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t data,
+    const uint64_t* keys,
+    size_t count,
+    uint32_t* result) {
+    furi_check(keys);
+    furi_check(result);
+    furi_check(count <= KEELOQ_BATCH_SIZE);
+
+    // Transpose keys: key_slices[n] holds bit n of every key
+    uint32_t key_slices[64] = {0};
+    for(size_t lane = 0; lane < count; lane++) {
+        uint64_t key = keys[lane];
+        for(uint8_t n = 0; n < 64; n++) {
+            key_slices[n] |= (uint32_t)bit(key, n) << lane;
+        }
+    }
+
+    // Same data in every lane, state is a circular buffer so shifting is just an offset change
+    uint32_t state[32];
+    for(uint8_t n = 0; n < 32; n++) {
+        state[n] = bit(data, n) ? UINT32_MAX : 0;
+    }
+
+    uint8_t offset = 0;
+#define slice(n) state[(offset + (n)) & 31]
+    for(uint32_t r = 0; r < 528; r++) {
+        uint32_t feedback =
+            slice(31) ^ slice(15) ^ key_slices[(15 - r) & 63] ^
+            subghz_protocol_keeloq_common_nlf_bitsliced(
+                slice(0), slice(8), slice(19), slice(25), slice(30));
+        // Old bit 31 is shifted out, its slot becomes new bit 0
+        offset = (offset - 1) & 31;
+        state[offset] = feedback;
+    }
+
+    for(size_t lane = 0; lane < count; lane++) {
+        uint32_t x = 0;
+        for(uint8_t n = 0; n < 32; n++) {
+            x |= bit(slice(n), lane) << n;
+        }
+        result[lane] = x;
+    }
+#undef slice
+}
+
 /** Normal Learning
  * @param data - serial number (28bit)
  * @param key - manufacture (64bit)
@@ -54,6 +115,23 @@ inline uint64_t subghz_protocol_keeloq_common_normal_learning(uint32_t data, con
     return ((uint64_t)k2 << 32) | k1; // key - shifrovanoya
 }
 
+void subghz_protocol_keeloq_common_normal_learning_batch(
+    uint32_t data,
+    const uint64_t* keys,
+    size_t count,
+    uint64_t* result) {
+    uint32_t k1[KEELOQ_BATCH_SIZE];
+    uint32_t k2[KEELOQ_BATCH_SIZE];
+
+    data &= 0x0FFFFFFF;
+    subghz_protocol_keeloq_common_decrypt_batch(data | 0x20000000, keys, count, k1);
+    subghz_protocol_keeloq_common_decrypt_batch(data | 0x60000000, keys, count, k2);
+
+    for(size_t i = 0; i < count; i++) {
+        result[i] = ((uint64_t)k2[i] << 32) | k1[i];
+    }
+}
+
 /** Secure Learning
  * @param data - serial number (28bit)
  * @param seed - seed number (32bit)
@@ -74,6 +152,24 @@ inline uint64_t subghz_protocol_keeloq_common_secure_learning(
     return ((uint64_t)k1 << 32) | k2;
 }
 
+void subghz_protocol_keeloq_common_secure_learning_batch(
+    uint32_t data,
+    uint32_t seed,
+    const uint64_t* keys,
+    size_t count,
+    uint64_t* result) {
+    uint32_t k1[KEELOQ_BATCH_SIZE];
+    uint32_t k2[KEELOQ_BATCH_SIZE];
+
+    data &= 0x0FFFFFFF;
+    subghz_protocol_keeloq_common_decrypt_batch(data, keys, count, k1);
+    subghz_protocol_keeloq_common_decrypt_batch(seed, keys, count, k2);
+
+    for(size_t i = 0; i < count; i++) {
+        result[i] = ((uint64_t)k1[i] << 32) | k2[i];
+    }
+}
+
 /** Magic_xor_type1 Learning
  * @param data - serial number (28bit)
  * @param xor - magic xor (64bit)
@@ -26,6 +26,11 @@
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2 7u
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3 8u
 
+/*
+ * Maximum amount of keys processed by one batch call, one key per bit of a machine word
+ */
+#define KEELOQ_BATCH_SIZE 32u
+
 /**
  * Simple Learning Encrypt
  * @param data - 0xBSSSCCCC, B(4bit) key, S(10bit) serial&0x3FF, C(16bit) counter
@@ -42,6 +47,20 @@ uint32_t subghz_protocol_keeloq_common_encrypt(const uint32_t data, const uint64
  */
 uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64_t key);
 
+/**
+ * Simple Learning Decrypt of the same data with multiple keys at once
+ * Bitsliced: every key is a lane of 32bit words, so all keys are processed in one 528 rounds pass
+ * @param data - keeloq encrypt data
+ * @param keys - manufacture keys (64bit), array of count elements
+ * @param count - amount of keys, KEELOQ_BATCH_SIZE max
+ * @param result - 0xBSSSCCCC for every key, array of count elements
+ */
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t data,
+    const uint64_t* keys,
+    size_t count,
+    uint32_t* result);
+
 /** 
  * Normal Learning
  * @param data - serial number (28bit)
@@ -50,6 +69,19 @@ uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64
  */
 uint64_t subghz_protocol_keeloq_common_normal_learning(uint32_t data, const uint64_t key);
 
+/**
+ * Normal Learning for multiple keys at once
+ * @param data - serial number (28bit)
+ * @param keys - manufacture keys (64bit), array of count elements
+ * @param count - amount of keys, KEELOQ_BATCH_SIZE max
+ * @param result - manufacture for this serial number (64bit) for every key
+ */
+void subghz_protocol_keeloq_common_normal_learning_batch(
+    uint32_t data,
+    const uint64_t* keys,
+    size_t count,
+    uint64_t* result);
+
 /** 
  * Secure Learning
  * @param data - serial number (28bit)
@@ -60,6 +92,21 @@ uint64_t subghz_protocol_keeloq_common_normal_learning(uint32_t data, const uint
 uint64_t
     subghz_protocol_keeloq_common_secure_learning(uint32_t data, uint32_t seed, const uint64_t key);
 
+/**
+ * Secure Learning for multiple keys at once
+ * @param data - serial number (28bit)
+ * @param seed - seed number (32bit)
+ * @param keys - manufacture keys (64bit), array of count elements
+ * @param count - amount of keys, KEELOQ_BATCH_SIZE max
+ * @param result - manufacture for this serial number (64bit) for every key
+ */
+void subghz_protocol_keeloq_common_secure_learning_batch(
+    uint32_t data,
+    uint32_t seed,
+    const uint64_t* keys,
+    size_t count,
+    uint64_t* result);
+
 /** 
  * Magic_xor_type1 Learning
  * @param data - serial number (28bit)
@@ -55,6 +55,9 @@ const SubGhzProtocolDecoder subghz_protocol_kinggates_stylo_4k_decoder = {
     .serialize = subghz_protocol_decoder_kinggates_stylo_4k_serialize,
     .deserialize = subghz_protocol_decoder_kinggates_stylo_4k_deserialize,
     .get_string = subghz_protocol_decoder_kinggates_stylo_4k_get_string,
+    .get_result = subghz_protocol_decoder_kinggates_stylo_4k_get_result,
+
+    .timing = &subghz_protocol_kinggates_stylo_4k_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kinggates_stylo_4k_encoder = {
@@ -147,7 +150,7 @@ static bool subghz_protocol_kinggates_stylo_4k_gen_data(
 
     for
         M_EACH(manufacture_code, *subghz_keystore_get_data(instance->keystore), SubGhzKeyArray_t) {
-            res = strcmp(furi_string_get_cstr(manufacture_code->name), "Kingates_Stylo4k");
+            res = strcmp(manufacture_code->name, "Kingates_Stylo4k");
             if(res == 0) {
                 //Simple Learning
                 decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
@@ -174,7 +177,7 @@ static bool subghz_protocol_kinggates_stylo_4k_gen_data(
     uint64_t encrypt = 0;
     for
         M_EACH(manufacture_code, *subghz_keystore_get_data(instance->keystore), SubGhzKeyArray_t) {
-            res = strcmp(furi_string_get_cstr(manufacture_code->name), "Kingates_Stylo4k");
+            res = strcmp(manufacture_code->name, "Kingates_Stylo4k");
             if(res == 0) {
                 //Simple Learning
                 encrypt = subghz_protocol_keeloq_common_encrypt(data, manufacture_code->key);
@@ -482,17 +485,22 @@ static void subghz_protocol_kinggates_stylo_4k_remote_controller(
     instance->btn = (fix >> 17) & 0x0F;
     instance->serial = ((fix >> 5) & 0xFFFF0000) | (fix & 0xFFFF);
 
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(manufacture_code->type == KEELOQ_LEARNING_SIMPLE) {
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(((decrypt >> 28) == instance->btn) && (((decrypt >> 24) & 0x0F) == 0x0C) &&
-                   (((decrypt >> 16) & 0xFF) == (instance->serial & 0xFF))) {
-                    ret = true;
-                    break;
-                }
+    const uint64_t* keys = NULL;
+    size_t keys_count =
+        subghz_keystore_get_learning_type_keys(keystore, KEELOQ_LEARNING_SIMPLE, &keys, NULL);
+    uint32_t batch_decrypt[KEELOQ_BATCH_SIZE];
+    for(size_t offset = 0; (offset < keys_count) && !ret; offset += KEELOQ_BATCH_SIZE) {
+        size_t count = MIN(keys_count - offset, KEELOQ_BATCH_SIZE);
+        subghz_protocol_keeloq_common_decrypt_batch(hop, &keys[offset], count, batch_decrypt);
+        for(size_t i = 0; i < count; i++) {
+            decrypt = batch_decrypt[i];
+            if(((decrypt >> 28) == instance->btn) && (((decrypt >> 24) & 0x0F) == 0x0C) &&
+               (((decrypt >> 16) & 0xFF) == (instance->serial & 0xFF))) {
+                ret = true;
+                break;
             }
         }
+    }
     if(ret) {
         instance->cnt = decrypt & 0xFFFF;
     } else {
@@ -509,6 +517,15 @@ uint32_t subghz_protocol_decoder_kinggates_stylo_4k_get_hash_data(void* context)
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_kinggates_stylo_4k_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKingGates_stylo_4k* instance = context;
+    subghz_protocol_kinggates_stylo_4k_remote_controller(&instance->generic, instance->keystore);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_kinggates_stylo_4k_serialize(
     void* context,
     FlipperFormat* flipper_format,
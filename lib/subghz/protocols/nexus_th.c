@@ -345,6 +345,8 @@ const SubGhzProtocolDecoder ws_protocol_nexus_th_decoder = {
     .serialize = ws_protocol_decoder_nexus_th_serialize,
     .deserialize = ws_protocol_decoder_nexus_th_deserialize,
     .get_string = ws_protocol_decoder_nexus_th_get_string,
+
+    .timing = &ws_protocol_nexus_th_const,
 };
 
 const SubGhzProtocolEncoder ws_protocol_nexus_th_encoder = {
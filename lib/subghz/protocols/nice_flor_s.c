@@ -32,7 +32,7 @@ struct SubGhzProtocolDecoderNiceFlorS {
     SubGhzBlockDecoder decoder;
     SubGhzBlockGeneric generic;
 
-    const char* nice_flor_s_rainbow_table_file_name;
+    SubGhzEnvironment* environment;
     uint64_t data;
 };
 
@@ -42,7 +42,7 @@ struct SubGhzProtocolEncoderNiceFlorS {
     SubGhzProtocolBlockEncoder encoder;
     SubGhzBlockGeneric generic;
 
-    const char* nice_flor_s_rainbow_table_file_name;
+    SubGhzEnvironment* environment;
 };
 
 typedef enum {
@@ -65,6 +65,9 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
     .serialize = subghz_protocol_decoder_nice_flor_s_serialize,
     .deserialize = subghz_protocol_decoder_nice_flor_s_deserialize,
     .get_string = subghz_protocol_decoder_nice_flor_s_get_string,
+    .get_result = subghz_protocol_decoder_nice_flor_s_get_result,
+
+    .timing = &subghz_protocol_nice_flor_s_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flor_s_encoder = {
@@ -91,18 +94,20 @@ const SubGhzProtocol subghz_protocol_nice_flor_s = {
 
 static void subghz_protocol_nice_flor_s_remote_controller(
     SubGhzBlockGeneric* instance,
-    const char* file_name);
+    const uint8_t* rainbow_table);
 
 void* subghz_protocol_encoder_nice_flor_s_alloc(SubGhzEnvironment* environment) {
     SubGhzProtocolEncoderNiceFlorS* instance = malloc(sizeof(SubGhzProtocolEncoderNiceFlorS));
 
     instance->base.protocol = &subghz_protocol_nice_flor_s;
     instance->generic.protocol_name = instance->base.protocol->name;
-    instance->nice_flor_s_rainbow_table_file_name =
-        subghz_environment_get_nice_flor_s_rainbow_table_file_name(environment);
-    if(instance->nice_flor_s_rainbow_table_file_name) {
+    instance->environment = environment;
+    // Preload, table is shared by all instances through the environment
+    if(subghz_environment_get_nice_flor_s_rainbow_table(environment)) {
         FURI_LOG_D(
-            TAG, "Loading rainbow table from %s", instance->nice_flor_s_rainbow_table_file_name);
+            TAG,
+            "Rainbow table loaded from %s",
+            subghz_environment_get_nice_flor_s_rainbow_table_file_name(environment));
     }
     instance->encoder.repeat = 10;
     instance->encoder.size_upload = 2400; //wrong!! upload 186*16 = 2976 - actual size about 1728
@@ -135,7 +140,7 @@ static uint8_t subghz_protocol_nice_flor_s_get_btn_code(void);
 static void subghz_protocol_encoder_nice_flor_s_get_upload(
     SubGhzProtocolEncoderNiceFlorS* instance,
     uint8_t btn,
-    const char* file_name) {
+    const uint8_t* rainbow_table) {
     furi_assert(instance);
     size_t index = 0;
     btn = instance->generic.btn;
@@ -164,7 +169,7 @@ static void subghz_protocol_encoder_nice_flor_s_get_upload(
         instance->generic.cnt = 0;
     }
     uint64_t decrypt = ((uint64_t)instance->generic.serial << 16) | instance->generic.cnt;
-    uint64_t enc_part = subghz_protocol_nice_flor_s_encrypt(decrypt, file_name);
+    uint64_t enc_part = subghz_protocol_nice_flor_s_encrypt(decrypt, rainbow_table);
 
     for(int i = 0; i < 16; i++) {
         static const uint64_t loops[16] = {
@@ -256,10 +261,11 @@ SubGhzProtocolStatus
         // flipper_format_read_uint32(
         // flipper_format, "Data", (uint32_t*)&instance->generic.data_2, 1);
 
-        subghz_protocol_nice_flor_s_remote_controller(
-            &instance->generic, instance->nice_flor_s_rainbow_table_file_name);
+        const uint8_t* rainbow_table =
+            subghz_environment_get_nice_flor_s_rainbow_table(instance->environment);
+        subghz_protocol_nice_flor_s_remote_controller(&instance->generic, rainbow_table);
         subghz_protocol_encoder_nice_flor_s_get_upload(
-            instance, instance->generic.btn, instance->nice_flor_s_rainbow_table_file_name);
+            instance, instance->generic.btn, rainbow_table);
 
         if(!flipper_format_rewind(flipper_format)) {
             FURI_LOG_E(TAG, "Rewind error");
@@ -375,21 +381,17 @@ static void subghz_protocol_nice_one_get_data(uint8_t* p, uint8_t num_parcel, ui
 }
 
 /** 
- * Read bytes from rainbow table
- * @param file_name Full path to rainbow table the file 
- * @param address Byte address in file
+ * Read byte from cached rainbow table
+ * @param rainbow_table Pointer to the table from SubGhzEnvironment
+ * @param address Byte address in table
  * @return data
  */
-static uint8_t
-    subghz_protocol_nice_flor_s_get_byte_in_file(const char* file_name, uint32_t address) {
-    if(!file_name) return 0;
+static inline uint8_t
+    subghz_protocol_nice_flor_s_get_byte(const uint8_t* rainbow_table, uint32_t address) {
+    if(!rainbow_table) return 0;
+    furi_assert(address < SUBGHZ_ENVIRONMENT_NICE_FLOR_S_RAINBOW_TABLE_SIZE);
 
-    uint8_t buffer[1] = {0};
-    if(subghz_keystore_raw_get_data(file_name, address, buffer, sizeof(uint8_t))) {
-        return buffer[0];
-    } else {
-        return 0;
-    }
+    return rainbow_table[address];
 }
 
 static inline void subghz_protocol_decoder_nice_flor_s_magic_xor(uint8_t* p, uint8_t k) {
@@ -398,17 +400,17 @@ static inline void subghz_protocol_decoder_nice_flor_s_magic_xor(uint8_t* p, uin
     }
 }
 
-uint64_t subghz_protocol_nice_flor_s_encrypt(uint64_t data, const char* file_name) {
+uint64_t subghz_protocol_nice_flor_s_encrypt(uint64_t data, const uint8_t* rainbow_table) {
     uint8_t* p = (uint8_t*)&data;
 
     uint8_t k = 0;
     for(uint8_t y = 0; y < 2; y++) {
-        k = subghz_protocol_nice_flor_s_get_byte_in_file(file_name, p[0] & 0x1f);
+        k = subghz_protocol_nice_flor_s_get_byte(rainbow_table, p[0] & 0x1f);
         subghz_protocol_decoder_nice_flor_s_magic_xor(p, k);
 
         p[5] &= 0x0f;
         p[0] ^= k & 0xe0;
-        k = subghz_protocol_nice_flor_s_get_byte_in_file(file_name, p[0] >> 3) + 0x25;
+        k = subghz_protocol_nice_flor_s_get_byte(rainbow_table, p[0] >> 3) + 0x25;
         subghz_protocol_decoder_nice_flor_s_magic_xor(p, k);
 
         p[5] &= 0x0f;
@@ -432,8 +434,9 @@ uint64_t subghz_protocol_nice_flor_s_encrypt(uint64_t data, const char* file_nam
     return data;
 }
 
-static uint64_t
-    subghz_protocol_nice_flor_s_decrypt(SubGhzBlockGeneric* instance, const char* file_name) {
+static uint64_t subghz_protocol_nice_flor_s_decrypt(
+    SubGhzBlockGeneric* instance,
+    const uint8_t* rainbow_table) {
     furi_assert(instance);
     uint64_t data = instance->data;
     uint8_t* p = (uint8_t*)&data;
@@ -450,12 +453,12 @@ static uint64_t
     p[1] = k;
 
     for(uint8_t y = 0; y < 2; y++) {
-        k = subghz_protocol_nice_flor_s_get_byte_in_file(file_name, p[0] >> 3) + 0x25;
+        k = subghz_protocol_nice_flor_s_get_byte(rainbow_table, p[0] >> 3) + 0x25;
         subghz_protocol_decoder_nice_flor_s_magic_xor(p, k);
 
         p[5] &= 0x0f;
         p[0] ^= k & 0x7;
-        k = subghz_protocol_nice_flor_s_get_byte_in_file(file_name, p[0] & 0x1f);
+        k = subghz_protocol_nice_flor_s_get_byte(rainbow_table, p[0] & 0x1f);
         subghz_protocol_decoder_nice_flor_s_magic_xor(p, k);
 
         p[5] &= 0x0f;
@@ -490,7 +493,7 @@ bool subghz_protocol_nice_flor_s_create_data(
     }
     uint64_t decrypt = ((uint64_t)instance->generic.serial << 16) | instance->generic.cnt;
     uint64_t enc_part = subghz_protocol_nice_flor_s_encrypt(
-        decrypt, instance->nice_flor_s_rainbow_table_file_name);
+        decrypt, subghz_environment_get_nice_flor_s_rainbow_table(instance->environment));
     uint8_t byte = btn << 4 | (0xF ^ btn ^ 0x3);
     instance->generic.data = (uint64_t)byte << 44 | enc_part;
 
@@ -517,11 +520,13 @@ void* subghz_protocol_decoder_nice_flor_s_alloc(SubGhzEnvironment* environment)
     SubGhzProtocolDecoderNiceFlorS* instance = malloc(sizeof(SubGhzProtocolDecoderNiceFlorS));
     instance->base.protocol = &subghz_protocol_nice_flor_s;
     instance->generic.protocol_name = instance->base.protocol->name;
-    instance->nice_flor_s_rainbow_table_file_name =
-        subghz_environment_get_nice_flor_s_rainbow_table_file_name(environment);
-    if(instance->nice_flor_s_rainbow_table_file_name) {
+    instance->environment = environment;
+    // Preload, table is shared by all instances through the environment
+    if(subghz_environment_get_nice_flor_s_rainbow_table(environment)) {
         FURI_LOG_D(
-            TAG, "Loading rainbow table from %s", instance->nice_flor_s_rainbow_table_file_name);
+            TAG,
+            "Rainbow table loaded from %s",
+            subghz_environment_get_nice_flor_s_rainbow_table_file_name(environment));
     }
     return instance;
 }
@@ -529,7 +534,7 @@ void* subghz_protocol_decoder_nice_flor_s_alloc(SubGhzEnvironment* environment)
 void subghz_protocol_decoder_nice_flor_s_free(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlorS* instance = context;
-    instance->nice_flor_s_rainbow_table_file_name = NULL;
+    instance->environment = NULL;
     free(instance);
 }
 
@@ -630,11 +635,11 @@ void subghz_protocol_decoder_nice_flor_s_feed(void* context, bool level, uint32_
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
- * @param file_name Full path to rainbow table the file 
+ * @param rainbow_table Pointer to the table from SubGhzEnvironment
  */
 static void subghz_protocol_nice_flor_s_remote_controller(
     SubGhzBlockGeneric* instance,
-    const char* file_name) {
+    const uint8_t* rainbow_table) {
     /*
     * Protocol Nice Flor-S
     * Packet format Nice Flor-s: START-P0-P1-P2-P3-P4-P5-P6-P7-STOP
@@ -676,12 +681,12 @@ static void subghz_protocol_nice_flor_s_remote_controller(
     *  further up to 15 with overflow
     * 
     */
-    if(!file_name) {
+    if(!rainbow_table) {
         instance->cnt = 0;
         instance->serial = 0;
         instance->btn = 0;
     } else {
-        uint64_t decrypt = subghz_protocol_nice_flor_s_decrypt(instance, file_name);
+        uint64_t decrypt = subghz_protocol_nice_flor_s_decrypt(instance, rainbow_table);
         instance->cnt = decrypt & 0xFFFF;
         instance->serial = (decrypt >> 16) & 0xFFFFFFF;
         instance->btn = (decrypt >> 48) & 0xF;
@@ -701,6 +706,17 @@ uint32_t subghz_protocol_decoder_nice_flor_s_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_nice_flor_s_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlorS* instance = context;
+    subghz_protocol_nice_flor_s_remote_controller(
+        &instance->generic,
+        subghz_environment_get_nice_flor_s_rainbow_table(instance->environment));
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_nice_flor_s_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -857,7 +873,8 @@ void subghz_protocol_decoder_nice_flor_s_get_string(void* context, FuriString* o
     SubGhzProtocolDecoderNiceFlorS* instance = context;
 
     subghz_protocol_nice_flor_s_remote_controller(
-        &instance->generic, instance->nice_flor_s_rainbow_table_file_name);
+        &instance->generic,
+        subghz_environment_get_nice_flor_s_rainbow_table(instance->environment));
 
     if(instance->generic.data_count_bit == NICE_ONE_COUNT_BIT) {
         furi_string_cat_printf(
@@ -46,7 +46,7 @@ void subghz_protocol_encoder_nice_flor_s_stop(void* context);
  */
 LevelDuration subghz_protocol_encoder_nice_flor_s_yield(void* context);
 
-uint64_t subghz_protocol_nice_flor_s_encrypt(uint64_t data, const char* file_name);
+uint64_t subghz_protocol_nice_flor_s_encrypt(uint64_t data, const uint8_t* rainbow_table);
 
 /**
  * Allocate SubGhzProtocolDecoderNiceFlorS.
@@ -82,6 +82,15 @@ void subghz_protocol_decoder_nice_flor_s_feed(void* context, bool level, uint32_
  */
 uint32_t subghz_protocol_decoder_nice_flor_s_get_hash_data(void* context);
 
+/**
+ * Getting the fixed size result of the last received parcel, no formatting is done.
+ * @param context Pointer to a SubGhzProtocolDecoderNiceFlorS instance
+ * @param result Pointer to a SubGhzProtocolDecoderResult to fill
+ */
+void subghz_protocol_decoder_nice_flor_s_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result);
+
 /**
  * Serialize data SubGhzProtocolDecoderNiceFlorS.
  * @param context Pointer to a SubGhzProtocolDecoderNiceFlorS instance
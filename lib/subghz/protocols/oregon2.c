@@ -419,6 +419,8 @@ const SubGhzProtocolDecoder ws_protocol_oregon2_decoder = {
     .serialize = ws_protocol_decoder_oregon2_serialize,
     .deserialize = ws_protocol_decoder_oregon2_deserialize,
     .get_string = ws_protocol_decoder_oregon2_get_string,
+
+    .timing = &ws_oregon2_const,
 };
 
 const SubGhzProtocol ws_protocol_oregon2 = {
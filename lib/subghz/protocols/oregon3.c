@@ -355,6 +355,8 @@ const SubGhzProtocolDecoder ws_protocol_oregon3_decoder = {
     .serialize = ws_protocol_decoder_oregon3_serialize,
     .deserialize = ws_protocol_decoder_oregon3_deserialize,
     .get_string = ws_protocol_decoder_oregon3_get_string,
+
+    .timing = &ws_oregon3_const,
 };
 
 const SubGhzProtocol ws_protocol_oregon3 = {
@@ -81,6 +81,8 @@ const SubGhzProtocolDecoder ws_protocol_oregon_v1_decoder = {
     .serialize = ws_protocol_decoder_oregon_v1_serialize,
     .deserialize = ws_protocol_decoder_oregon_v1_deserialize,
     .get_string = ws_protocol_decoder_oregon_v1_get_string,
+
+    .timing = &ws_protocol_oregon_v1_const,
 };
 
 const SubGhzProtocolEncoder ws_protocol_oregon_v1_encoder = {
@@ -80,6 +80,15 @@ void subghz_protocol_decoder_phoenix_v2_feed(void* context, bool level, uint32_t
  */
 uint32_t subghz_protocol_decoder_phoenix_v2_get_hash_data(void* context);
 
+/**
+ * Getting the fixed size result of the last received parcel, no formatting is done.
+ * @param context Pointer to a SubGhzProtocolDecoderPhoenix_V2 instance
+ * @param result Pointer to a SubGhzProtocolDecoderResult to fill
+ */
+void subghz_protocol_decoder_phoenix_v2_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result);
+
 /**
  * Serialize data SubGhzProtocolDecoderPhoenix_V2.
  * @param context Pointer to a SubGhzProtocolDecoderPhoenix_V2 instance
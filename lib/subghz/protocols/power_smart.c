@@ -57,6 +57,9 @@ const SubGhzProtocolDecoder subghz_protocol_power_smart_decoder = {
     .serialize = subghz_protocol_decoder_power_smart_serialize,
     .deserialize = subghz_protocol_decoder_power_smart_deserialize,
     .get_string = subghz_protocol_decoder_power_smart_get_string,
+    .get_result = subghz_protocol_decoder_power_smart_get_result,
+
+    .timing = &subghz_protocol_power_smart_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_power_smart_encoder = {
@@ -343,6 +346,15 @@ uint32_t subghz_protocol_decoder_power_smart_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_power_smart_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPowerSmart* instance = context;
+    subghz_protocol_power_smart_remote_controller(&instance->generic);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_power_smart_serialize(
     void* context,
     FlipperFormat* flipper_format,
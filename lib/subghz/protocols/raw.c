@@ -1,6 +1,7 @@
 #include "raw.h"
 #include <lib/flipper_format/flipper_format.h>
 #include "../subghz_file_encoder_worker.h"
+#include "../subghz_raw_file.h"
 
 #include "../blocks/const.h"
 #include "../blocks/decoder.h"
@@ -28,6 +29,8 @@ struct SubGhzProtocolDecoderRAW {
     uint16_t ind_write;
     Storage* storage;
     FlipperFormat* flipper_file;
+    SubGhzRawFileFormat file_format;
+    SubGhzRawFileWriter* file_writer;
     uint32_t file_is_open;
     FuriString* file_name;
     size_t sample_write;
@@ -159,6 +162,14 @@ bool subghz_protocol_raw_save_to_file_init(
             break;
         }
 
+        instance->file_writer = subghz_raw_file_writer_alloc(instance->file_format);
+        if(!subghz_raw_file_writer_start(instance->file_writer, instance->flipper_file)) {
+            FURI_LOG_E(TAG, "Unable to add RAW_Format");
+            subghz_raw_file_writer_free(instance->file_writer);
+            instance->file_writer = NULL;
+            break;
+        }
+
         instance->upload_raw = malloc(SUBGHZ_DOWNLOAD_MAX_SIZE * sizeof(int32_t));
         instance->file_is_open = RAWFileIsOpenWrite;
         instance->sample_write = 0;
@@ -177,8 +188,11 @@ static bool subghz_protocol_raw_save_to_file_write(SubGhzProtocolDecoderRAW* ins
 
     bool is_write = false;
     if(instance->file_is_open == RAWFileIsOpenWrite) {
-        if(!flipper_format_write_int32(
-               instance->flipper_file, "RAW_Data", instance->upload_raw, instance->ind_write)) {
+        if(!subghz_raw_file_writer_write(
+               instance->file_writer,
+               instance->flipper_file,
+               instance->upload_raw,
+               instance->ind_write)) {
             FURI_LOG_E(TAG, "Unable to add RAW_Data");
         } else {
             instance->sample_write += instance->ind_write;
@@ -197,6 +211,8 @@ void subghz_protocol_raw_save_to_file_stop(SubGhzProtocolDecoderRAW* instance) {
     if(instance->file_is_open != RAWFileIsOpenClose) {
         free(instance->upload_raw);
         instance->upload_raw = NULL;
+        subghz_raw_file_writer_free(instance->file_writer);
+        instance->file_writer = NULL;
         flipper_format_file_close(instance->flipper_file);
         flipper_format_free(instance->flipper_file);
         furi_record_close(RECORD_STORAGE);
@@ -213,6 +229,95 @@ void subghz_protocol_raw_save_to_file_pause(SubGhzProtocolDecoderRAW* instance,
     }
 }
 
+void subghz_protocol_raw_save_to_file_set_format(
+    SubGhzProtocolDecoderRAW* instance,
+    SubGhzRawFileFormat format) {
+    furi_check(instance);
+    furi_check(instance->file_is_open == RAWFileIsOpenClose);
+    instance->file_format = format;
+}
+
+bool subghz_protocol_raw_convert_file(
+    Storage* storage,
+    const char* path_in,
+    const char* path_out,
+    SubGhzRawFileFormat format) {
+    furi_check(storage);
+    furi_check(path_in);
+    furi_check(path_out);
+
+    FlipperFormat* file_in = flipper_format_buffered_file_alloc(storage);
+    FlipperFormat* file_out = flipper_format_file_alloc(storage);
+    SubGhzRawFileReader* reader = subghz_raw_file_reader_alloc();
+    SubGhzRawFileWriter* writer = subghz_raw_file_writer_alloc(format);
+    int32_t* samples = malloc(SUBGHZ_DOWNLOAD_MAX_SIZE * sizeof(int32_t));
+    FuriString* temp_str = furi_string_alloc();
+    uint32_t temp_data32;
+    bool result = false;
+
+    do {
+        if(!flipper_format_buffered_file_open_existing(file_in, path_in)) {
+            FURI_LOG_E(TAG, "Unable to open file for read: %s", path_in);
+            break;
+        }
+        if(!flipper_format_read_header(file_in, temp_str, &temp_data32) ||
+           furi_string_cmp_str(temp_str, SUBGHZ_RAW_FILE_TYPE) != 0) {
+            FURI_LOG_E(TAG, "Not a RAW file: %s", path_in);
+            break;
+        }
+        if(!flipper_format_read_string(file_in, "Protocol", temp_str)) {
+            FURI_LOG_E(TAG, "Missing Protocol");
+            break;
+        }
+
+        // Everything up to the Protocol value is kept as is
+        Stream* stream_in = flipper_format_get_raw_stream(file_in);
+        Stream* stream_out = flipper_format_get_raw_stream(file_out);
+        size_t header_size = stream_tell(stream_in);
+
+        if(!flipper_format_file_open_always(file_out, path_out)) {
+            FURI_LOG_E(TAG, "Unable to open file for write: %s", path_out);
+            break;
+        }
+        if(!stream_rewind(stream_in) ||
+           stream_copy(stream_in, stream_out, header_size) != header_size ||
+           stream_write_char(stream_out, '\n') != 1) {
+            FURI_LOG_E(TAG, "Unable to copy header");
+            break;
+        }
+
+        if(!subghz_raw_file_reader_start(reader, stream_in)) {
+            FURI_LOG_E(TAG, "Missing RAW_Data");
+            break;
+        }
+        if(!subghz_raw_file_writer_start(writer, file_out)) {
+            FURI_LOG_E(TAG, "Unable to add RAW_Format");
+            break;
+        }
+
+        result = true;
+        size_t count;
+        while((count = subghz_raw_file_reader_read(reader, samples, SUBGHZ_DOWNLOAD_MAX_SIZE))) {
+            if(!subghz_raw_file_writer_write(writer, file_out, samples, count)) {
+                FURI_LOG_E(TAG, "Unable to add samples");
+                result = false;
+                break;
+            }
+        }
+    } while(false);
+
+    furi_string_free(temp_str);
+    free(samples);
+    subghz_raw_file_writer_free(writer);
+    subghz_raw_file_reader_free(reader);
+    flipper_format_buffered_file_close(file_in);
+    flipper_format_file_close(file_out);
+    flipper_format_free(file_in);
+    flipper_format_free(file_out);
+
+    return result;
+}
+
 size_t subghz_protocol_raw_get_sample_write(SubGhzProtocolDecoderRAW* instance) {
     furi_check(instance);
     return instance->sample_write + instance->ind_write;
@@ -226,6 +331,8 @@ void* subghz_protocol_decoder_raw_alloc(SubGhzEnvironment* environment) {
     instance->ind_write = 0;
     instance->last_level = false;
     instance->file_is_open = RAWFileIsOpenClose;
+    instance->file_format = SubGhzRawFileFormatText;
+    instance->file_writer = NULL;
     instance->file_name = furi_string_alloc();
 
     return instance;
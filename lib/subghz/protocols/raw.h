@@ -1,6 +1,7 @@
 #pragma once
 
 #include "base.h"
+#include "../subghz_raw_file.h"
 
 #define SUBGHZ_PROTOCOL_RAW_NAME "RAW"
 
@@ -35,6 +36,29 @@ bool subghz_protocol_raw_save_to_file_init(
  */
 void subghz_protocol_raw_save_to_file_stop(SubGhzProtocolDecoderRAW* instance);
 
+/**
+ * Set format of the samples written to the file, text by default.
+ * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
+ * @param format SubGhzRawFileFormat, applied on the next subghz_protocol_raw_save_to_file_init
+ */
+void subghz_protocol_raw_save_to_file_set_format(
+    SubGhzProtocolDecoderRAW* instance,
+    SubGhzRawFileFormat format);
+
+/**
+ * Convert RAW file samples to another format, the header is copied as is.
+ * @param storage Pointer to a Storage instance
+ * @param path_in Path to the RAW file to read
+ * @param path_out Path to the file to write, must differ from path_in
+ * @param format SubGhzRawFileFormat to write samples in
+ * @return true On success
+ */
+bool subghz_protocol_raw_convert_file(
+    Storage* storage,
+    const char* path_in,
+    const char* path_out,
+    SubGhzRawFileFormat format);
+
 /**
  * Get the number of samples received SubGhzProtocolDecoderRAW.
  * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
@@ -87,6 +87,8 @@ const SubGhzProtocolDecoder tpms_protocol_schrader_gg4_decoder = {
     .serialize = tpms_protocol_decoder_schrader_gg4_serialize,
     .deserialize = tpms_protocol_decoder_schrader_gg4_deserialize,
     .get_string = tpms_protocol_decoder_schrader_gg4_get_string,
+
+    .timing = &tpms_protocol_schrader_gg4_const,
 };
 
 const SubGhzProtocolEncoder tpms_protocol_schrader_gg4_encoder = {
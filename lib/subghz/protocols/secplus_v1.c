@@ -71,6 +71,9 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v1_decoder = {
     .serialize = subghz_protocol_decoder_secplus_v1_serialize,
     .deserialize = subghz_protocol_decoder_secplus_v1_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v1_get_string,
+    .get_result = subghz_protocol_decoder_secplus_v1_get_result,
+
+    .timing = &subghz_protocol_secplus_v1_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v1_encoder = {
@@ -518,6 +521,34 @@ uint32_t subghz_protocol_decoder_secplus_v1_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+/** 
+ * Analysis of received data
+ * @param instance Pointer to a SubGhzBlockGeneric* instance
+ */
+static void subghz_protocol_secplus_v1_check_remote_controller(SubGhzBlockGeneric* instance) {
+    uint32_t fixed = (instance->data >> 32) & 0xFFFFFFFF;
+    instance->cnt = instance->data & 0xFFFFFFFF;
+    instance->btn = fixed % 3;
+
+    uint8_t id1 = (fixed / 9) % 3;
+    if(id1 == 0) {
+        // (fixed // 3**3) % (3**7)    3^3=27  3^73=72187
+        instance->serial = (fixed / 27) % 2187;
+    } else {
+        //id = fixed / 27;
+        instance->serial = fixed / 27;
+    }
+}
+
+void subghz_protocol_decoder_secplus_v1_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSecPlus_v1* instance = context;
+    subghz_protocol_secplus_v1_check_remote_controller(&instance->generic);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_secplus_v1_serialize(
     void* context,
     FlipperFormat* flipper_format,
@@ -553,10 +584,9 @@ void subghz_protocol_decoder_secplus_v1_get_string(void* context, FuriString* ou
     furi_assert(context);
     SubGhzProtocolDecoderSecPlus_v1* instance = context;
 
-    uint32_t fixed = (instance->generic.data >> 32) & 0xFFFFFFFF;
-    instance->generic.cnt = instance->generic.data & 0xFFFFFFFF;
+    subghz_protocol_secplus_v1_check_remote_controller(&instance->generic);
 
-    instance->generic.btn = fixed % 3;
+    uint32_t fixed = (instance->generic.data >> 32) & 0xFFFFFFFF;
     uint8_t id0 = (fixed / 3) % 3;
     uint8_t id1 = (fixed / 9) % 3;
     uint16_t pin = 0;
@@ -574,9 +604,6 @@ void subghz_protocol_decoder_secplus_v1_get_string(void* context, FuriString* ou
         id0);
 
     if(id1 == 0) {
-        // (fixed // 3**3) % (3**7)    3^3=27  3^73=72187
-
-        instance->generic.serial = (fixed / 27) % 2187;
         // pin = (fixed // 3**10) % (3**9)  3^10=59049 3^9=19683
         pin = (fixed / 59049) % 19683;
 
@@ -606,8 +633,6 @@ void subghz_protocol_decoder_secplus_v1_get_string(void* context, FuriString* ou
             instance->generic.cnt,
             instance->generic.btn);
     } else {
-        //id = fixed / 27;
-        instance->generic.serial = fixed / 27;
         if(instance->generic.btn == 1) {
             furi_string_cat_printf(output, " Btn:left\r\n");
         } else if(instance->generic.btn == 0) {
@@ -65,6 +65,9 @@ const SubGhzProtocolDecoder subghz_protocol_star_line_decoder = {
     .serialize = subghz_protocol_decoder_star_line_serialize,
     .deserialize = subghz_protocol_decoder_star_line_deserialize,
     .get_string = subghz_protocol_decoder_star_line_get_string,
+    .get_result = subghz_protocol_decoder_star_line_get_result,
+
+    .timing = &subghz_protocol_star_line_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_star_line_encoder = {
@@ -162,8 +165,7 @@ static bool
                 manufacture_code,
                 *subghz_keystore_get_data(instance->keystore),
                 SubGhzKeyArray_t) {
-                res = strcmp(
-                    furi_string_get_cstr(manufacture_code->name), instance->manufacture_name);
+                res = strcmp(manufacture_code->name, instance->manufacture_name);
                 if(res == 0) {
                     switch(manufacture_code->type) {
                     case KEELOQ_LEARNING_SIMPLE:
@@ -530,86 +532,80 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
     } else if(strcmp(mfname, "") == 0) {
         mf_not_set = true;
     }
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
-                switch(manufacture_code->type) {
-                case KEELOQ_LEARNING_SIMPLE:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_NORMAL:
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man_normal_learning =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_UNKNOWN:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-                    // Check for mirrored man
-                    uint64_t man_rev = 0;
-                    uint64_t man_rev_byte = 0;
-                    for(uint8_t i = 0; i < 64; i += 8) {
-                        man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                        man_rev = man_rev | man_rev_byte << (56 - i);
-                    }
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-                    //###########################
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man_normal_learning =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-                    // Check for mirrored man
-                    man_normal_learning =
-                        subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-                    break;
-                }
+    size_t keys_count = 0;
+    const SubGhzKey* keys = subghz_keystore_get_manufacture_keys(
+        keystore, mf_not_set ? NULL : mfname, &keys_count);
+    for(size_t key_index = 0; key_index < keys_count; key_index++) {
+        const SubGhzKey* manufacture_code = &keys[key_index];
+        switch(manufacture_code->type) {
+        case KEELOQ_LEARNING_SIMPLE:
+            // Simple Learning
+            decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
+            if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
+                *manufacture_name = manufacture_code->name;
+                keystore->mfname = *manufacture_name;
+                return 1;
             }
+            break;
+        case KEELOQ_LEARNING_NORMAL:
+            // Normal Learning
+            // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+            man_normal_learning =
+                subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
+            decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
+            if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
+                *manufacture_name = manufacture_code->name;
+                keystore->mfname = *manufacture_name;
+                return 1;
+            }
+            break;
+        case KEELOQ_LEARNING_UNKNOWN:
+            // Simple Learning
+            decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
+            if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
+                *manufacture_name = manufacture_code->name;
+                keystore->mfname = *manufacture_name;
+                keystore->kl_type = 1;
+                return 1;
+            }
+            // Check for mirrored man
+            uint64_t man_rev = 0;
+            uint64_t man_rev_byte = 0;
+            for(uint8_t i = 0; i < 64; i += 8) {
+                man_rev_byte = (uint8_t)(manufacture_code->key >> i);
+                man_rev = man_rev | man_rev_byte << (56 - i);
+            }
+            decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
+            if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
+                *manufacture_name = manufacture_code->name;
+                keystore->mfname = *manufacture_name;
+                keystore->kl_type = 1;
+                return 1;
+            }
+            //###########################
+            // Normal Learning
+            // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+            man_normal_learning =
+                subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
+            decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
+            if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
+                *manufacture_name = manufacture_code->name;
+                keystore->mfname = *manufacture_name;
+                keystore->kl_type = 2;
+                return 1;
+            }
+            // Check for mirrored man
+            man_normal_learning = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
+            decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
+            if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
+                *manufacture_name = manufacture_code->name;
+                keystore->mfname = *manufacture_name;
+                keystore->kl_type = 2;
+                return 1;
+            }
+            break;
         }
+    }
 
     *manufacture_name = "Unknown";
     keystore->mfname = "Unknown";
@@ -646,6 +642,16 @@ uint32_t subghz_protocol_decoder_star_line_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_star_line_get_result(
+    void* context,
+    SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderStarLine* instance = context;
+    subghz_protocol_star_line_check_remote_controller(
+        &instance->generic, instance->keystore, &instance->manufacture_name);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_star_line_serialize(
     void* context,
     FlipperFormat* flipper_format,
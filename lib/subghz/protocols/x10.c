@@ -76,6 +76,9 @@ const SubGhzProtocolDecoder subghz_protocol_x10_decoder = {
     .serialize = subghz_protocol_decoder_x10_serialize,
     .deserialize = subghz_protocol_decoder_x10_deserialize,
     .get_string = subghz_protocol_decoder_x10_get_string,
+    .get_result = subghz_protocol_decoder_x10_get_result,
+
+    .timing = &subghz_protocol_x10_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_x10_encoder = {
@@ -218,6 +221,13 @@ uint32_t subghz_protocol_decoder_x10_get_hash_data(void* context) {
         &instance->decoder, (instance->decoder.decode_count_bit / 8) + 1);
 }
 
+void subghz_protocol_decoder_x10_get_result(void* context, SubGhzProtocolDecoderResult* result) {
+    furi_assert(context);
+    SubGhzProtocolDecoderX10* instance = context;
+    subghz_protocol_x10_check_remote_controller(&instance->generic);
+    subghz_block_generic_get_result(&instance->generic, result);
+}
+
 SubGhzProtocolStatus subghz_protocol_decoder_x10_serialize(
     void* context,
     FlipperFormat* flipper_format,
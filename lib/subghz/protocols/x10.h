@@ -54,6 +54,13 @@ bool subghz_protocol_x10_validate(void* context);
  */
 uint32_t subghz_protocol_decoder_x10_get_hash_data(void* context);
 
+/**
+ * Getting the fixed size result of the last received parcel, no formatting is done.
+ * @param context Pointer to a SubGhzProtocolDecoderX10 instance
+ * @param result Pointer to a SubGhzProtocolDecoderResult to fill
+ */
+void subghz_protocol_decoder_x10_get_result(void* context, SubGhzProtocolDecoderResult* result);
+
 /**
  * Serialize data SubGhzProtocolDecoderX10.
  * @param context Pointer to a SubGhzProtocolDecoderX10 instance
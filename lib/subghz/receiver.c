@@ -5,8 +5,32 @@
 
 #include <m-array.h>
 
+/*
+ * Pre-classifier
+ *
+ * Every edge duration is quantized into one of SUBGHZ_RECEIVER_CLASS_COUNT
+ * classes and kept in a rolling window. Each decoder that provides its
+ * SubGhzBlockConst gets a mask of classes compatible with its te_short/te_long
+ * tolerances and a running count of window entries matching that mask.
+ * Decoders that do not see enough matching durations are not fed and are reset
+ * once, so they start clean when their timings show up on air again.
+ */
+#define SUBGHZ_RECEIVER_CLASS_WIDTH_US (128)
+#define SUBGHZ_RECEIVER_CLASS_COUNT (32)
+#define SUBGHZ_RECEIVER_WINDOW_SIZE (16)
+#define SUBGHZ_RECEIVER_WINDOW_MATCH_MIN (6)
+#define SUBGHZ_RECEIVER_HOLD_EDGES (256)
+
+// Last decoded parcels, kept as fixed size records so decoding never allocates
+#define SUBGHZ_RECEIVER_RESULTS_SIZE (16)
+
 typedef struct {
     SubGhzProtocolEncoderBase* base;
+
+    uint32_t class_mask; ///< 0 - decoder is not classified and always fed
+    uint8_t match_count;
+    uint16_t hold;
+    bool active;
 } SubGhzReceiverSlot;
 
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
@@ -19,8 +43,85 @@ struct SubGhzReceiver {
 
     SubGhzReceiverCallback callback;
     void* context;
+
+    bool preclassifier;
+    uint8_t window[SUBGHZ_RECEIVER_WINDOW_SIZE];
+    uint8_t window_position;
+    uint8_t window_fill;
+
+    SubGhzProtocolDecoderResult results[SUBGHZ_RECEIVER_RESULTS_SIZE];
+    uint32_t results_count;
 };
 
+static inline uint8_t subghz_receiver_get_duration_class(uint32_t duration) {
+    uint32_t duration_class = duration / SUBGHZ_RECEIVER_CLASS_WIDTH_US;
+    return MIN(duration_class, (uint32_t)(SUBGHZ_RECEIVER_CLASS_COUNT - 1));
+}
+
+static uint32_t subghz_receiver_get_class_mask(const SubGhzProtocolDecoder* decoder) {
+    const SubGhzBlockConst* timing = decoder->timing;
+    if(!timing || !timing->te_short) return 0;
+
+    uint32_t lower = (timing->te_short > timing->te_delta) ? timing->te_short - timing->te_delta :
+                                                              0;
+    uint32_t upper = MAX(timing->te_short, timing->te_long) + timing->te_delta;
+
+    uint8_t first = subghz_receiver_get_duration_class(lower);
+    uint8_t last = subghz_receiver_get_duration_class(upper);
+
+    uint32_t mask = 0;
+    for(uint8_t i = first; i <= last; i++) {
+        mask |= 1UL << i;
+    }
+    return mask;
+}
+
+static void subghz_receiver_preclassifier_reset(SubGhzReceiver* instance) {
+    instance->window_position = 0;
+    instance->window_fill = 0;
+
+    for
+        M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
+            slot->match_count = 0;
+            slot->hold = 0;
+            slot->active = true;
+        }
+}
+
+/** Push duration into the window, update match counts and tell if slot must be fed */
+static inline bool subghz_receiver_preclassifier_update(
+    SubGhzReceiverSlot* slot,
+    uint8_t duration_class,
+    uint8_t evicted_class,
+    bool window_full) {
+    if(!slot->class_mask) return true;
+
+    if(window_full && (slot->class_mask & (1UL << evicted_class))) slot->match_count--;
+    if(slot->class_mask & (1UL << duration_class)) slot->match_count++;
+
+    bool plausible = false;
+    if(!window_full) {
+        // Not enough history yet, feed everything
+        plausible = true;
+    } else if(slot->match_count >= SUBGHZ_RECEIVER_WINDOW_MATCH_MIN) {
+        slot->hold = SUBGHZ_RECEIVER_HOLD_EDGES;
+        plausible = true;
+    } else if(slot->hold) {
+        // Keep feeding through headers and gaps between repeats
+        slot->hold--;
+        plausible = true;
+    }
+
+    if(plausible) {
+        slot->active = true;
+    } else if(slot->active) {
+        slot->active = false;
+        slot->base->protocol->decoder->reset(slot->base);
+    }
+
+    return plausible;
+}
+
 SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
     SubGhzReceiver* instance = malloc(sizeof(SubGhzReceiver));
     SubGhzReceiverSlotArray_init(instance->slots);
@@ -34,11 +135,16 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
         if(protocol->decoder && protocol->decoder->alloc) {
             SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_push_new(instance->slots);
             slot->base = protocol->decoder->alloc(environment);
+            slot->class_mask = subghz_receiver_get_class_mask(protocol->decoder);
         }
     }
 
     instance->callback = NULL;
     instance->context = NULL;
+    instance->results_count = 0;
+
+    instance->preclassifier = false;
+    subghz_receiver_preclassifier_reset(instance);
     return instance;
 }
 
@@ -63,9 +169,31 @@ void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t durat
     furi_check(instance);
     furi_check(instance->slots);
 
+    if(!instance->preclassifier) {
+        for
+            M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
+                if((slot->base->protocol->flag & instance->filter) != 0 &&
+                   (slot->base->protocol->filter & instance->ignore_filter) == 0) {
+                    slot->base->protocol->decoder->feed(slot->base, level, duration);
+                }
+            }
+        return;
+    }
+
+    uint8_t duration_class = subghz_receiver_get_duration_class(duration);
+    uint8_t evicted_class = instance->window[instance->window_position];
+    bool window_full = instance->window_fill == SUBGHZ_RECEIVER_WINDOW_SIZE;
+
+    instance->window[instance->window_position] = duration_class;
+    instance->window_position = (instance->window_position + 1) % SUBGHZ_RECEIVER_WINDOW_SIZE;
+    if(!window_full) instance->window_fill++;
+
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) != 0 &&
+            // Match counts must be kept up to date for every slot, even filtered out ones
+            bool plausible = subghz_receiver_preclassifier_update(
+                slot, duration_class, evicted_class, window_full);
+            if(plausible && (slot->base->protocol->flag & instance->filter) != 0 &&
                (slot->base->protocol->filter & instance->ignore_filter) == 0) {
                 slot->base->protocol->decoder->feed(slot->base, level, duration);
             }
@@ -84,6 +212,12 @@ void subghz_receiver_reset(SubGhzReceiver* instance) {
 
 static void subghz_receiver_rx_callback(SubGhzProtocolDecoderBase* decoder_base, void* context) {
     SubGhzReceiver* instance = context;
+
+    SubGhzProtocolDecoderResult* result =
+        &instance->results[instance->results_count % SUBGHZ_RECEIVER_RESULTS_SIZE];
+    subghz_protocol_decoder_base_get_result(decoder_base, result);
+    instance->results_count++;
+
     if(instance->callback) {
         instance->callback(instance, decoder_base, instance->context);
     }
@@ -110,6 +244,14 @@ void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag fil
     instance->filter = filter;
 }
 
+void subghz_receiver_set_preclassifier(SubGhzReceiver* instance, bool enable) {
+    furi_check(instance);
+    if(instance->preclassifier != enable) {
+        instance->preclassifier = enable;
+        subghz_receiver_preclassifier_reset(instance);
+    }
+}
+
 void subghz_receiver_set_ignore_filter(
     SubGhzReceiver* instance,
     SubGhzProtocolFilter ignore_filter) {
@@ -133,3 +275,17 @@ SubGhzProtocolDecoderBase* subghz_receiver_search_decoder_base_by_name(
         }
     return result;
 }
+
+bool subghz_receiver_get_result(
+    SubGhzReceiver* instance,
+    size_t age,
+    SubGhzProtocolDecoderResult* result) {
+    furi_check(instance);
+    furi_check(result);
+
+    if(age >= MIN(instance->results_count, (uint32_t)SUBGHZ_RECEIVER_RESULTS_SIZE)) return false;
+
+    uint32_t index = (instance->results_count - 1 - age) % SUBGHZ_RECEIVER_RESULTS_SIZE;
+    *result = instance->results[index];
+    return true;
+}
@@ -59,6 +59,16 @@ void subghz_receiver_set_rx_callback(
  */
 void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag filter);
 
+/**
+ * Enable or disable the pulse-shape pre-classifier.
+ * When enabled, each edge is only fed to decoders whose te_short/te_long
+ * tolerances are compatible with a rolling window of recent durations.
+ * Decoders without timing information are always fed.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param enable true to route edges through the pre-classifier
+ */
+void subghz_receiver_set_preclassifier(SubGhzReceiver* instance, bool enable);
+
 /**
  * Set the filter of receivers that will be ignored at the moment.
  * @param instance Pointer to a SubGhzReceiver instance
@@ -77,6 +87,19 @@ void subghz_receiver_set_ignore_filter(
 SubGhzProtocolDecoderBase*
     subghz_receiver_search_decoder_base_by_name(SubGhzReceiver* instance, const char* decoder_name);
 
+/**
+ * Get one of the last decoded results, kept in a preallocated ring.
+ * Call from the rx callback or while decoding is stopped.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param age 0 for the last decoded parcel, 1 for the one before it and so on
+ * @param result Pointer to a SubGhzProtocolDecoderResult to fill
+ * @return true if the result is available
+ */
+bool subghz_receiver_get_result(
+    SubGhzReceiver* instance,
+    size_t age,
+    SubGhzProtocolDecoderResult* result);
+
 #ifdef __cplusplus
 }
 #endif
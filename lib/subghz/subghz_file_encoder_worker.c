@@ -1,4 +1,5 @@
 #include "subghz_file_encoder_worker.h"
+#include "subghz_raw_file.h"
 
 #include <toolbox/stream/stream.h>
 #include <flipper_format/flipper_format.h>
@@ -15,6 +16,8 @@ struct SubGhzFileEncoderWorker {
 
     Storage* storage;
     FlipperFormat* flipper_format;
+    SubGhzRawFileReader* reader;
+    int32_t samples[SUBGHZ_FILE_ENCODER_LOAD];
 
     volatile bool worker_running;
     volatile bool worker_stopping;
@@ -44,41 +47,19 @@ void subghz_file_encoder_worker_add_level_duration(
     if(sizeof(int32_t) != ret) FURI_LOG_E(TAG, "Invalid add duration in the stream");
 }
 
-bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, const char* strStart) {
-    char* str1;
-    int32_t temp_ds = 0;
-    bool res = false;
-    // Line sample: "RAW_Data: -1, 2, -2..."
-
-    // Look for a key in the line
-    str1 = strstr(strStart, "RAW_Data: ");
-
-    if(str1 != NULL) {
-        // Skip key
-        str1 = strchr(str1, ' ');
-
-        // Check that there is still an element in the line
-        while(strchr(str1, ' ') != NULL) {
-            str1 = strchr(str1, ' ');
-
-            // Skip space
-            str1 += 1;
-            //
-            temp_ds = atoi(str1);
-            if((temp_ds < -1000000) || (temp_ds > 1000000)) {
-                if(temp_ds > 0) {
-                    subghz_file_encoder_worker_add_level_duration(instance, (int32_t)100);
-                } else {
-                    subghz_file_encoder_worker_add_level_duration(instance, (int32_t)-100);
-                }
-                //FURI_LOG_I("PARSE", "Number overflow - %d", atoi(str1));
-            } else {
-                subghz_file_encoder_worker_add_level_duration(instance, temp_ds);
-            }
+static void subghz_file_encoder_worker_add_samples(
+    SubGhzFileEncoderWorker* instance,
+    int32_t* samples,
+    size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        if((samples[i] < -1000000) || (samples[i] > 1000000)) {
+            samples[i] = samples[i] > 0 ? 100 : -100;
         }
-        res = true;
     }
-    return res;
+
+    size_t size = count * sizeof(int32_t);
+    size_t ret = furi_stream_buffer_send(instance->stream, samples, size, 100);
+    if(size != ret) FURI_LOG_E(TAG, "Invalid add samples in the stream");
 }
 
 void subghz_file_encoder_worker_get_text_progress(
@@ -128,7 +109,7 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     instance->is_storage_slow = false;
     Stream* stream = flipper_format_get_raw_stream(instance->flipper_format);
     do {
-        if(!flipper_format_file_open_existing(
+        if(!flipper_format_buffered_file_open_existing(
                instance->flipper_format, furi_string_get_cstr(instance->file_path))) {
             FURI_LOG_E(
                 TAG,
@@ -148,16 +129,19 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
         FURI_LOG_I(TAG, "Start transmission");
     } while(0);
 
+    // Text or binary samples, missing samples end the transmission right away
+    if(res && !subghz_raw_file_reader_start(instance->reader, stream)) {
+        subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
+        res = false;
+    }
+
     while(res && instance->worker_running) {
         size_t stream_free_byte = furi_stream_buffer_spaces_available(instance->stream);
         if((stream_free_byte / sizeof(int32_t)) >= SUBGHZ_FILE_ENCODER_LOAD) {
-            if(stream_read_line(stream, instance->str_data)) {
-                furi_string_trim(instance->str_data);
-                if(!subghz_file_encoder_worker_data_parse(
-                       instance, furi_string_get_cstr(instance->str_data))) {
-                    subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
-                    break;
-                }
+            size_t count = subghz_raw_file_reader_read(
+                instance->reader, instance->samples, SUBGHZ_FILE_ENCODER_LOAD);
+            if(count) {
+                subghz_file_encoder_worker_add_samples(instance, instance->samples, count);
             } else {
                 subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
                 break;
@@ -184,7 +168,7 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
         }
         furi_delay_ms(50);
     }
-    flipper_format_file_close(instance->flipper_format);
+    flipper_format_buffered_file_close(instance->flipper_format);
 
     FURI_LOG_I(TAG, "Worker stop");
     return 0;
@@ -198,7 +182,8 @@ SubGhzFileEncoderWorker* subghz_file_encoder_worker_alloc(void) {
     instance->stream = furi_stream_buffer_alloc(sizeof(int32_t) * 2048, sizeof(int32_t));
 
     instance->storage = furi_record_open(RECORD_STORAGE);
-    instance->flipper_format = flipper_format_file_alloc(instance->storage);
+    instance->flipper_format = flipper_format_buffered_file_alloc(instance->storage);
+    instance->reader = subghz_raw_file_reader_alloc();
 
     instance->str_data = furi_string_alloc();
     instance->file_path = furi_string_alloc();
@@ -216,6 +201,7 @@ void subghz_file_encoder_worker_free(SubGhzFileEncoderWorker* instance) {
     furi_string_free(instance->str_data);
     furi_string_free(instance->file_path);
 
+    subghz_raw_file_reader_free(instance->reader);
     flipper_format_free(instance->flipper_format);
     furi_record_close(RECORD_STORAGE);
 
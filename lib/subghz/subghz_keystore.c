@@ -31,6 +31,9 @@ SubGhzKeystore* subghz_keystore_alloc(void) {
     SubGhzKeystore* instance = malloc(sizeof(SubGhzKeystore));
 
     SubGhzKeyArray_init(instance->data);
+    SubGhzKeystoreManufactureArray_init(instance->manufactures);
+    SubGhzKeystoreManufactureDict_init(instance->manufacture_index);
+    memset(instance->learning_types, 0, sizeof(instance->learning_types));
 
     subghz_keystore_reset_kl(instance);
 
@@ -49,25 +52,124 @@ void subghz_keystore_free(SubGhzKeystore* instance) {
 
     for
         M_EACH(manufacture_code, instance->data, SubGhzKeyArray_t) {
-            furi_string_free(manufacture_code->name);
             manufacture_code->key = 0;
         }
     SubGhzKeyArray_clear(instance->data);
 
+    for(size_t i = 0; i < SUBGHZ_KEYSTORE_LEARNING_TYPE_COUNT; i++) {
+        free(instance->learning_types[i].keys);
+        free(instance->learning_types[i].codes);
+    }
+
+    SubGhzKeystoreManufactureDict_clear(instance->manufacture_index);
+    for
+        M_EACH(manufacture, instance->manufactures, SubGhzKeystoreManufactureArray_t) {
+            furi_string_free(manufacture->name);
+        }
+    SubGhzKeystoreManufactureArray_clear(instance->manufactures);
+
     free(instance);
 }
 
+static const char* subghz_keystore_intern_name(SubGhzKeystore* instance, const char* name) {
+    size_t* index = SubGhzKeystoreManufactureDict_get(instance->manufacture_index, name);
+    if(index) {
+        return furi_string_get_cstr(
+            SubGhzKeystoreManufactureArray_get(instance->manufactures, *index)->name);
+    }
+
+    SubGhzKeystoreManufacture* manufacture =
+        SubGhzKeystoreManufactureArray_push_raw(instance->manufactures);
+    manufacture->name = furi_string_alloc_set(name);
+    manufacture->start = 0;
+    manufacture->count = 0;
+
+    // Dictionary key points to the interned string, it stays valid until keystore is freed
+    const char* interned_name = furi_string_get_cstr(manufacture->name);
+    SubGhzKeystoreManufactureDict_set_at(
+        instance->manufacture_index,
+        interned_name,
+        SubGhzKeystoreManufactureArray_size(instance->manufactures) - 1);
+    return interned_name;
+}
+
 static void subghz_keystore_add_key(
     SubGhzKeystore* instance,
     const char* name,
     uint64_t key,
     uint16_t type) {
     SubGhzKey* manufacture_code = SubGhzKeyArray_push_raw(instance->data);
-    manufacture_code->name = furi_string_alloc_set(name);
+    manufacture_code->name = subghz_keystore_intern_name(instance, name);
     manufacture_code->key = key;
     manufacture_code->type = type;
 }
 
+static size_t subghz_keystore_get_manufacture_index(SubGhzKeystore* instance, const char* name) {
+    size_t* index = SubGhzKeystoreManufactureDict_get(instance->manufacture_index, name);
+    furi_check(index);
+    return *index;
+}
+
+/** Group keys by manufacture and rebuild learning type arrays, called after every load */
+static void subghz_keystore_build_index(SubGhzKeystore* instance) {
+    size_t keys_count = SubGhzKeyArray_size(instance->data);
+    SubGhzKey* keys = keys_count ? SubGhzKeyArray_get(instance->data, 0) : NULL;
+
+    // Stable counting sort by manufacture, order of first appearance is kept
+    for
+        M_EACH(manufacture, instance->manufactures, SubGhzKeystoreManufactureArray_t) {
+            manufacture->count = 0;
+        }
+    for(size_t i = 0; i < keys_count; i++) {
+        SubGhzKeystoreManufactureArray_get(
+            instance->manufactures, subghz_keystore_get_manufacture_index(instance, keys[i].name))
+            ->count++;
+    }
+    size_t start = 0;
+    for
+        M_EACH(manufacture, instance->manufactures, SubGhzKeystoreManufactureArray_t) {
+            manufacture->start = start;
+            start += manufacture->count;
+            manufacture->count = 0;
+        }
+    if(keys_count) {
+        SubGhzKey* sorted = malloc(keys_count * sizeof(SubGhzKey));
+        for(size_t i = 0; i < keys_count; i++) {
+            SubGhzKeystoreManufacture* manufacture = SubGhzKeystoreManufactureArray_get(
+                instance->manufactures,
+                subghz_keystore_get_manufacture_index(instance, keys[i].name));
+            sorted[manufacture->start + manufacture->count++] = keys[i];
+        }
+        memcpy(keys, sorted, keys_count * sizeof(SubGhzKey));
+        memset(sorted, 0, keys_count * sizeof(SubGhzKey));
+        free(sorted);
+    }
+
+    size_t learning_type_count[SUBGHZ_KEYSTORE_LEARNING_TYPE_COUNT] = {0};
+    for(size_t i = 0; i < keys_count; i++) {
+        if(keys[i].type < SUBGHZ_KEYSTORE_LEARNING_TYPE_COUNT) learning_type_count[keys[i].type]++;
+    }
+    for(size_t type = 0; type < SUBGHZ_KEYSTORE_LEARNING_TYPE_COUNT; type++) {
+        SubGhzKeystoreLearningTypeKeys* learning_type = &instance->learning_types[type];
+        free(learning_type->keys);
+        free(learning_type->codes);
+        learning_type->keys = NULL;
+        learning_type->codes = NULL;
+        learning_type->count = 0;
+        if(learning_type_count[type]) {
+            learning_type->keys = malloc(learning_type_count[type] * sizeof(uint64_t));
+            learning_type->codes = malloc(learning_type_count[type] * sizeof(SubGhzKey*));
+        }
+    }
+    for(size_t i = 0; i < keys_count; i++) {
+        if(keys[i].type >= SUBGHZ_KEYSTORE_LEARNING_TYPE_COUNT) continue;
+        SubGhzKeystoreLearningTypeKeys* learning_type = &instance->learning_types[keys[i].type];
+        learning_type->keys[learning_type->count] = keys[i].key;
+        learning_type->codes[learning_type->count] = &keys[i];
+        learning_type->count++;
+    }
+}
+
 static bool subghz_keystore_process_line(SubGhzKeystore* instance, char* line) {
     uint64_t key = 0;
     uint16_t type = 0;
@@ -242,6 +344,8 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
     } while(0);
     flipper_format_free(flipper_format);
 
+    subghz_keystore_build_index(instance);
+
     furi_record_close(RECORD_STORAGE);
 
     furi_string_free(filetype);
@@ -300,7 +404,7 @@ bool subghz_keystore_save(SubGhzKeystore* instance, const char* file_name, uint8
                     (uint32_t)(key->key >> 32),
                     (uint32_t)key->key,
                     key->type,
-                    furi_string_get_cstr(key->name));
+                    key->name);
                 // Verify length and align
                 furi_assert(len > 0);
                 if(len % 16 != 0) {
@@ -349,6 +453,50 @@ SubGhzKeyArray_t* subghz_keystore_get_data(SubGhzKeystore* instance) {
     return &instance->data;
 }
 
+const SubGhzKey* subghz_keystore_get_manufacture_keys(
+    SubGhzKeystore* instance,
+    const char* name,
+    size_t* count) {
+    furi_assert(instance);
+    furi_assert(count);
+
+    *count = 0;
+    if(name == NULL) {
+        *count = SubGhzKeyArray_size(instance->data);
+        return *count ? SubGhzKeyArray_cget(instance->data, 0) : NULL;
+    }
+
+    size_t* index = SubGhzKeystoreManufactureDict_get(instance->manufacture_index, name);
+    if(!index) return NULL;
+
+    const SubGhzKeystoreManufacture* manufacture =
+        SubGhzKeystoreManufactureArray_cget(instance->manufactures, *index);
+    if(!manufacture->count) return NULL;
+
+    *count = manufacture->count;
+    return SubGhzKeyArray_cget(instance->data, manufacture->start);
+}
+
+size_t subghz_keystore_get_learning_type_keys(
+    SubGhzKeystore* instance,
+    uint16_t type,
+    const uint64_t** keys,
+    const SubGhzKey* const** codes) {
+    furi_assert(instance);
+    furi_assert(keys);
+
+    if(type >= SUBGHZ_KEYSTORE_LEARNING_TYPE_COUNT) {
+        *keys = NULL;
+        if(codes) *codes = NULL;
+        return 0;
+    }
+
+    const SubGhzKeystoreLearningTypeKeys* learning_type = &instance->learning_types[type];
+    *keys = learning_type->keys;
+    if(codes) *codes = learning_type->codes;
+    return learning_type->count;
+}
+
 bool subghz_keystore_raw_encrypted_save(
     const char* input_file_name,
     const char* output_file_name,
@@ -542,12 +690,8 @@ bool subghz_keystore_raw_get_data(const char* file_name, size_t offset, uint8_t*
             break;
         }
 
-        size_t bufer_size;
-        if(len <= (16 - offset % 16)) {
-            bufer_size = 32;
-        } else {
-            bufer_size = (((len) / 16) + 2) * 32;
-        }
+        // Hex encoded AES blocks covering [offset, offset + len)
+        size_t bufer_size = ((offset % 16 + len + 15) / 16) * 32;
         furi_assert(SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE >= bufer_size / 2);
 
         uint8_t buffer[bufer_size];
@@ -9,8 +9,8 @@ extern "C" {
 #endif
 
 typedef struct {
-    FuriString* name;
     uint64_t key;
+    const char* name; ///< Interned manufacture name, owned by SubGhzKeystore
     uint16_t type;
 } SubGhzKey;
 
@@ -54,6 +54,33 @@ bool subghz_keystore_save(SubGhzKeystore* instance, const char* filename, uint8_
  */
 SubGhzKeyArray_t* subghz_keystore_get_data(SubGhzKeystore* instance);
 
+/** 
+ * Get keys of the manufacture
+ * Keys of the same manufacture are stored contiguously, lookup is done by hash of the name
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param name Manufacture name, NULL to get all keys
+ * @param count Returned number of keys
+ * @return const SubGhzKey* first key or NULL if there are no keys
+ */
+const SubGhzKey* subghz_keystore_get_manufacture_keys(
+    SubGhzKeystore* instance,
+    const char* name,
+    size_t* count);
+
+/** 
+ * Get keys of the learning type as contiguous arrays
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param type Learning type, KEELOQ_LEARNING_*
+ * @param keys Returned array of key values
+ * @param codes Returned array of matching keystore entries, can be NULL
+ * @return size_t number of keys
+ */
+size_t subghz_keystore_get_learning_type_keys(
+    SubGhzKeystore* instance,
+    uint16_t type,
+    const uint64_t** keys,
+    const SubGhzKey* const** codes);
+
 /** 
  * Save RAW encrypted to file
  * @param input_file_name Full path to the input file
@@ -1,9 +1,31 @@
 #pragma once
 
 #include <m-array.h>
+#include <m-dict.h>
+
+#define SUBGHZ_KEYSTORE_LEARNING_TYPE_COUNT 16
+
+typedef struct {
+    FuriString* name;
+    size_t start;
+    size_t count;
+} SubGhzKeystoreManufacture;
+
+ARRAY_DEF(SubGhzKeystoreManufactureArray, SubGhzKeystoreManufacture, M_POD_OPLIST)
+
+DICT_DEF2(SubGhzKeystoreManufactureDict, const char*, M_CSTR_OPLIST, size_t, M_DEFAULT_OPLIST)
+
+typedef struct {
+    uint64_t* keys;
+    const SubGhzKey** codes;
+    size_t count;
+} SubGhzKeystoreLearningTypeKeys;
 
 struct SubGhzKeystore {
     SubGhzKeyArray_t data;
+    SubGhzKeystoreManufactureArray_t manufactures;
+    SubGhzKeystoreManufactureDict_t manufacture_index;
+    SubGhzKeystoreLearningTypeKeys learning_types[SUBGHZ_KEYSTORE_LEARNING_TYPE_COUNT];
     const char* mfname;
     uint8_t kl_type;
 };
@@ -0,0 +1,398 @@
+#include "subghz_raw_file.h"
+
+#include <toolbox/compress.h>
+#include <flipper_format/flipper_format_i.h>
+
+#define TAG "SubGhzRawFile"
+
+#define SUBGHZ_RAW_FILE_TEXT_KEY "RAW_Data:"
+
+// Zigzag encoded delta of two int32 fits into 33 bits, 7 bits per byte
+#define SUBGHZ_RAW_FILE_VARINT_SIZE_MAX (5U)
+#define SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX \
+    (SUBGHZ_RAW_FILE_BLOCK_SAMPLES_MAX * SUBGHZ_RAW_FILE_VARINT_SIZE_MAX)
+// Block that does not compress is stored as is, after a one byte flag
+#define SUBGHZ_RAW_FILE_PACKED_SIZE_MAX (SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX + 1U)
+// Heatshrink output can be larger than its input before the encoder falls back to copying
+#define SUBGHZ_RAW_FILE_PACK_BUFFER_SIZE \
+    (SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX + SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX / 8U + 16U)
+#define SUBGHZ_RAW_FILE_COMPRESS_BUFFER_SIZE (512U)
+
+typedef struct {
+    uint16_t size; // Payload size
+    uint16_t count; // Sample count
+} SubGhzRawFileBlockHeader;
+
+_Static_assert(sizeof(SubGhzRawFileBlockHeader) == 4, "Incorrect SubGhzRawFileBlockHeader size");
+
+struct SubGhzRawFileReader {
+    Stream* stream;
+    SubGhzRawFileFormat format;
+    bool end;
+
+    // Text format
+    FuriString* line;
+    const char* line_position; // Next sample in the line, NULL if there is none
+
+    // Binary formats
+    int32_t block[SUBGHZ_RAW_FILE_BLOCK_SAMPLES_MAX];
+    size_t block_count;
+    size_t block_position;
+    uint8_t* data;
+    uint8_t* unpacked;
+    Compress* compress;
+};
+
+struct SubGhzRawFileWriter {
+    SubGhzRawFileFormat format;
+    uint8_t* data;
+    uint8_t* packed;
+    Compress* compress;
+};
+
+static const char* const subghz_raw_file_format_names[] = {
+    [SubGhzRawFileFormatText] = "Text",
+    [SubGhzRawFileFormatVarint] = "Varint",
+    [SubGhzRawFileFormatHeatshrink] = "Heatshrink",
+};
+
+const char* subghz_raw_file_format_get_name(SubGhzRawFileFormat format) {
+    furi_check(format < COUNT_OF(subghz_raw_file_format_names));
+    return subghz_raw_file_format_names[format];
+}
+
+bool subghz_raw_file_format_from_name(const char* name, SubGhzRawFileFormat* format) {
+    furi_check(name);
+    furi_check(format);
+
+    for(size_t i = 0; i < COUNT_OF(subghz_raw_file_format_names); i++) {
+        if(strcmp(subghz_raw_file_format_names[i], name) == 0) {
+            *format = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static size_t subghz_raw_file_encode(const int32_t* samples, size_t count, uint8_t* data) {
+    size_t size = 0;
+    // Durations of the same level repeat, so every sample is predicted from the one two back
+    int32_t history[2] = {0, 0};
+
+    for(size_t i = 0; i < count; i++) {
+        int64_t delta = (int64_t)samples[i] - history[i & 1];
+        history[i & 1] = samples[i];
+
+        uint64_t value = delta < 0 ? ((uint64_t)(-delta) << 1) - 1 : (uint64_t)delta << 1;
+        while(value >= 0x80) {
+            data[size++] = (uint8_t)value | 0x80;
+            value >>= 7;
+        }
+        data[size++] = (uint8_t)value;
+    }
+
+    return size;
+}
+
+static bool
+    subghz_raw_file_decode(const uint8_t* data, size_t size, int32_t* samples, size_t count) {
+    size_t offset = 0;
+    int32_t history[2] = {0, 0};
+
+    for(size_t i = 0; i < count; i++) {
+        uint64_t value = 0;
+        for(uint8_t shift = 0;; shift += 7) {
+            if(offset == size || shift == SUBGHZ_RAW_FILE_VARINT_SIZE_MAX * 7) return false;
+            uint8_t byte = data[offset++];
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if(!(byte & 0x80)) break;
+        }
+
+        int64_t delta = (value & 1) ? -(int64_t)((value + 1) >> 1) : (int64_t)(value >> 1);
+        history[i & 1] = (int32_t)(history[i & 1] + delta);
+        samples[i] = history[i & 1];
+    }
+
+    return offset == size;
+}
+
+SubGhzRawFileReader* subghz_raw_file_reader_alloc(void) {
+    SubGhzRawFileReader* instance = malloc(sizeof(SubGhzRawFileReader));
+    instance->line = furi_string_alloc();
+    instance->stream = NULL;
+    instance->data = NULL;
+    instance->unpacked = NULL;
+    instance->compress = NULL;
+    return instance;
+}
+
+void subghz_raw_file_reader_free(SubGhzRawFileReader* instance) {
+    furi_check(instance);
+    furi_string_free(instance->line);
+    free(instance->data);
+    free(instance->unpacked);
+    if(instance->compress) compress_free(instance->compress);
+    free(instance);
+}
+
+static bool subghz_raw_file_reader_next_line(SubGhzRawFileReader* instance) {
+    instance->line_position = NULL;
+
+    while(stream_read_line(instance->stream, instance->line)) {
+        furi_string_trim(instance->line);
+        if(furi_string_empty(instance->line)) continue;
+        if(!furi_string_start_with_str(instance->line, SUBGHZ_RAW_FILE_TEXT_KEY)) break;
+
+        instance->line_position =
+            furi_string_get_cstr(instance->line) + strlen(SUBGHZ_RAW_FILE_TEXT_KEY);
+        return true;
+    }
+
+    return false;
+}
+
+bool subghz_raw_file_reader_start(SubGhzRawFileReader* instance, Stream* stream) {
+    furi_check(instance);
+    furi_check(stream);
+
+    instance->stream = stream;
+    instance->format = SubGhzRawFileFormatText;
+    instance->end = false;
+    instance->block_count = 0;
+    instance->block_position = 0;
+
+    if(subghz_raw_file_reader_next_line(instance)) return true;
+    if(!furi_string_start_with_str(instance->line, SUBGHZ_RAW_FILE_FORMAT_KEY ":")) return false;
+
+    furi_string_right(instance->line, strlen(SUBGHZ_RAW_FILE_FORMAT_KEY ":"));
+    furi_string_trim(instance->line);
+    if(!subghz_raw_file_format_from_name(
+           furi_string_get_cstr(instance->line), &instance->format)) {
+        FURI_LOG_E(TAG, "Unknown format %s", furi_string_get_cstr(instance->line));
+        return false;
+    }
+
+    if(instance->format == SubGhzRawFileFormatText) {
+        return subghz_raw_file_reader_next_line(instance);
+    }
+
+    if(!instance->data) {
+        instance->data = malloc(SUBGHZ_RAW_FILE_PACKED_SIZE_MAX);
+    }
+    if(instance->format == SubGhzRawFileFormatHeatshrink && !instance->compress) {
+        // One spare byte, so a block that decompresses too large is caught
+        instance->unpacked = malloc(SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX + 1);
+        instance->compress = compress_alloc(SUBGHZ_RAW_FILE_COMPRESS_BUFFER_SIZE);
+    }
+
+    return true;
+}
+
+SubGhzRawFileFormat subghz_raw_file_reader_get_format(SubGhzRawFileReader* instance) {
+    furi_check(instance);
+    return instance->format;
+}
+
+static size_t subghz_raw_file_reader_read_text(
+    SubGhzRawFileReader* instance,
+    int32_t* samples,
+    size_t capacity) {
+    size_t count = 0;
+
+    while(count < capacity) {
+        if(!instance->line_position && !subghz_raw_file_reader_next_line(instance)) {
+            instance->end = true;
+            break;
+        }
+
+        const char* position = instance->line_position;
+        while(*position == ' ' || *position == ',') {
+            position++;
+        }
+
+        char* end;
+        long value = strtol(position, &end, 10);
+        if(end == position) {
+            // End of the line, or garbage in it
+            instance->line_position = NULL;
+            continue;
+        }
+
+        samples[count++] = (int32_t)value;
+        instance->line_position = end;
+    }
+
+    return count;
+}
+
+static bool subghz_raw_file_reader_next_block(SubGhzRawFileReader* instance) {
+    SubGhzRawFileBlockHeader header;
+    size_t was_read = stream_read(instance->stream, (uint8_t*)&header, sizeof(header));
+    if(was_read == 0) return false;
+
+    bool result = false;
+    do {
+        if(was_read != sizeof(header)) break;
+        if(header.count == 0 || header.count > SUBGHZ_RAW_FILE_BLOCK_SAMPLES_MAX) break;
+        if(header.size == 0 || header.size > SUBGHZ_RAW_FILE_PACKED_SIZE_MAX) break;
+
+        if(stream_read(instance->stream, instance->data, header.size) != header.size) break;
+
+        uint8_t* payload = instance->data;
+        size_t payload_size = header.size;
+        if(instance->format == SubGhzRawFileFormatHeatshrink) {
+            if(!compress_decode(
+                   instance->compress,
+                   instance->data,
+                   header.size,
+                   instance->unpacked,
+                   SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX + 1,
+                   &payload_size))
+                break;
+            payload = instance->unpacked;
+        }
+
+        if(!subghz_raw_file_decode(payload, payload_size, instance->block, header.count)) break;
+
+        instance->block_count = header.count;
+        instance->block_position = 0;
+        result = true;
+    } while(false);
+
+    if(!result) FURI_LOG_E(TAG, "Malformed block");
+    return result;
+}
+
+static size_t subghz_raw_file_reader_read_binary(
+    SubGhzRawFileReader* instance,
+    int32_t* samples,
+    size_t capacity) {
+    size_t count = 0;
+
+    while(count < capacity) {
+        if(instance->block_position == instance->block_count &&
+           !subghz_raw_file_reader_next_block(instance)) {
+            instance->end = true;
+            break;
+        }
+
+        size_t chunk = MIN(capacity - count, instance->block_count - instance->block_position);
+        memcpy(
+            &samples[count], &instance->block[instance->block_position], chunk * sizeof(int32_t));
+        instance->block_position += chunk;
+        count += chunk;
+    }
+
+    return count;
+}
+
+size_t
+    subghz_raw_file_reader_read(SubGhzRawFileReader* instance, int32_t* samples, size_t capacity) {
+    furi_check(instance);
+    furi_check(instance->stream);
+    furi_check(samples);
+
+    if(instance->end) return 0;
+
+    if(instance->format == SubGhzRawFileFormatText) {
+        return subghz_raw_file_reader_read_text(instance, samples, capacity);
+    } else {
+        return subghz_raw_file_reader_read_binary(instance, samples, capacity);
+    }
+}
+
+SubGhzRawFileWriter* subghz_raw_file_writer_alloc(SubGhzRawFileFormat format) {
+    furi_check(format < COUNT_OF(subghz_raw_file_format_names));
+
+    SubGhzRawFileWriter* instance = malloc(sizeof(SubGhzRawFileWriter));
+    instance->format = format;
+    instance->data = NULL;
+    instance->packed = NULL;
+    instance->compress = NULL;
+
+    if(format != SubGhzRawFileFormatText) {
+        instance->data = malloc(SUBGHZ_RAW_FILE_BLOCK_SIZE_MAX);
+    }
+    if(format == SubGhzRawFileFormatHeatshrink) {
+        instance->packed = malloc(SUBGHZ_RAW_FILE_PACK_BUFFER_SIZE);
+        instance->compress = compress_alloc(SUBGHZ_RAW_FILE_COMPRESS_BUFFER_SIZE);
+    }
+
+    return instance;
+}
+
+void subghz_raw_file_writer_free(SubGhzRawFileWriter* instance) {
+    furi_check(instance);
+    free(instance->data);
+    free(instance->packed);
+    if(instance->compress) compress_free(instance->compress);
+    free(instance);
+}
+
+bool subghz_raw_file_writer_start(SubGhzRawFileWriter* instance, FlipperFormat* flipper_format) {
+    furi_check(instance);
+    furi_check(flipper_format);
+
+    // Text files stay exactly as before, so other tools can read them
+    if(instance->format == SubGhzRawFileFormatText) return true;
+
+    return flipper_format_write_string_cstr(
+        flipper_format,
+        SUBGHZ_RAW_FILE_FORMAT_KEY,
+        subghz_raw_file_format_get_name(instance->format));
+}
+
+static bool subghz_raw_file_writer_write_block(
+    SubGhzRawFileWriter* instance,
+    Stream* stream,
+    const int32_t* samples,
+    size_t count) {
+    uint8_t* payload = instance->data;
+    size_t size = subghz_raw_file_encode(samples, count, instance->data);
+
+    if(instance->format == SubGhzRawFileFormatHeatshrink) {
+        if(!compress_encode(
+               instance->compress,
+               instance->data,
+               size,
+               instance->packed,
+               SUBGHZ_RAW_FILE_PACK_BUFFER_SIZE,
+               &size))
+            return false;
+        payload = instance->packed;
+    }
+
+    SubGhzRawFileBlockHeader header = {.size = size, .count = count};
+    return stream_write(stream, (const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+           stream_write(stream, payload, size) == size;
+}
+
+bool subghz_raw_file_writer_write(
+    SubGhzRawFileWriter* instance,
+    FlipperFormat* flipper_format,
+    const int32_t* samples,
+    size_t count) {
+    furi_check(instance);
+    furi_check(flipper_format);
+    furi_check(samples);
+
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+
+    for(size_t offset = 0; offset < count; offset += SUBGHZ_RAW_FILE_BLOCK_SAMPLES_MAX) {
+        size_t chunk = MIN(count - offset, SUBGHZ_RAW_FILE_BLOCK_SAMPLES_MAX);
+
+        bool result;
+        if(instance->format == SubGhzRawFileFormatText) {
+            result = flipper_format_write_int32(
+                flipper_format, "RAW_Data", &samples[offset], chunk);
+        } else {
+            result =
+                subghz_raw_file_writer_write_block(instance, stream, &samples[offset], chunk);
+        }
+
+        if(!result) return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <furi.h>
+#include <toolbox/stream/stream.h>
+#include <flipper_format/flipper_format.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Key of the line that selects a binary format, written right after Protocol */
+#define SUBGHZ_RAW_FILE_FORMAT_KEY "RAW_Format"
+
+/** Samples in one binary block, same as one RAW_Data line written while recording */
+#define SUBGHZ_RAW_FILE_BLOCK_SAMPLES_MAX (512U)
+
+typedef enum {
+    SubGhzRawFileFormatText, /**< RAW_Data lines, understood by every tool */
+    SubGhzRawFileFormatVarint, /**< Binary blocks of delta and varint encoded samples */
+    SubGhzRawFileFormatHeatshrink, /**< Varint blocks compressed with heatshrink */
+} SubGhzRawFileFormat;
+
+typedef struct SubGhzRawFileReader SubGhzRawFileReader;
+
+typedef struct SubGhzRawFileWriter SubGhzRawFileWriter;
+
+/**
+ * Get format name, as written in the file.
+ * @param format SubGhzRawFileFormat
+ * @return const char* format name
+ */
+const char* subghz_raw_file_format_get_name(SubGhzRawFileFormat format);
+
+/**
+ * Get format by name.
+ * @param name Format name
+ * @param format Pointer to a SubGhzRawFileFormat to fill
+ * @return true if the name is known
+ */
+bool subghz_raw_file_format_from_name(const char* name, SubGhzRawFileFormat* format);
+
+/**
+ * Allocate SubGhzRawFileReader.
+ * @return SubGhzRawFileReader* pointer to a SubGhzRawFileReader instance
+ */
+SubGhzRawFileReader* subghz_raw_file_reader_alloc(void);
+
+/**
+ * Free SubGhzRawFileReader.
+ * @param instance Pointer to a SubGhzRawFileReader instance
+ */
+void subghz_raw_file_reader_free(SubGhzRawFileReader* instance);
+
+/**
+ * Start reading samples and detect their format.
+ * @param instance Pointer to a SubGhzRawFileReader instance
+ * @param stream Stream at the start of the line following the Protocol line
+ * @return true if samples follow
+ */
+bool subghz_raw_file_reader_start(SubGhzRawFileReader* instance, Stream* stream);
+
+/**
+ * Get format of the samples being read.
+ * @param instance Pointer to a SubGhzRawFileReader instance
+ * @return SubGhzRawFileFormat
+ */
+SubGhzRawFileFormat subghz_raw_file_reader_get_format(SubGhzRawFileReader* instance);
+
+/**
+ * Read next samples, positive for high level and negative for low level durations.
+ * @param instance Pointer to a started SubGhzRawFileReader instance
+ * @param samples Buffer for the samples
+ * @param capacity Buffer size in samples
+ * @return size_t samples read, 0 at the end of the data or on a malformed file
+ */
+size_t
+    subghz_raw_file_reader_read(SubGhzRawFileReader* instance, int32_t* samples, size_t capacity);
+
+/**
+ * Allocate SubGhzRawFileWriter.
+ * @param format Format to write samples in
+ * @return SubGhzRawFileWriter* pointer to a SubGhzRawFileWriter instance
+ */
+SubGhzRawFileWriter* subghz_raw_file_writer_alloc(SubGhzRawFileFormat format);
+
+/**
+ * Free SubGhzRawFileWriter.
+ * @param instance Pointer to a SubGhzRawFileWriter instance
+ */
+void subghz_raw_file_writer_free(SubGhzRawFileWriter* instance);
+
+/**
+ * Start writing samples, right after the Protocol key was written.
+ * @param instance Pointer to a SubGhzRawFileWriter instance
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @return true on success
+ */
+bool subghz_raw_file_writer_start(SubGhzRawFileWriter* instance, FlipperFormat* flipper_format);
+
+/**
+ * Append samples.
+ * @param instance Pointer to a started SubGhzRawFileWriter instance
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param samples Samples, positive for high level and negative for low level durations
+ * @param count Sample count
+ * @return true on success
+ */
+bool subghz_raw_file_writer_write(
+    SubGhzRawFileWriter* instance,
+    FlipperFormat* flipper_format,
+    const int32_t* samples,
+    size_t count);
+
+#ifdef __cplusplus
+}
+#endif
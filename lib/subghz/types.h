@@ -8,6 +8,7 @@
 #include <lib/toolbox/level_duration.h>
 
 #include "environment.h"
+#include "blocks/const.h"
 #include <furi.h>
 #include <furi_hal.h>
 
@@ -82,6 +83,22 @@ typedef uint8_t (*SubGhzGetHashData)(void* decoder);
 typedef uint32_t (*SubGhzGetHashDataLong)(void* decoder);
 typedef void (*SubGhzGetString)(void* decoder, FuriString* output);
 
+/** Fixed size decoding result, filled without heap allocations or string formatting.
+ * Serial, button and counter are parsed by the protocol when the result is filled,
+ * the same way serialize and get_string do. Protocols without them leave zeroes.
+ */
+typedef struct {
+    const struct SubGhzProtocol* protocol; ///< Protocol which decoded the parcel
+    uint32_t hash; ///< Same as subghz_protocol_decoder_base_get_hash_data_long
+    uint64_t key; ///< Key data
+    uint32_t serial; ///< Serial number
+    uint32_t counter; ///< Counter
+    uint16_t bits; ///< Key length in bits
+    uint8_t button; ///< Button
+} SubGhzProtocolDecoderResult;
+
+typedef void (*SubGhzGetResult)(void* decoder, SubGhzProtocolDecoderResult* result);
+
 // Encoder specific
 typedef void (*SubGhzEncoderStop)(void* encoder);
 typedef LevelDuration (*SubGhzEncoderYield)(void* context);
@@ -99,6 +116,9 @@ typedef struct {
     SubGhzDeserialize deserialize;
 
     SubGhzGetHashDataLong get_hash_data_long;
+
+    const SubGhzBlockConst* timing; ///< Optional, used by the receiver pre-classifier
+    SubGhzGetResult get_result; ///< Optional, fills key fields of the result
 } SubGhzProtocolDecoder;
 
 typedef struct {
@@ -14,6 +14,10 @@
 #define COMPRESS_ICON_ENCODED_BUFF_SIZE (1024u)
 #define COMPRESS_ICON_DECODED_BUFF_SIZE (1024u)
 
+/** Decoded icon cache, for small icons that are drawn on every frame */
+#define COMPRESS_ICON_CACHE_ENTRIES (8u)
+#define COMPRESS_ICON_CACHE_ENTRY_SIZE (128u)
+
 typedef struct {
     uint8_t is_compressed;
     uint8_t reserved;
@@ -22,9 +26,20 @@ typedef struct {
 
 _Static_assert(sizeof(CompressHeader) == 4, "Incorrect CompressHeader size");
 
+typedef struct {
+    const uint8_t* icon_data;
+    // Icons of loaded apps and animations come and go, so the same address may hold another icon
+    uint32_t hash;
+    uint32_t last_use;
+    uint16_t compressed_size;
+    uint8_t decoded_buff[COMPRESS_ICON_CACHE_ENTRY_SIZE];
+} CompressIconCacheEntry;
+
 struct CompressIcon {
     heatshrink_decoder* decoder;
     uint8_t decoded_buff[COMPRESS_ICON_DECODED_BUFF_SIZE];
+    CompressIconCacheEntry cache[COMPRESS_ICON_CACHE_ENTRIES];
+    uint32_t cache_clock;
 };
 
 CompressIcon* compress_icon_alloc(void) {
@@ -35,6 +50,8 @@ CompressIcon* compress_icon_alloc(void) {
         COMPRESS_LOOKAHEAD_BUFF_SIZE_LOG);
     heatshrink_decoder_reset(instance->decoder);
     memset(instance->decoded_buff, 0, sizeof(instance->decoded_buff));
+    memset(instance->cache, 0, sizeof(instance->cache));
+    instance->cache_clock = 0;
 
     return instance;
 }
@@ -45,6 +62,39 @@ void compress_icon_free(CompressIcon* instance) {
     free(instance);
 }
 
+// FNV-1a, hashing compressed data is much cheaper than decoding it
+static uint32_t compress_icon_hash(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261UL;
+    for(size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+static CompressIconCacheEntry* compress_icon_cache_find(
+    CompressIcon* instance,
+    const uint8_t* icon_data,
+    uint16_t compressed_size,
+    uint32_t hash) {
+    for(size_t i = 0; i < COMPRESS_ICON_CACHE_ENTRIES; i++) {
+        CompressIconCacheEntry* entry = &instance->cache[i];
+        if(entry->icon_data == icon_data && entry->compressed_size == compressed_size &&
+           entry->hash == hash) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static CompressIconCacheEntry* compress_icon_cache_victim(CompressIcon* instance) {
+    CompressIconCacheEntry* victim = &instance->cache[0];
+    for(size_t i = 1; i < COMPRESS_ICON_CACHE_ENTRIES; i++) {
+        if(instance->cache[i].last_use < victim->last_use) victim = &instance->cache[i];
+    }
+    return victim;
+}
+
 void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint8_t** decoded_buff) {
     furi_check(instance);
     furi_check(icon_data);
@@ -52,10 +102,27 @@ void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint
 
     CompressHeader* header = (CompressHeader*)icon_data;
     if(header->is_compressed) {
+        const uint8_t* compressed = &icon_data[sizeof(CompressHeader)];
+        // Compressed data rarely exceeds decoded, larger icons are not worth hashing
+        bool cacheable = header->compressed_buff_size <= COMPRESS_ICON_CACHE_ENTRY_SIZE;
+        uint32_t hash = 0;
+
+        if(cacheable) {
+            hash = compress_icon_hash(compressed, header->compressed_buff_size);
+            CompressIconCacheEntry* entry = compress_icon_cache_find(
+                instance, icon_data, header->compressed_buff_size, hash);
+            if(entry) {
+                entry->last_use = ++instance->cache_clock;
+                *decoded_buff = entry->decoded_buff;
+                return;
+            }
+        }
+
         size_t data_processed = 0;
+        size_t decoded_size = 0;
         heatshrink_decoder_sink(
             instance->decoder,
-            (uint8_t*)&icon_data[sizeof(CompressHeader)],
+            (uint8_t*)compressed,
             header->compressed_buff_size,
             &data_processed);
         while(1) {
@@ -65,12 +132,23 @@ void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint
                 sizeof(instance->decoded_buff),
                 &data_processed);
             furi_check((res == HSDR_POLL_EMPTY) || (res == HSDR_POLL_MORE));
+            decoded_size += data_processed;
             if(res != HSDR_POLL_MORE) {
                 break;
             }
         }
         heatshrink_decoder_reset(instance->decoder);
         *decoded_buff = instance->decoded_buff;
+
+        if(cacheable && decoded_size <= COMPRESS_ICON_CACHE_ENTRY_SIZE) {
+            CompressIconCacheEntry* entry = compress_icon_cache_victim(instance);
+            entry->icon_data = icon_data;
+            entry->hash = hash;
+            entry->compressed_size = header->compressed_buff_size;
+            entry->last_use = ++instance->cache_clock;
+            memcpy(entry->decoded_buff, instance->decoded_buff, decoded_size);
+            *decoded_buff = entry->decoded_buff;
+        }
     } else {
         *decoded_buff = (uint8_t*)&icon_data[1];
     }
@@ -214,6 +292,7 @@ bool compress_decode(
         // Sink data to decoding buffer
         size_t compressed_size = header->compressed_buff_size;
         size_t sunk = sizeof(CompressHeader);
+        if(compressed_size > data_in_size) decode_failed = true;
         while(sunk < compressed_size && !decode_failed) {
             sink_res = heatshrink_decoder_sink(
                 compress->decoder, &data_in[sunk], compressed_size - sunk, &sink_size);
@@ -223,8 +302,16 @@ bool compress_decode(
             }
             sunk += sink_size;
             do {
+                // Output that does not fit is an error, not an endless poll
+                if(res_buff_size == data_out_size) {
+                    decode_failed = true;
+                    break;
+                }
                 poll_res = heatshrink_decoder_poll(
-                    compress->decoder, &data_out[res_buff_size], data_out_size, &poll_size);
+                    compress->decoder,
+                    &data_out[res_buff_size],
+                    data_out_size - res_buff_size,
+                    &poll_size);
                 if(poll_res < 0) {
                     decode_failed = true;
                     break;
@@ -238,18 +325,25 @@ bool compress_decode(
             if(finish_res < 0) {
                 decode_failed = true;
             } else {
-                do {
+                while(finish_res != HSDR_FINISH_DONE) {
+                    if(res_buff_size == data_out_size) {
+                        decode_failed = true;
+                        break;
+                    }
                     poll_res = heatshrink_decoder_poll(
-                        compress->decoder, &data_out[res_buff_size], data_out_size, &poll_size);
+                        compress->decoder,
+                        &data_out[res_buff_size],
+                        data_out_size - res_buff_size,
+                        &poll_size);
                     res_buff_size += poll_size;
                     finish_res = heatshrink_decoder_finish(compress->decoder);
-                } while(finish_res != HSDR_FINISH_DONE);
+                }
             }
         }
         *data_res_size = res_buff_size;
         result = !decode_failed;
     } else if(data_out_size >= data_in_size - 1) {
-        memcpy(data_out, &data_in[1], data_in_size);
+        memcpy(data_out, &data_in[1], data_in_size - 1);
         *data_res_size = data_in_size - 1;
         result = true;
     } else {
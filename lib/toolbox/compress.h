@@ -28,6 +28,9 @@ CompressIcon* compress_icon_alloc(void);
 void compress_icon_free(CompressIcon* instance);
 
 /** Decompress icon
+ *
+ * Small icons are kept decoded in a least recently used cache, so icons drawn
+ * on every frame are decoded once.
  *
  * @warning    decoded_buff pointer set by this function is valid till next
  *             `compress_icon_decode` or `compress_icon_free` call
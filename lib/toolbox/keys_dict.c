@@ -8,11 +8,39 @@
 
 #define TAG "KeysDict"
 
+#define KEYS_DICT_INDEX_EXTENSION ".idx"
+#define KEYS_DICT_INDEX_MAGIC (0x5844494BUL) // KIDX
+#define KEYS_DICT_INDEX_VERSION (1U)
+// Heap left untouched when allocating index, index is an optimization and must not starve apps
+#define KEYS_DICT_INDEX_HEAP_RESERVE (16U * 1024U)
+#define KEYS_DICT_INDEX_GROW_MIN (64U)
+#define KEYS_DICT_MERGE_CHUNK_SIZE (64U)
+
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t key_size;
+    uint16_t reserved;
+    uint32_t keys_count;
+    uint32_t dict_size;
+    uint32_t dict_timestamp;
+} KeysDictIndexHeader;
+
+typedef struct {
+    uint8_t* keys; // Sorted, key_size bytes each, duplicates from the file are kept
+    size_t count;
+    size_t capacity;
+    bool loaded_from_file;
+    bool modified;
+} KeysDictIndex;
+
 struct KeysDict {
     Stream* stream;
+    FuriString* path;
     size_t key_size;
     size_t key_size_symbols;
     size_t total_keys;
+    KeysDictIndex* index;
 };
 
 static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
@@ -72,6 +100,8 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     instance->stream = buffered_file_stream_alloc(storage);
+    instance->path = furi_string_alloc_set(path);
+    instance->index = NULL;
 
     FS_OpenMode open_mode = (mode == KeysDictModeOpenAlways) ? FSOM_OPEN_ALWAYS :
                                                                FSOM_OPEN_EXISTING;
@@ -112,12 +142,23 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
     return instance;
 }
 
+static void keys_dict_index_save(KeysDict* instance);
+static void keys_dict_index_free(KeysDict* instance);
+
 void keys_dict_free(KeysDict* instance) {
     furi_check(instance);
     furi_check(instance->stream);
 
     buffered_file_stream_close(instance->stream);
     stream_free(instance->stream);
+
+    // Dict file is closed at this point, its size and timestamp are final
+    if(instance->index) {
+        keys_dict_index_save(instance);
+        keys_dict_index_free(instance);
+    }
+
+    furi_string_free(instance->path);
     free(instance);
 
     furi_record_close(RECORD_STORAGE);
@@ -153,6 +194,273 @@ static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64
     }
 }
 
+static inline uint8_t* keys_dict_index_get(KeysDict* instance, size_t position) {
+    return instance->index->keys + position * instance->key_size;
+}
+
+static size_t keys_dict_index_lower_bound(KeysDict* instance, const uint8_t* key) {
+    size_t low = 0;
+    size_t high = instance->index->count;
+
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(memcmp(keys_dict_index_get(instance, middle), key, instance->key_size) < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static bool keys_dict_index_find(KeysDict* instance, const uint8_t* key, size_t* position) {
+    size_t lower_bound = keys_dict_index_lower_bound(instance, key);
+    if(position) *position = lower_bound;
+
+    return (lower_bound < instance->index->count) &&
+           (memcmp(keys_dict_index_get(instance, lower_bound), key, instance->key_size) == 0);
+}
+
+static bool keys_dict_index_reserve(KeysDict* instance, size_t capacity) {
+    KeysDictIndex* index = instance->index;
+    if(capacity <= index->capacity) return true;
+
+    size_t size = capacity * instance->key_size;
+    if(memmgr_heap_get_max_free_block() < size + KEYS_DICT_INDEX_HEAP_RESERVE) {
+        FURI_LOG_W(TAG, "Not enough memory for index of %zu keys", capacity);
+        return false;
+    }
+
+    index->keys = realloc(index->keys, size); //-V701
+    index->capacity = capacity;
+
+    return true;
+}
+
+static void keys_dict_index_free(KeysDict* instance) {
+    free(instance->index->keys);
+    free(instance->index);
+    instance->index = NULL;
+}
+
+static void keys_dict_index_insert(KeysDict* instance, const uint8_t* key) {
+    KeysDictIndex* index = instance->index;
+
+    if(index->count == index->capacity) {
+        // Grow by half, smallest step is tried too when memory is tight
+        size_t grow = MAX(index->capacity / 2, KEYS_DICT_INDEX_GROW_MIN);
+        if(!keys_dict_index_reserve(instance, index->capacity + grow) &&
+           !keys_dict_index_reserve(instance, index->capacity + KEYS_DICT_INDEX_GROW_MIN)) {
+            // Fall back to stream lookups instead of failing the caller
+            keys_dict_index_free(instance);
+            return;
+        }
+    }
+
+    size_t position = keys_dict_index_lower_bound(instance, key);
+    memmove(
+        keys_dict_index_get(instance, position + 1),
+        keys_dict_index_get(instance, position),
+        (index->count - position) * instance->key_size);
+    memcpy(keys_dict_index_get(instance, position), key, instance->key_size);
+    index->count++;
+    index->modified = true;
+}
+
+static void keys_dict_index_remove(KeysDict* instance, const uint8_t* key) {
+    KeysDictIndex* index = instance->index;
+
+    size_t position;
+    if(!keys_dict_index_find(instance, key, &position)) return;
+
+    memmove(
+        keys_dict_index_get(instance, position),
+        keys_dict_index_get(instance, position + 1),
+        (index->count - position - 1) * instance->key_size);
+    index->count--;
+    index->modified = true;
+}
+
+static void keys_dict_swap_keys(uint8_t* a, uint8_t* b, size_t key_size) {
+    for(size_t i = 0; i < key_size; i++) {
+        uint8_t tmp = a[i];
+        a[i] = b[i];
+        b[i] = tmp;
+    }
+}
+
+static void keys_dict_sift_down(uint8_t* keys, size_t key_size, size_t root, size_t count) {
+    while(root * 2 + 1 < count) {
+        size_t child = root * 2 + 1;
+        if(child + 1 < count &&
+           memcmp(keys + child * key_size, keys + (child + 1) * key_size, key_size) < 0) {
+            child++;
+        }
+        if(memcmp(keys + root * key_size, keys + child * key_size, key_size) >= 0) break;
+        keys_dict_swap_keys(keys + root * key_size, keys + child * key_size, key_size);
+        root = child;
+    }
+}
+
+/** In place heap sort, no extra memory besides the keys themselves */
+static void keys_dict_sort_keys(uint8_t* keys, size_t key_size, size_t count) {
+    if(count < 2) return;
+
+    for(size_t i = count / 2; i-- > 0;) {
+        keys_dict_sift_down(keys, key_size, i, count);
+    }
+    for(size_t end = count - 1; end > 0; end--) {
+        keys_dict_swap_keys(keys, keys + end * key_size, key_size);
+        keys_dict_sift_down(keys, key_size, 0, end);
+    }
+}
+
+static bool keys_dict_get_file_info(KeysDict* instance, uint32_t* size, uint32_t* timestamp) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    const char* path = furi_string_get_cstr(instance->path);
+
+    FileInfo file_info;
+    bool success = (storage_common_stat(storage, path, &file_info) == FSE_OK) &&
+                   (storage_common_timestamp(storage, path, timestamp) == FSE_OK);
+    if(success) *size = (uint32_t)file_info.size;
+
+    furi_record_close(RECORD_STORAGE);
+
+    return success;
+}
+
+static bool keys_dict_index_load(KeysDict* instance) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    FuriString* index_path = furi_string_alloc_set(instance->path);
+    furi_string_cat_str(index_path, KEYS_DICT_INDEX_EXTENSION);
+
+    bool loaded = false;
+    do {
+        uint32_t dict_size = 0;
+        uint32_t dict_timestamp = 0;
+        // Size of the open stream is used, buffered writes are not flushed to the file yet
+        if(!keys_dict_get_file_info(instance, &dict_size, &dict_timestamp)) break;
+        dict_size = stream_size(instance->stream);
+
+        if(!storage_file_open(
+               file, furi_string_get_cstr(index_path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+            break;
+        }
+
+        KeysDictIndexHeader header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != KEYS_DICT_INDEX_MAGIC || header.version != KEYS_DICT_INDEX_VERSION ||
+           header.key_size != instance->key_size || header.keys_count != instance->total_keys ||
+           header.dict_size != dict_size || header.dict_timestamp != dict_timestamp) {
+            FURI_LOG_D(TAG, "Index is outdated");
+            break;
+        }
+
+        if(!keys_dict_index_reserve(instance, header.keys_count)) break;
+
+        size_t size = header.keys_count * instance->key_size;
+        if(storage_file_read(file, instance->index->keys, size) != size) break;
+
+        instance->index->count = header.keys_count;
+        loaded = true;
+    } while(false);
+
+    furi_string_free(index_path);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return loaded;
+}
+
+static void keys_dict_index_save(KeysDict* instance) {
+    KeysDictIndex* index = instance->index;
+    if(index->loaded_from_file && !index->modified) return;
+
+    KeysDictIndexHeader header = {
+        .magic = KEYS_DICT_INDEX_MAGIC,
+        .version = KEYS_DICT_INDEX_VERSION,
+        .key_size = instance->key_size,
+        .keys_count = index->count,
+    };
+    if(!keys_dict_get_file_info(instance, &header.dict_size, &header.dict_timestamp)) return;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    FuriString* index_path = furi_string_alloc_set(instance->path);
+    furi_string_cat_str(index_path, KEYS_DICT_INDEX_EXTENSION);
+
+    size_t size = index->count * instance->key_size;
+    bool saved = storage_file_open(
+                     file, furi_string_get_cstr(index_path), FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                 (storage_file_write(file, &header, sizeof(header)) == sizeof(header)) &&
+                 (storage_file_write(file, index->keys, size) == size);
+    storage_file_close(file);
+
+    if(!saved) {
+        FURI_LOG_E(TAG, "Failed to save index");
+        storage_simply_remove(storage, furi_string_get_cstr(index_path));
+    }
+
+    furi_string_free(index_path);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static bool keys_dict_index_build(KeysDict* instance) {
+    if(!keys_dict_index_reserve(instance, instance->total_keys)) return false;
+
+    uint32_t actual_pos = stream_tell(instance->stream);
+    stream_rewind(instance->stream);
+
+    // Temporarily drop index, so reading keys does not touch it
+    KeysDictIndex* index = instance->index;
+    instance->index = NULL;
+
+    size_t count = 0;
+    while(count < index->capacity &&
+          keys_dict_get_next_key(
+              instance, index->keys + count * instance->key_size, instance->key_size)) {
+        count++;
+    }
+
+    instance->index = index;
+    stream_seek(instance->stream, actual_pos, StreamOffsetFromStart);
+
+    keys_dict_sort_keys(index->keys, instance->key_size, count);
+    index->count = count;
+
+    return true;
+}
+
+bool keys_dict_enable_index(KeysDict* instance) {
+    furi_check(instance);
+    furi_check(instance->stream);
+
+    if(instance->index) return true;
+
+    instance->index = malloc(sizeof(KeysDictIndex));
+    instance->index->keys = NULL;
+    instance->index->count = 0;
+    instance->index->capacity = 0;
+    instance->index->loaded_from_file = false;
+    instance->index->modified = false;
+
+    if(keys_dict_index_load(instance)) {
+        instance->index->loaded_from_file = true;
+        FURI_LOG_I(TAG, "Index loaded, %zu keys", instance->index->count);
+    } else if(keys_dict_index_build(instance)) {
+        FURI_LOG_I(TAG, "Index built, %zu keys", instance->index->count);
+    } else {
+        keys_dict_index_free(instance);
+    }
+
+    return instance->index != NULL;
+}
+
 size_t keys_dict_get_total_keys(KeysDict* instance) {
     furi_check(instance);
 
@@ -239,6 +547,10 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    if(instance->index) {
+        return keys_dict_index_find(instance, key, NULL);
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     keys_dict_int_to_str(instance, key, temp_key);
@@ -280,6 +592,9 @@ bool keys_dict_add_key(KeysDict* instance, const uint8_t* key, size_t key_size)
 
     keys_dict_int_to_str(instance, key, temp_key);
     bool key_added = keys_dict_add_key_str(instance, temp_key);
+    if(key_added && instance->index) {
+        keys_dict_index_insert(instance, key);
+    }
 
     FURI_LOG_I(TAG, "Added key %s", furi_string_get_cstr(temp_key));
 
@@ -312,6 +627,9 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
             }
             instance->total_keys--;
             key_removed = true;
+            if(instance->index) {
+                keys_dict_index_remove(instance, key);
+            }
         }
     }
 
@@ -328,3 +646,143 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
 
     return key_removed;
 }
+
+size_t keys_dict_add_keys(
+    KeysDict* instance,
+    const uint8_t* keys,
+    size_t keys_count,
+    size_t key_size) {
+    furi_check(instance);
+    furi_check(instance->stream);
+    furi_check(instance->key_size == key_size);
+    furi_check(keys || !keys_count);
+
+    if(!keys_count) return 0;
+
+    // Sorted copy of the batch, one file pass checks every key of the batch at once
+    uint8_t* sorted_keys = malloc(keys_count * key_size);
+    memcpy(sorted_keys, keys, keys_count * key_size);
+    keys_dict_sort_keys(sorted_keys, key_size, keys_count);
+
+    uint8_t* is_present = malloc(keys_count);
+    memset(is_present, 0, keys_count);
+
+    if(instance->index) {
+        for(size_t i = 0; i < keys_count; i++) {
+            is_present[i] = keys_dict_index_find(instance, sorted_keys + i * key_size, NULL);
+        }
+    } else {
+        uint32_t actual_pos = stream_tell(instance->stream);
+        stream_rewind(instance->stream);
+
+        uint8_t* key = malloc(key_size);
+        while(keys_dict_get_next_key(instance, key, key_size)) {
+            size_t low = 0;
+            size_t high = keys_count;
+            while(low < high) {
+                size_t middle = low + (high - low) / 2;
+                if(memcmp(sorted_keys + middle * key_size, key, key_size) < 0) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            if(low < keys_count && memcmp(sorted_keys + low * key_size, key, key_size) == 0) {
+                is_present[low] = true;
+            }
+        }
+        free(key);
+
+        stream_seek(instance->stream, actual_pos, StreamOffsetFromStart);
+    }
+
+    // Keep caller order, skip keys already in the dict and repeated keys of the batch
+    FuriString* lines = furi_string_alloc();
+    FuriString* temp_key = furi_string_alloc();
+    size_t keys_added = 0;
+
+    for(size_t i = 0; i < keys_count; i++) {
+        const uint8_t* key = keys + i * key_size;
+
+        size_t low = 0;
+        size_t high = keys_count;
+        while(low < high) {
+            size_t middle = low + (high - low) / 2;
+            if(memcmp(sorted_keys + middle * key_size, key, key_size) < 0) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        // Equal keys are adjacent, flag on the first one covers them all
+        if(is_present[low]) continue;
+        is_present[low] = true;
+
+        keys_dict_int_to_str(instance, key, temp_key);
+        furi_string_cat(lines, temp_key);
+        furi_string_push_back(lines, '\n');
+        keys_added++;
+    }
+
+    if(keys_added) {
+        uint32_t actual_pos = stream_tell(instance->stream);
+
+        if(stream_seek(instance->stream, 0, StreamOffsetFromEnd) &&
+           stream_insert_string(instance->stream, lines)) {
+            instance->total_keys += keys_added;
+
+            if(instance->index) {
+                for(size_t i = 0; i < keys_count && instance->index; i++) {
+                    const uint8_t* key = keys + i * key_size;
+                    if(!keys_dict_index_find(instance, key, NULL)) {
+                        keys_dict_index_insert(instance, key);
+                    }
+                }
+            }
+        } else {
+            keys_added = 0;
+        }
+
+        stream_seek(instance->stream, actual_pos, StreamOffsetFromStart);
+    }
+
+    FURI_LOG_I(TAG, "Added %zu of %zu keys", keys_added, keys_count);
+
+    furi_string_free(temp_key);
+    furi_string_free(lines);
+    free(is_present);
+    free(sorted_keys);
+
+    return keys_added;
+}
+
+size_t keys_dict_merge(KeysDict* instance, KeysDict* source) {
+    furi_check(instance);
+    furi_check(source);
+    furi_check(instance != source);
+    furi_check(instance->key_size == source->key_size);
+
+    size_t key_size = instance->key_size;
+    uint8_t* keys = malloc(KEYS_DICT_MERGE_CHUNK_SIZE * key_size);
+    size_t keys_added = 0;
+
+    keys_dict_rewind(source);
+    bool is_endfile = false;
+    while(!is_endfile) {
+        size_t keys_count = 0;
+        while(keys_count < KEYS_DICT_MERGE_CHUNK_SIZE) {
+            if(!keys_dict_get_next_key(source, keys + keys_count * key_size, key_size)) {
+                is_endfile = true;
+                break;
+            }
+            keys_count++;
+        }
+        keys_added += keys_dict_add_keys(instance, keys, keys_count, key_size);
+    }
+    keys_dict_rewind(source);
+
+    free(keys);
+
+    return keys_added;
+}
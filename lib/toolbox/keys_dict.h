@@ -98,6 +98,44 @@ bool keys_dict_add_key(KeysDict* instance, const uint8_t* key, size_t key_size);
 */
 bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_size);
 
+/** Enable in-RAM index of the list
+ * Keys are kept sorted in memory, so presence checks don't read the file.
+ * Index is stored next to the list file and reused while the list is unchanged.
+ * If there is not enough memory, list keeps working without index.
+ *
+ * @param instance  - KeysDict list instance
+ *
+ * @return Returns true if index is enabled, false otherwise
+*/
+bool keys_dict_enable_index(KeysDict* instance);
+
+/** Add multiple keys to list
+ * Keys already present in the list and repeated keys are skipped.
+ * Presence of the whole batch is checked with a single pass over the list.
+ *
+ * @param instance   - KeysDict list instance
+ * @param keys       - Keys to add, key_size bytes each
+ * @param keys_count - Number of keys
+ * @param key_size   - Size of each key in bytes
+ *
+ * @return Returns number of keys added
+*/
+size_t keys_dict_add_keys(
+    KeysDict* instance,
+    const uint8_t* keys,
+    size_t keys_count,
+    size_t key_size);
+
+/** Merge keys of another list into list
+ * Keys already present in the list are skipped.
+ *
+ * @param instance  - KeysDict list instance to add keys to
+ * @param source    - KeysDict list instance to read keys from
+ *
+ * @return Returns number of keys added
+*/
+size_t keys_dict_merge(KeysDict* instance, KeysDict* source);
+
 #ifdef __cplusplus
 }
 #endif
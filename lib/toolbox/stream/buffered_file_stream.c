@@ -200,6 +200,13 @@ static size_t buffered_file_stream_read(BufferedFileStream* stream, uint8_t* dat
             if(stream->sync_pending) {
                 if(!buffered_file_stream_flush(stream)) break;
             }
+            // Cache is drained, so a large read can go straight into the caller buffer
+            if(need_to_read >= STREAM_CACHE_MAX_SIZE) {
+                stream_cache_drop(stream->cache);
+                need_to_read -= stream_read(
+                    stream->file_stream, data + (size - need_to_read), need_to_read);
+                break;
+            }
             if(!stream_cache_fill(stream->cache, stream->file_stream)) break;
         }
     }
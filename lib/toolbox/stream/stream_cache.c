@@ -1,7 +1,5 @@
 #include "stream_cache.h"
 
-#define STREAM_CACHE_MAX_SIZE 1024U
-
 struct StreamCache {
     uint8_t data[STREAM_CACHE_MAX_SIZE];
     size_t data_size;
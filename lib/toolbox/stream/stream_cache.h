@@ -6,6 +6,8 @@
 extern "C" {
 #endif
 
+#define STREAM_CACHE_MAX_SIZE 1024U
+
 typedef struct StreamCache StreamCache;
 
 /**
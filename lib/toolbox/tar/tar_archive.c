@@ -7,7 +7,7 @@
 
 #define TAG "TarArch"
 #define MAX_NAME_LEN 254
-#define FILE_BLOCK_SIZE 512
+#define FILE_BLOCK_SIZE 4096
 
 #define FILE_OPEN_NTRIES 10
 #define FILE_OPEN_RETRY_DELAY 25
@@ -21,12 +21,12 @@ typedef struct TarArchive {
 
 /* API WRAPPER */
 static int mtar_storage_file_write(void* stream, const void* data, unsigned size) {
-    uint16_t bytes_written = storage_file_write(stream, data, size);
+    size_t bytes_written = storage_file_write(stream, data, size);
     return (bytes_written == size) ? bytes_written : MTAR_EWRITEFAIL;
 }
 
 static int mtar_storage_file_read(void* stream, void* data, unsigned size) {
-    uint16_t bytes_read = storage_file_read(stream, data, size);
+    size_t bytes_read = storage_file_read(stream, data, size);
     return (bytes_read == size) ? bytes_read : MTAR_EREADFAIL;
 }
 
@@ -298,7 +298,7 @@ bool tar_archive_add_file(
         }
 
         success = true; // if file is empty, that's not an error
-        uint16_t bytes_read = 0;
+        size_t bytes_read = 0;
         while((bytes_read = storage_file_read(src_file, file_buffer, FILE_BLOCK_SIZE))) {
             success = tar_archive_file_add_data_block(archive, file_buffer, bytes_read);
             if(!success) {